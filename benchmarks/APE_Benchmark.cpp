@@ -0,0 +1,173 @@
+#include "APE_Benchmark.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+namespace {
+    double ElapsedNanoseconds(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) {
+        return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    }
+
+    double TimeSample(const std::function<void(std::size_t)>& function, std::size_t iterations) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        function(iterations);
+        APE::Benchmarks::ClobberMemory();
+        return ElapsedNanoseconds(start, std::chrono::steady_clock::now());
+    }
+
+    // The nearest-rank percentile of sorted values.
+    double Percentile(const std::vector<double>& sorted, double percent) {
+        std::size_t rank = (std::size_t)std::ceil(percent / 100.0 * sorted.size());
+        return sorted[std::min(sorted.size() - 1, rank > 0 ? rank - 1 : 0)];
+    }
+
+    void WriteJSONString(std::ostream& stream, const std::string& text) {
+        stream << '"';
+        for (char c : text) {
+            if (c == '"' || c == '\\') stream << '\\' << c;
+            else if ((unsigned char)c < 0x20) stream << ' ';
+            else stream << c;
+        }
+        stream << '"';
+    }
+
+    std::string FormatTime(double nanoseconds) {
+        std::ostringstream stream;
+        stream << std::fixed << std::setprecision(nanoseconds < 10 ? 3 : 1);
+        if (nanoseconds < 1e4) stream << nanoseconds << " ns";
+        else if (nanoseconds < 1e7) stream << nanoseconds / 1e3 << " us";
+        else stream << nanoseconds / 1e6 << " ms";
+        return stream.str();
+    }
+}
+
+//* --- APE::Benchmarks ---
+
+void APE::Benchmarks::ClobberMemory() {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : : "memory");
+#else
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+//* --- APE::Benchmarks::BenchmarkResult ---
+
+double APE::Benchmarks::BenchmarkResult::ItemsPerSecond() const {
+    if (ItemsPerIteration <= 0 || Median <= 0) return 0;
+    return ItemsPerIteration * 1e9 / Median;
+}
+
+//* --- APE::Benchmarks::BenchmarkSuite ---
+
+void APE::Benchmarks::BenchmarkSuite::Add(const std::string& name, const std::function<void(std::size_t)>& function,
+    double itemsPerIteration, const std::string& itemsName) {
+    m_benchmarks.push_back(Benchmark{ name, function, itemsPerIteration, itemsName });
+}
+
+std::size_t APE::Benchmarks::BenchmarkSuite::Count() const { return m_benchmarks.size(); }
+
+std::vector<std::string> APE::Benchmarks::BenchmarkSuite::GetNames(const std::string& filter) const {
+    std::vector<std::string> names;
+    for (const Benchmark& benchmark : m_benchmarks)
+        if (IsMatching(benchmark.Name, filter)) names.push_back(benchmark.Name);
+    return names;
+}
+
+bool APE::Benchmarks::BenchmarkSuite::IsMatching(const std::string& name, const std::string& filter) {
+    return filter.empty() || name.find(filter) != std::string::npos;
+}
+
+std::size_t APE::Benchmarks::BenchmarkSuite::Calibrate(const Benchmark& benchmark, const BenchmarkOptions& options) {
+    // Grow the iterations geometrically, then scale them from the last sample to land near the target.
+    const double target = options.MinSampleMicroseconds * 1e3;
+    std::size_t iterations = 1;
+    while (true) {
+        double elapsed = TimeSample(benchmark.Function, iterations);
+        if (elapsed >= target) return iterations;
+        if (elapsed < target / 100) iterations *= 10;
+        else return std::max<std::size_t>(iterations + 1, (std::size_t)std::ceil(iterations * target * 1.2 / elapsed));
+    }
+}
+
+std::vector<APE::Benchmarks::BenchmarkResult> APE::Benchmarks::BenchmarkSuite::Run(const BenchmarkOptions& options, std::ostream* progress) const {
+    std::vector<BenchmarkResult> results;
+    for (const Benchmark& benchmark : m_benchmarks) {
+        if (!IsMatching(benchmark.Name, options.Filter)) continue;
+
+        std::size_t iterations = Calibrate(benchmark, options);
+        for (std::size_t i = 0; i < options.Warmup; i++)
+            TimeSample(benchmark.Function, iterations);
+
+        std::vector<double> samples;
+        std::size_t repetitions = std::max<std::size_t>(1, options.Repetitions);
+        samples.reserve(repetitions);
+        for (std::size_t i = 0; i < repetitions; i++)
+            samples.push_back(TimeSample(benchmark.Function, iterations) / iterations);
+        std::sort(samples.begin(), samples.end());
+
+        BenchmarkResult result;
+        result.Name = benchmark.Name;
+        result.Iterations = iterations;
+        result.Samples = samples.size();
+        result.Median = Percentile(samples, 50);
+        result.P99 = Percentile(samples, 99);
+        result.Min = samples.front();
+        double sum = 0;
+        for (double sample : samples) sum += sample;
+        result.Mean = sum / samples.size();
+        result.ItemsPerIteration = benchmark.ItemsPerIteration;
+        result.ItemsName = benchmark.ItemsName;
+        results.push_back(result);
+
+        if (progress) {
+            WriteTable(*progress, std::vector<BenchmarkResult>(1, result));
+            progress->flush();
+        }
+    }
+    return results;
+}
+
+//* --- APE::Benchmarks output ---
+
+void APE::Benchmarks::WriteTable(std::ostream& stream, const std::vector<BenchmarkResult>& results) {
+    for (const BenchmarkResult& result : results) {
+        stream << std::left << std::setw(60) << result.Name << std::right
+               << " median " << std::setw(12) << FormatTime(result.Median)
+               << "  p99 " << std::setw(12) << FormatTime(result.P99);
+        if (result.ItemsPerIteration > 0)
+            stream << "  " << std::fixed << std::setprecision(1) << result.ItemsPerSecond() / 1e6
+                   << " M" << result.ItemsName << "/s";
+        stream << '\n';
+    }
+}
+
+void APE::Benchmarks::WriteJSON(std::ostream& stream, const std::vector<BenchmarkResult>& results, const BenchmarkOptions& options) {
+    std::ios_base::fmtflags flags = stream.flags();
+    std::streamsize precision = stream.precision();
+    stream << std::fixed << std::setprecision(3);
+
+    stream << "{\n  \"warmup\": " << options.Warmup << ",\n  \"repetitions\": " << options.Repetitions
+           << ",\n  \"unit\": \"ns\",\n  \"benchmarks\": [";
+    for (std::size_t i = 0; i < results.size(); i++) {
+        const BenchmarkResult& result = results[i];
+        stream << (i ? ",\n    {" : "\n    {") << "\"name\": ";
+        WriteJSONString(stream, result.Name);
+        stream << ", \"iterations\": " << result.Iterations << ", \"samples\": " << result.Samples
+               << ", \"median\": " << result.Median << ", \"p99\": " << result.P99
+               << ", \"min\": " << result.Min << ", \"mean\": " << result.Mean;
+        if (result.ItemsPerIteration > 0) {
+            stream << ", \"items_per_second\": " << result.ItemsPerSecond() << ", \"items\": ";
+            WriteJSONString(stream, result.ItemsName);
+        }
+        stream << '}';
+    }
+    stream << "\n  ]\n}\n";
+
+    stream.flags(flags);
+    stream.precision(precision);
+}
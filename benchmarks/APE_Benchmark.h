@@ -0,0 +1,129 @@
+#ifndef __APE_BENCHMARK_H__
+#define __APE_BENCHMARK_H__
+
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace APE {
+    namespace Benchmarks {
+        /// @brief The Benchmark Options struct, contain the settings of a benchmark run.
+        struct BenchmarkOptions {
+        public:
+            /// @brief The number of samples run and discarded before measuring.
+            std::size_t Warmup = 3;
+            /// @brief The number of measured samples, the statistics are computed over them.
+            std::size_t Repetitions = 31;
+            /// @brief The minimum duration of a sample in microseconds, the iterations count of a sample is
+            /// calibrated to reach it so the clock resolution doesn't matter.
+            double MinSampleMicroseconds = 2000;
+            /// @brief Only run the benchmarks whose name contain this text (all if empty).
+            std::string Filter;
+        };
+
+        /// @brief The Benchmark Result struct, contain the statistics of a benchmark.
+        struct BenchmarkResult {
+        public:
+            /// @brief The name of the benchmark.
+            std::string Name;
+            /// @brief The number of iterations of each sample.
+            std::size_t Iterations = 0;
+            /// @brief The number of measured samples.
+            std::size_t Samples = 0;
+            /// @brief The median time of an iteration, in nanoseconds.
+            double Median = 0;
+            /// @brief The 99th percentile time of an iteration, in nanoseconds.
+            double P99 = 0;
+            /// @brief The fastest time of an iteration, in nanoseconds.
+            double Min = 0;
+            /// @brief The mean time of an iteration, in nanoseconds.
+            double Mean = 0;
+            /// @brief The number of items (e.g. pixels, vertices) processed by an iteration, 0 if not relevant.
+            double ItemsPerIteration = 0;
+            /// @brief The name of the items processed by an iteration.
+            std::string ItemsName;
+
+            /// @brief Get the throughput at the median time.
+            /// @return The number of items processed per second, or 0 if the benchmark has no items.
+            double ItemsPerSecond() const;
+        };
+
+        /// @brief The Benchmark Suite class, hold a list of benchmarks and run them.
+        /// @note A benchmark function run its measured code the given number of iterations. Setup can be done
+        /// before the loop, since a sample is timed around the whole call and its setup is amortised.
+        class BenchmarkSuite {
+        private:
+            struct Benchmark {
+                std::string Name;
+                std::function<void(std::size_t)> Function;
+                double ItemsPerIteration;
+                std::string ItemsName;
+            };
+            std::vector<Benchmark> m_benchmarks;
+
+            /// @brief Check if the given benchmark name match the filter.
+            static bool IsMatching(const std::string& name, const std::string& filter);
+            /// @brief Find the number of iterations needed for a sample to last at least the minimum duration.
+            static std::size_t Calibrate(const Benchmark& benchmark, const BenchmarkOptions& options);
+        public:
+            /// @brief Add a benchmark to the suite.
+            /// @param name The name of the benchmark, by convention "Group/Case".
+            /// @param function The benchmark function, which run the measured code the given number of iterations.
+            /// @param itemsPerIteration The number of items processed by an iteration, for the throughput (0 if none).
+            /// @param itemsName The name of the items (e.g. "pixels").
+            void Add(const std::string& name, const std::function<void(std::size_t)>& function,
+                double itemsPerIteration = 0, const std::string& itemsName = "");
+
+            /// @brief Get the number of benchmarks in the suite.
+            /// @return The number of benchmarks.
+            std::size_t Count() const;
+            /// @brief Get the names of the benchmarks whose name contain the given filter.
+            /// @param filter The text to look for (all the benchmarks if empty).
+            /// @return The names of the matching benchmarks, in the order they were added.
+            std::vector<std::string> GetNames(const std::string& filter = "") const;
+
+            /// @brief Run the benchmarks matching the options filter, in the order they were added.
+            /// @param options The options of the run.
+            /// @param progress The stream to print the results to as they are done, or nullptr.
+            /// @return The results of the run benchmarks.
+            std::vector<BenchmarkResult> Run(const BenchmarkOptions& options, std::ostream* progress) const;
+        };
+
+        /// @brief Print the given results as a human readable table.
+        void WriteTable(std::ostream& stream, const std::vector<BenchmarkResult>& results);
+        /// @brief Print the given results as JSON, to compare runs from before and after a change.
+        void WriteJSON(std::ostream& stream, const std::vector<BenchmarkResult>& results, const BenchmarkOptions& options);
+
+        /// @brief Prevent the compiler from optimising away the computation of the given value.
+        template <typename T>
+        void DoNotOptimize(const T& value);
+        /// @brief Prevent the compiler from assuming that the memory is unchanged (or unused) across this point.
+        void ClobberMemory();
+
+        /// @brief Add the benchmarks of the APE core types (Color, KnownColor, Rectangle, Vector2, Vector3, Sprite).
+        void AddStructureBenchmarks(BenchmarkSuite& suite);
+        /// @brief Add the benchmarks of the color processing (color spaces).
+        void AddColorBenchmarks(BenchmarkSuite& suite);
+        /// @brief Add the benchmarks of the software renderer paths (raster kernels, tiled rasterization).
+        void AddSoftwareRendererBenchmarks(BenchmarkSuite& suite);
+        /// @brief Add the benchmarks of the SDL2 renderer paths, run against an SDL2 software renderer on a
+        /// hidden window (the SDL2 video driver default to dummy, unless set through SDL_VIDEODRIVER).
+        /// @return true if SDL2 could be initialised, false otherwise (no benchmark was added).
+        bool AddSDL2RendererBenchmarks(BenchmarkSuite& suite);
+    }
+}
+
+template <typename T>
+void APE::Benchmarks::DoNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    // The volatile read force the value to be materialised.
+    const volatile char* bytes = reinterpret_cast<const volatile char*>(&value);
+    (void)bytes[0];
+#endif
+}
+
+#endif // __APE_BENCHMARK_H__
@@ -0,0 +1,336 @@
+#include "APE_Benchmark.h"
+
+#include "APE/APE_Blend.h"
+#include "APE/APE_Color.h"
+#include "APE/APE_ColorSpace.h"
+#include "APE/APE_Gradient.h"
+#include "APE/APE_Palette.h"
+#include "APE/APE_PixelFormat.h"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace {
+    const std::size_t ColorsCount = 1024;
+
+    std::vector<APE::Color> MakeColors(std::uint32_t state) {
+        std::vector<APE::Color> colors;
+        for (std::size_t i = 0; i < ColorsCount; i++) {
+            state = state * 1664525u + 1013904223u;
+            colors.push_back(APE::Color((state >> 8) & 0xFF, (state >> 16) & 0xFF, (state >> 24) & 0xFF, 255));
+        }
+        return colors;
+    }
+
+    // The straightforward gamma-correct lerp, with the sRGB transfer functions computed per channel.
+    float NaiveToLinear(std::uint8_t value) {
+        float v = value / 255.0f;
+        return v <= 0.04045f ? v / 12.92f : std::pow((v + 0.055f) / 1.055f, 2.4f);
+    }
+
+    std::uint8_t NaiveToSRGB(float value) {
+        float v = value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+        return (std::uint8_t)std::lround(APE_FAST_CLAMP(0.0f, 1.0f, v) * 255.0f);
+    }
+
+    APE::Color NaiveLerpLinear(const APE::Color& a, const APE::Color& b, float t) {
+        return APE::Color(NaiveToSRGB(NaiveToLinear(a.Red) + (NaiveToLinear(b.Red) - NaiveToLinear(a.Red)) * t),
+                          NaiveToSRGB(NaiveToLinear(a.Green) + (NaiveToLinear(b.Green) - NaiveToLinear(a.Green)) * t),
+                          NaiveToSRGB(NaiveToLinear(a.Blue) + (NaiveToLinear(b.Blue) - NaiveToLinear(a.Blue)) * t),
+                          (std::uint8_t)std::lround(a.Alpha + (b.Alpha - a.Alpha) * t));
+    }
+
+    // The straight alpha blend, as the software renderer did it per pixel.
+    std::uint8_t BlendChannel(unsigned src, unsigned dst, unsigned alpha) { return (std::uint8_t)((src * alpha + dst * (255 - alpha) + 127) / 255); }
+
+    APE::Color StraightOver(const APE::Color& src, const APE::Color& dst) {
+        return APE::Color(BlendChannel(src.Red, dst.Red, src.Alpha), BlendChannel(src.Green, dst.Green, src.Alpha),
+                          BlendChannel(src.Blue, dst.Blue, src.Alpha), BlendChannel(255, dst.Alpha, src.Alpha));
+    }
+
+    // The nearest palette color, compared with every palette color.
+    std::uint8_t NaiveFindNearest(const APE::Palette& palette, const APE::Color& color) {
+        std::uint8_t nearest = 0;
+        int nearestDistance = 1 << 30;
+        for (std::size_t i = 0; i < palette.GetColorsCount(); i++) {
+            const APE::Color& entry = palette.GetColors()[i];
+            int dr = entry.Red - color.Red, dg = entry.Green - color.Green, db = entry.Blue - color.Blue;
+            if (dr * dr + dg * dg + db * db < nearestDistance) {
+                nearestDistance = dr * dr + dg * dg + db * db;
+                nearest = (std::uint8_t)i;
+            }
+        }
+        return nearest;
+    }
+}
+
+void APE::Benchmarks::AddColorBenchmarks(BenchmarkSuite& suite) {
+    static const std::vector<APE::Color> colors = MakeColors(5);
+    static const std::vector<APE::Color> targets = MakeColors(6);
+
+    // The gamma-correct lerp, naive then with the lookup tables, against the gamma-encoded one.
+    suite.Add("ColorSpace/Lerp/Naive/1024Colors", [](std::size_t iterations) {
+        std::vector<APE::Color> out(ColorsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            for (std::size_t c = 0; c < ColorsCount; c++)
+                out[c] = NaiveLerpLinear(colors[c], targets[c], 0.35f);
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "colors");
+    suite.Add("ColorSpace/Lerp/1024Colors", [](std::size_t iterations) {
+        std::vector<APE::Color> out(ColorsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            for (std::size_t c = 0; c < ColorsCount; c++)
+                out[c] = APE::ColorSpace::Lerp(colors[c], targets[c], 0.35f);
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "colors");
+    suite.Add("ColorSpace/LerpSpan/1024Colors", [](std::size_t iterations) {
+        std::vector<APE::Color> out(ColorsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            APE::ColorSpace::LerpSpan(colors.data(), targets.data(), 0.35f, out.data(), ColorsCount);
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "colors");
+    suite.Add("ColorSpace/Lerp/GammaEncodedSpan/1024Colors", [](std::size_t iterations) {
+        std::vector<APE::Color> out(ColorsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            APE::Color::LerpSpan(colors.data(), targets.data(), 0.35f, out.data(), ColorsCount);
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "colors");
+
+    suite.Add("ColorSpace/ToLinear/Naive/1024Colors", [](std::size_t iterations) {
+        std::vector<float> out(ColorsCount * 3);
+        for (std::size_t i = 0; i < iterations; i++) {
+            for (std::size_t c = 0; c < ColorsCount; c++) {
+                out[c * 3] = NaiveToLinear(colors[c].Red);
+                out[c * 3 + 1] = NaiveToLinear(colors[c].Green);
+                out[c * 3 + 2] = NaiveToLinear(colors[c].Blue);
+            }
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "colors");
+    suite.Add("ColorSpace/ToLinear/1024Colors", [](std::size_t iterations) {
+        std::vector<APE::LinearColor> out(ColorsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            APE::ColorSpace::ToLinear(colors.data(), out.data(), ColorsCount);
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "colors");
+    suite.Add("ColorSpace/ToSRGB/1024Colors", [](std::size_t iterations) {
+        std::vector<APE::LinearColor> linear(ColorsCount);
+        std::vector<APE::Color> out(ColorsCount);
+        APE::ColorSpace::ToLinear(colors.data(), linear.data(), ColorsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            APE::ColorSpace::ToSRGB(linear.data(), out.data(), ColorsCount);
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "colors");
+
+    // Alpha blending translucent sources, straight alpha per pixel against the premultiplied kernels.
+    static std::vector<APE::Color> translucent;
+    if (translucent.empty()) {
+        translucent = MakeColors(7);
+        for (std::size_t c = 0; c < ColorsCount; c++)
+            translucent[c].Alpha = (std::uint8_t)(c * 37);
+    }
+    suite.Add("Blend/Over/Straight/1024Colors", [](std::size_t iterations) {
+        std::vector<APE::Color> out(colors);
+        for (std::size_t i = 0; i < iterations; i++) {
+            for (std::size_t c = 0; c < ColorsCount; c++)
+                out[c] = StraightOver(translucent[c], out[c]);
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "colors");
+    suite.Add("Blend/Over/1024Colors", [](std::size_t iterations) {
+        std::vector<APE::PremultipliedColor> src(ColorsCount);
+        std::vector<APE::Color> out(colors);
+        APE::PremultipliedColor::FromColors(translucent.data(), src.data(), ColorsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            APE::Blend::Over(src.data(), out.data(), ColorsCount);
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "colors");
+    suite.Add("Blend/Add/1024Colors", [](std::size_t iterations) {
+        std::vector<APE::PremultipliedColor> src(ColorsCount);
+        std::vector<APE::Color> out(colors);
+        APE::PremultipliedColor::FromColors(translucent.data(), src.data(), ColorsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            APE::Blend::Add(src.data(), out.data(), ColorsCount);
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "colors");
+    suite.Add("Blend/FromColors/1024Colors", [](std::size_t iterations) {
+        std::vector<APE::PremultipliedColor> out(ColorsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            APE::PremultipliedColor::FromColors(translucent.data(), out.data(), ColorsCount);
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "colors");
+
+    // Converting a framebuffer row for a streaming texture upload, with the per-pixel shifts against the converter.
+    suite.Add("PixelConverter/ToPixels/ARGB8888/Naive/1024Colors", [](std::size_t iterations) {
+        std::vector<std::uint32_t> out(ColorsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            for (std::size_t c = 0; c < ColorsCount; c++)
+                out[c] = ((std::uint32_t)colors[c].Alpha << 24) | ((std::uint32_t)colors[c].Red << 16) | ((std::uint32_t)colors[c].Green << 8) | colors[c].Blue;
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "colors");
+    suite.Add("PixelConverter/ToPixels/ARGB8888/1024Colors", [](std::size_t iterations) {
+        std::vector<std::uint32_t> out(ColorsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            APE::PixelConverter::ToPixels(colors.data(), out.data(), APE::PixelFormat::ARGB8888, ColorsCount);
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "colors");
+    suite.Add("PixelConverter/ToPixels/RGB565/1024Colors", [](std::size_t iterations) {
+        std::vector<std::uint16_t> out(ColorsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            APE::PixelConverter::ToPixels(colors.data(), out.data(), APE::PixelFormat::RGB565, ColorsCount);
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "colors");
+    suite.Add("PixelConverter/FromPixels/ARGB8888/1024Colors", [](std::size_t iterations) {
+        std::vector<std::uint32_t> pixels(ColorsCount);
+        std::vector<APE::Color> out(ColorsCount);
+        APE::PixelConverter::ToPixels(colors.data(), pixels.data(), APE::PixelFormat::ARGB8888, ColorsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            APE::PixelConverter::FromPixels(pixels.data(), APE::PixelFormat::ARGB8888, out.data(), ColorsCount);
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "colors");
+
+    // The color models, a color at a time against the spans.
+    suite.Add("Color/ToHSV/1024Colors", [](std::size_t iterations) {
+        std::vector<APE::HSVColor> out(ColorsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            for (std::size_t c = 0; c < ColorsCount; c++)
+                out[c] = colors[c].ToHSV();
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "colors");
+    suite.Add("Color/ToHSVSpan/1024Colors", [](std::size_t iterations) {
+        std::vector<APE::HSVColor> out(ColorsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            APE::Color::ToHSVSpan(colors.data(), out.data(), ColorsCount);
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "colors");
+    suite.Add("Color/FromHSV/1024Colors", [](std::size_t iterations) {
+        std::vector<APE::HSVColor> hsv(ColorsCount);
+        std::vector<APE::Color> out(ColorsCount);
+        APE::Color::ToHSVSpan(colors.data(), hsv.data(), ColorsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            for (std::size_t c = 0; c < ColorsCount; c++)
+                out[c] = APE::Color::FromHSV(hsv[c]);
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "colors");
+    suite.Add("Color/FromHSVSpan/1024Colors", [](std::size_t iterations) {
+        std::vector<APE::HSVColor> hsv(ColorsCount);
+        std::vector<APE::Color> out(ColorsCount);
+        APE::Color::ToHSVSpan(colors.data(), hsv.data(), ColorsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            APE::Color::FromHSVSpan(hsv.data(), out.data(), ColorsCount);
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "colors");
+    suite.Add("Color/ToOKLab/1024Colors", [](std::size_t iterations) {
+        std::vector<APE::OKLabColor> out(ColorsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            for (std::size_t c = 0; c < ColorsCount; c++)
+                out[c] = colors[c].ToOKLab();
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "colors");
+    suite.Add("Color/ToOKLabSpan/1024Colors", [](std::size_t iterations) {
+        std::vector<APE::OKLabColor> out(ColorsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            APE::Color::ToOKLabSpan(colors.data(), out.data(), ColorsCount);
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "colors");
+    suite.Add("Color/FromOKLabSpan/1024Colors", [](std::size_t iterations) {
+        std::vector<APE::OKLabColor> lab(ColorsCount);
+        std::vector<APE::Color> out(ColorsCount);
+        APE::Color::ToOKLabSpan(colors.data(), lab.data(), ColorsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            APE::Color::FromOKLabSpan(lab.data(), out.data(), ColorsCount);
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "colors");
+
+    // A color ramp (a hue sweep), computed per sample against the baked gradient.
+    suite.Add("Gradient/Sample/HSVSweep/1024Samples", [](std::size_t iterations) {
+        std::vector<APE::Color> out(ColorsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            for (std::size_t c = 0; c < ColorsCount; c++)
+                out[c] = APE::Color::FromHSV(APE::HSVColor(c * (300.0f / ColorsCount), 0.8f, 0.9f));
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "samples");
+    suite.Add("Gradient/Sample/1024Samples", [](std::size_t iterations) {
+        APE::Gradient gradient(APE::Gradient::SmallTableSize);
+        for (int stop = 0; stop <= 5; stop++)
+            gradient.AddStop(stop / 5.0f, APE::Color::FromHSV(APE::HSVColor(stop * 60.0f, 0.8f, 0.9f)));
+        std::vector<float> positions(ColorsCount);
+        for (std::size_t c = 0; c < ColorsCount; c++) positions[c] = (float)c / ColorsCount;
+        std::vector<APE::Color> out(ColorsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            gradient.SampleSpan(positions.data(), out.data(), ColorsCount);
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "samples");
+    suite.Add("Gradient/Bake/OKLab/1024Entries", [](std::size_t iterations) {
+        APE::Gradient gradient(APE::Gradient::LargeTableSize);
+        gradient.AddStop(0.0f, APE::KnownColor::Red);
+        gradient.AddStop(0.5f, APE::KnownColor::Yellow);
+        for (std::size_t i = 0; i < iterations; i++) {
+            gradient.AddStop(1.0f, APE::KnownColor::Blue);
+            DoNotOptimize(gradient.GetTable());
+            gradient.SetStops(gradient.GetStops().data(), 2);
+        }
+    }, 2 * APE::Gradient::LargeTableSize, "entries");
+
+    // Reducing colors to a 256 colors palette, with the lookup against every palette color and the grid cache.
+    static const APE::Palette palette = APE::Palette::Build(colors.data(), ColorsCount, APE::Palette::MaxColorsCount);
+    suite.Add("Palette/FindNearest/Naive/1024Colors", [](std::size_t iterations) {
+        std::vector<std::uint8_t> out(ColorsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            for (std::size_t c = 0; c < ColorsCount; c++) out[c] = NaiveFindNearest(palette, colors[c]);
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "colors");
+    suite.Add("Palette/FindNearest/1024Colors", [](std::size_t iterations) {
+        std::vector<std::uint8_t> out(ColorsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            for (std::size_t c = 0; c < ColorsCount; c++) out[c] = palette.FindNearest(colors[c]);
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "colors");
+    // An empty palette (no colors to build from) must be built and looked up safely, every color become 0.
+    suite.Add("Palette/FindNearest/EmptyPalette/1024Colors", [](std::size_t iterations) {
+        APE::Palette empty = APE::Palette::Build(colors.data(), 0, APE::Palette::MaxColorsCount);
+        std::vector<std::uint8_t> out(ColorsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            for (std::size_t c = 0; c < ColorsCount; c++) out[c] = empty.FindNearest(colors[c]);
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "colors");
+    suite.Add("Palette/Build/KMeans/1024Colors", [](std::size_t iterations) {
+        for (std::size_t i = 0; i < iterations; i++) {
+            APE::Palette built = APE::Palette::Build(colors.data(), ColorsCount, 16, APE::PaletteMethod::KMeans);
+            DoNotOptimize(built.GetColors());
+        }
+    }, ColorsCount, "colors");
+    suite.Add("Palette/Quantize/FloydSteinberg/1024Colors", [](std::size_t iterations) {
+        std::vector<std::uint8_t> out(ColorsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            palette.Quantize(colors.data(), APE::Size(32, 32), out.data(), APE::DitherMethod::FloydSteinberg);
+            DoNotOptimize(out.data());
+        }
+    }, ColorsCount, "colors");
+}
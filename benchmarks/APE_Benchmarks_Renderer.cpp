@@ -0,0 +1,217 @@
+#include "APE_Benchmark.h"
+
+#include "APE/APE_Renderer.h"
+#include "APE/SDL2/APE_SDL2_Renderer.h"
+#include "APE/SDL2/APE_SDL2_Window.h"
+#include "APE/Software/APE_Software_Renderer.h"
+
+#include <SDL2/SDL.h>
+#include <memory>
+#include <string>
+
+namespace {
+    const int OutputWidth = 512;
+    const int OutputHeight = 512;
+
+    // A quad covering the given area, with a different color per corner so the interpolation is measured.
+    void AppendQuad(APE::Sprite& sprite, double x, double y, double w, double h, std::uint8_t alpha) {
+        std::size_t first = sprite.VerticesCount();
+        sprite.AddVertex(APE::Vertex(APE::Vector2(x, y), APE::Color(255, 0, 0, alpha), APE::Vector2(0, 0)));
+        sprite.AddVertex(APE::Vertex(APE::Vector2(x + w, y), APE::Color(0, 255, 0, alpha), APE::Vector2(1, 0)));
+        sprite.AddVertex(APE::Vertex(APE::Vector2(x + w, y + h), APE::Color(0, 0, 255, alpha), APE::Vector2(1, 1)));
+        sprite.AddVertex(APE::Vertex(APE::Vector2(x, y + h), APE::Color(255, 255, 255, alpha), APE::Vector2(0, 1)));
+        sprite.AddTriangle(first, first + 1, first + 2);
+        sprite.AddTriangle(first, first + 2, first + 3);
+    }
+
+    // A 32x8 grid of 16x16 quads.
+    void BuildQuadsSprite(APE::Sprite& sprite, std::size_t quadsCount, double offset = 0) {
+        for (std::size_t i = 0; i < quadsCount; i++)
+            AppendQuad(sprite, offset + (double)(i % 32) * 16, offset + (double)(i / 32) * 16, 16, 16, 255);
+    }
+
+    const char* GetKernelName(APE::Software::SoftwareRasterKernel kernel) {
+        switch (kernel) {
+            case APE::Software::SoftwareRasterKernel::SSE2: return "SSE2";
+            case APE::Software::SoftwareRasterKernel::AVX2: return "AVX2";
+            default: return "Scalar";
+        }
+    }
+
+    const char* GetBlendModeName(APE::Software::SoftwareBlendMode mode) {
+        switch (mode) {
+            case APE::Software::SoftwareBlendMode::AlphaBlend: return "AlphaBlend";
+            case APE::Software::SoftwareBlendMode::Additive: return "Additive";
+            case APE::Software::SoftwareBlendMode::Modulate: return "Modulate";
+            case APE::Software::SoftwareBlendMode::Multiply: return "Multiply";
+            default: return "None";
+        }
+    }
+
+    // The SDL2 objects live until the program exit, since the benchmarks are run after being added.
+    struct SDL2Context {
+        std::unique_ptr<APE::SDL2::SDL2Window> Window;
+        std::unique_ptr<APE::SDL2::SDL2Renderer> Renderer;
+
+        ~SDL2Context() {
+            Renderer.reset();
+            Window.reset();
+            SDL_Quit();
+        }
+    };
+}
+
+void APE::Benchmarks::AddSoftwareRendererBenchmarks(BenchmarkSuite& suite) {
+    using APE::Software::SoftwareBlendMode;
+    using APE::Software::SoftwareRasterKernel;
+    using APE::Software::SoftwareRenderer;
+
+    const double pixels = (double)OutputWidth * OutputHeight;
+
+    // The fill rate of every raster kernel the CPU support, with the opaque and the blended paths.
+    const SoftwareRasterKernel kernels[] = { SoftwareRasterKernel::Scalar, SoftwareRasterKernel::SSE2, SoftwareRasterKernel::AVX2 };
+    const SoftwareBlendMode modes[] = { SoftwareBlendMode::None, SoftwareBlendMode::AlphaBlend, SoftwareBlendMode::Additive };
+    for (SoftwareRasterKernel kernel : kernels) {
+        if (!SoftwareRenderer::IsRasterKernelSupported(kernel)) continue;
+        for (SoftwareBlendMode mode : modes) {
+            std::string name = std::string("SoftwareRenderer/RenderSprite/FullScreen/") + GetKernelName(kernel) + "/" + GetBlendModeName(mode);
+            suite.Add(name, [=](std::size_t iterations) {
+                SoftwareRenderer renderer(APE::Size(OutputWidth, OutputHeight));
+                renderer.SetRasterKernel(kernel);
+                renderer.SetDrawBlendMode(mode);
+                APE::Sprite sprite;
+                AppendQuad(sprite, 0, 0, OutputWidth, OutputHeight, 128);
+                for (std::size_t i = 0; i < iterations; i++)
+                    renderer.RenderSprite(sprite);
+                DoNotOptimize(renderer.GetPixels());
+            }, pixels, "pixels");
+        }
+    }
+
+    suite.Add("SoftwareRenderer/FillRectangle/FullScreen/AlphaBlend", [=](std::size_t iterations) {
+        SoftwareRenderer renderer(APE::Size(OutputWidth, OutputHeight));
+        renderer.SetDrawBlendMode(SoftwareBlendMode::AlphaBlend);
+        renderer.SetDrawColor(APE::Color(40, 80, 160, 128));
+        for (std::size_t i = 0; i < iterations; i++)
+            renderer.FillRectangle(APE::Rectangle(0, 0, OutputWidth, OutputHeight));
+        DoNotOptimize(renderer.GetPixels());
+    }, pixels, "pixels");
+
+    suite.Add("SoftwareRenderer/FillCircle/Radius128", [](std::size_t iterations) {
+        SoftwareRenderer renderer(APE::Size(OutputWidth, OutputHeight));
+        renderer.SetDrawColor(APE::Color(40, 80, 160, 255));
+        for (std::size_t i = 0; i < iterations; i++)
+            renderer.FillCircle(APE::Point(OutputWidth / 2, OutputHeight / 2), 128);
+        DoNotOptimize(renderer.GetPixels());
+    });
+
+    // Many small sprites, immediate then tiled with increasing threads counts.
+    const std::size_t threadsCounts[] = { 0, 1, 2, 4, 8 };
+    for (std::size_t threadsCount : threadsCounts) {
+        std::string name = "SoftwareRenderer/RenderSprite/256Quads/" +
+            (threadsCount == 0 ? std::string("Immediate") : "Tiled" + std::to_string(threadsCount));
+        suite.Add(name, [=](std::size_t iterations) {
+            SoftwareRenderer renderer(APE::Size(OutputWidth, OutputHeight));
+            renderer.SetDrawBlendMode(SoftwareBlendMode::AlphaBlend);
+            if (threadsCount > 0) renderer.EnableTiledRasterization(threadsCount);
+            APE::Sprite sprite;
+            BuildQuadsSprite(sprite, 256);
+            for (std::size_t i = 0; i < iterations; i++) {
+                renderer.RenderSprite(sprite);
+                renderer.Flush();
+            }
+            DoNotOptimize(renderer.GetPixels());
+        }, 256 * 16 * 16, "pixels");
+    }
+}
+
+bool APE::Benchmarks::AddSDL2RendererBenchmarks(BenchmarkSuite& suite) {
+    // A hidden window on the dummy video driver (unless set by the user), with the SDL2 software renderer, so
+    // the benchmarks run the same on any machine, including headless ones.
+    SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+    SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+    if (SDL_Init(SDL_INIT_VIDEO) != 0) return false;
+
+    static SDL2Context context;
+    context.Window.reset(new APE::SDL2::SDL2Window());
+    context.Renderer.reset(new APE::SDL2::SDL2Renderer(context.Window.get()));
+    if (context.Renderer->GetOutputSize().IsEmptyArea()) {
+        context.Renderer.reset();
+        context.Window.reset();
+        return false;
+    }
+    APE::SDL2::SDL2Renderer* renderer = context.Renderer.get();
+
+    suite.Add("SDL2Renderer/RenderSprite/256Quads", [=](std::size_t iterations) {
+        APE::Sprite sprite;
+        BuildQuadsSprite(sprite, 256);
+        for (std::size_t i = 0; i < iterations; i++)
+            renderer->RenderSprite(sprite);
+        renderer->Flush();
+    }, 256 * 4, "vertices");
+
+    suite.Add("SDL2Renderer/RenderSprite/256Quads/RenderCache", [=](std::size_t iterations) {
+        APE::Sprite sprite;
+        sprite.EnableRenderCache();
+        BuildQuadsSprite(sprite, 256);
+        for (std::size_t i = 0; i < iterations; i++)
+            renderer->RenderSprite(sprite);
+        renderer->Flush();
+    }, 256 * 4, "vertices");
+
+    suite.Add("SDL2Renderer/RenderSprite/256Quads/Compact16", [=](std::size_t iterations) {
+        APE::Sprite sprite;
+        BuildQuadsSprite(sprite, 256);
+        APE::CompactSprite16 compact(sprite);
+        for (std::size_t i = 0; i < iterations; i++)
+            renderer->RenderSprite(compact);
+        renderer->Flush();
+    }, 256 * 4, "vertices");
+
+    suite.Add("SDL2Renderer/RenderSprite/64Sprites/Batched", [=](std::size_t iterations) {
+        std::vector<APE::Sprite> sprites(64);
+        for (std::size_t i = 0; i < sprites.size(); i++)
+            AppendQuad(sprites[i], (double)(i % 8) * 32, (double)(i / 8) * 32, 32, 32, 255);
+        renderer->EnableSpriteBatching();
+        for (std::size_t i = 0; i < iterations; i++) {
+            for (const APE::Sprite& sprite : sprites)
+                renderer->RenderSprite(sprite);
+            renderer->Flush();
+        }
+        renderer->DisableSpriteBatching();
+    }, 64, "sprites");
+
+    suite.Add("SDL2Renderer/RenderSprite/256Quads/Culled", [=](std::size_t iterations) {
+        APE::Sprite sprite;
+        BuildQuadsSprite(sprite, 256, -10000);
+        for (std::size_t i = 0; i < iterations; i++)
+            renderer->RenderSprite(sprite);
+        renderer->Flush();
+    }, 256 * 4, "vertices");
+
+    suite.Add("SDL2Renderer/FillRectangle/64Rects/Batched", [=](std::size_t iterations) {
+        renderer->EnablePrimitiveBatching();
+        renderer->SetDrawColor(APE::Color(40, 80, 160, 255));
+        for (std::size_t i = 0; i < iterations; i++) {
+            for (int r = 0; r < 64; r++)
+                renderer->FillRectangle(APE::Rectangle((r % 8) * 32, (r / 8) * 32, 24, 24));
+            renderer->Flush();
+        }
+        renderer->DisablePrimitiveBatching();
+    }, 64, "rectangles");
+
+    suite.Add("SDL2Renderer/FillCircle/Radius64", [=](std::size_t iterations) {
+        renderer->SetDrawColor(APE::Color(40, 80, 160, 255));
+        for (std::size_t i = 0; i < iterations; i++)
+            renderer->FillCircle(APE::Point(128, 128), 64);
+        renderer->Flush();
+    });
+
+    suite.Add("SDL2Renderer/ClearPresent", [=](std::size_t iterations) {
+        for (std::size_t i = 0; i < iterations; i++) {
+            renderer->Clear(APE::Color(0, 0, 0, 255));
+            renderer->Present();
+        }
+    });
+    return true;
+}
@@ -0,0 +1,206 @@
+#include "APE_Benchmark.h"
+
+#include "APE/APE_Color.h"
+#include "APE/APE_Renderer.h"
+#include "APE/APE_Structure.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+    // The inputs are generated once and read in a loop, so the compiler can't fold the measured operations.
+    const std::size_t InputsCount = 1024;
+
+    std::uint32_t NextRandom(std::uint32_t& state) {
+        state = state * 1664525u + 1013904223u;
+        return state >> 8;
+    }
+
+    std::vector<APE::Color> MakeColors() {
+        std::uint32_t state = 1;
+        std::vector<APE::Color> colors;
+        for (std::size_t i = 0; i < InputsCount; i++) {
+            std::uint32_t value = NextRandom(state);
+            colors.push_back(APE::Color(value & 0xFF, (value >> 8) & 0xFF, (value >> 16) & 0xFF, NextRandom(state) & 0xFF));
+        }
+        return colors;
+    }
+
+    std::vector<float> MakeFactors() {
+        std::uint32_t state = 2;
+        std::vector<float> factors;
+        for (std::size_t i = 0; i < InputsCount; i++)
+            factors.push_back((NextRandom(state) & 0xFFFF) / 65535.0f);
+        return factors;
+    }
+
+    std::vector<APE::Rectangle> MakeRectangles() {
+        std::uint32_t state = 3;
+        std::vector<APE::Rectangle> rectangles;
+        for (std::size_t i = 0; i < InputsCount; i++) {
+            int x = (int)(NextRandom(state) % 1024) - 512, y = (int)(NextRandom(state) % 1024) - 512;
+            int w = (int)(NextRandom(state) % 512) + 1, h = (int)(NextRandom(state) % 512) + 1;
+            rectangles.push_back(APE::Rectangle(x, y, w, h));
+        }
+        return rectangles;
+    }
+
+    std::vector<APE::Vector3> MakeVectors() {
+        std::uint32_t state = 4;
+        std::vector<APE::Vector3> vectors;
+        for (std::size_t i = 0; i < InputsCount; i++)
+            vectors.push_back(APE::Vector3(NextRandom(state) / 65536.0, NextRandom(state) / 65536.0, NextRandom(state) / 65536.0));
+        return vectors;
+    }
+
+    // A grid of quads, like a tile map or a text.
+    void BuildQuadsSprite(APE::Sprite& sprite, std::size_t quadsCount) {
+        sprite.Clear();
+        for (std::size_t i = 0; i < quadsCount; i++) {
+            double x = (double)(i % 32) * 16, y = (double)(i / 32) * 16;
+            std::size_t first = sprite.VerticesCount();
+            sprite.AddVertex(APE::Vertex(APE::Vector2(x, y), APE::KnownColor::White, APE::Vector2(0, 0)));
+            sprite.AddVertex(APE::Vertex(APE::Vector2(x + 16, y), APE::KnownColor::White, APE::Vector2(1, 0)));
+            sprite.AddVertex(APE::Vertex(APE::Vector2(x + 16, y + 16), APE::KnownColor::White, APE::Vector2(1, 1)));
+            sprite.AddVertex(APE::Vertex(APE::Vector2(x, y + 16), APE::KnownColor::White, APE::Vector2(0, 1)));
+            sprite.AddTriangle(first, first + 1, first + 2);
+            sprite.AddTriangle(first, first + 2, first + 3);
+        }
+    }
+}
+
+void APE::Benchmarks::AddStructureBenchmarks(BenchmarkSuite& suite) {
+    static const std::vector<APE::Color> colors = MakeColors();
+    static const std::vector<float> factors = MakeFactors();
+    static const std::vector<APE::Rectangle> rectangles = MakeRectangles();
+    static const std::vector<APE::Vector3> vectors = MakeVectors();
+    const std::size_t mask = InputsCount - 1;
+
+    suite.Add("Color/LerpTo", [=](std::size_t iterations) {
+        for (std::size_t i = 0; i < iterations; i++)
+            DoNotOptimize(colors[i & mask].LerpTo(colors[(i + 1) & mask], factors[i & mask]));
+    });
+    suite.Add("Color/From01", [=](std::size_t iterations) {
+        for (std::size_t i = 0; i < iterations; i++)
+            DoNotOptimize(APE::Color::From01(factors[i & mask], factors[(i + 1) & mask], factors[(i + 2) & mask], factors[(i + 3) & mask]));
+    });
+
+    // The span operations against the same work done one color at a time.
+    suite.Add("Color/LerpTo/1024Colors", [=](std::size_t iterations) {
+        std::vector<APE::Color> out(InputsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            float t = factors[i & mask];
+            for (std::size_t c = 0; c < InputsCount; c++)
+                out[c] = colors[c].LerpTo(colors[(c + 1) & mask], t);
+            DoNotOptimize(out.data());
+        }
+    }, InputsCount, "colors");
+    suite.Add("Color/LerpSpan/1024Colors", [=](std::size_t iterations) {
+        std::vector<APE::Color> shifted(InputsCount), out(InputsCount);
+        for (std::size_t c = 0; c < InputsCount; c++) shifted[c] = colors[(c + 1) & mask];
+        for (std::size_t i = 0; i < iterations; i++) {
+            APE::Color::LerpSpan(colors.data(), shifted.data(), factors[i & mask], out.data(), InputsCount);
+            DoNotOptimize(out.data());
+        }
+    }, InputsCount, "colors");
+    suite.Add("Color/Darken/1024Colors", [=](std::size_t iterations) {
+        std::vector<APE::Color> out(InputsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            float percent = factors[i & mask] * 100;
+            for (std::size_t c = 0; c < InputsCount; c++)
+                out[c] = colors[c].Darken(percent);
+            DoNotOptimize(out.data());
+        }
+    }, InputsCount, "colors");
+    suite.Add("Color/DarkenSpan/1024Colors", [=](std::size_t iterations) {
+        std::vector<APE::Color> out(InputsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            APE::Color::DarkenSpan(colors.data(), factors[i & mask] * 100, out.data(), InputsCount);
+            DoNotOptimize(out.data());
+        }
+    }, InputsCount, "colors");
+    suite.Add("Color/Premultiply/1024Colors", [=](std::size_t iterations) {
+        std::vector<APE::Color> out(InputsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            for (std::size_t c = 0; c < InputsCount; c++)
+                out[c] = colors[c].Premultiply();
+            DoNotOptimize(out.data());
+        }
+    }, InputsCount, "colors");
+    suite.Add("Color/PremultiplySpan/1024Colors", [=](std::size_t iterations) {
+        std::vector<APE::Color> out(InputsCount);
+        for (std::size_t i = 0; i < iterations; i++) {
+            APE::Color::PremultiplySpan(colors.data(), out.data(), InputsCount);
+            DoNotOptimize(out.data());
+        }
+    }, InputsCount, "colors");
+
+    suite.Add("KnownColor/TryParse", [](std::size_t iterations) {
+        const char* names[] = { "CornflowerBlue", "cornflowerblue", "Zomp", "NotAColor" };
+        APE::Color color;
+        for (std::size_t i = 0; i < iterations; i++)
+            DoNotOptimize(APE::KnownColor::TryParse(names[i & 3], color));
+        DoNotOptimize(color);
+    });
+    suite.Add("KnownColor/GetNearestName", [=](std::size_t iterations) {
+        for (std::size_t i = 0; i < iterations; i++)
+            DoNotOptimize(APE::KnownColor::GetNearestName(colors[i & mask]).data());
+    }, (double)APE::KnownColor::Count(), "colors");
+
+    suite.Add("Rectangle/Intersect", [=](std::size_t iterations) {
+        for (std::size_t i = 0; i < iterations; i++)
+            DoNotOptimize(APE::Rectangle::Intersect(rectangles[i & mask], rectangles[(i + 1) & mask]));
+    });
+    suite.Add("Rectangle/Union", [=](std::size_t iterations) {
+        for (std::size_t i = 0; i < iterations; i++)
+            DoNotOptimize(APE::Rectangle::Union(rectangles[i & mask], rectangles[(i + 1) & mask]));
+    });
+    suite.Add("Rectangle/LocalToGlobal", [=](std::size_t iterations) {
+        for (std::size_t i = 0; i < iterations; i++)
+            DoNotOptimize(rectangles[i & mask].LocalToGlobal(rectangles[(i + 1) & mask], (APE::RectangleAlignment)(i % 9)));
+    });
+
+    suite.Add("Vector2/Arithmetic", [=](std::size_t iterations) {
+        APE::Vector2 accumulator;
+        for (std::size_t i = 0; i < iterations; i++) {
+            APE::Vector2 a = vectors[i & mask], b = vectors[(i + 1) & mask];
+            accumulator += (a - b) * 0.5 + a;
+            DoNotOptimize(APE::Vector2::DotProduct(accumulator, b));
+        }
+        DoNotOptimize(accumulator);
+    });
+    suite.Add("Vector3/Arithmetic", [=](std::size_t iterations) {
+        APE::Vector3 accumulator;
+        for (std::size_t i = 0; i < iterations; i++) {
+            const APE::Vector3& a = vectors[i & mask];
+            const APE::Vector3& b = vectors[(i + 1) & mask];
+            accumulator += (a - b) * 0.5 + a * b;
+            DoNotOptimize(APE::Vector3::DotProduct(accumulator, b));
+        }
+        DoNotOptimize(accumulator);
+    });
+
+    // A new Sprite each time (allocations included), then a reused Sprite that keep its capacity.
+    suite.Add("Sprite/Construct/256Quads", [](std::size_t iterations) {
+        for (std::size_t i = 0; i < iterations; i++) {
+            APE::Sprite sprite;
+            BuildQuadsSprite(sprite, 256);
+            DoNotOptimize(sprite.GetVertices().data());
+        }
+    }, 256 * 4, "vertices");
+    suite.Add("Sprite/Rebuild/256Quads", [](std::size_t iterations) {
+        APE::Sprite sprite;
+        for (std::size_t i = 0; i < iterations; i++) {
+            BuildQuadsSprite(sprite, 256);
+            DoNotOptimize(sprite.GetVertices().data());
+        }
+    }, 256 * 4, "vertices");
+    suite.Add("Sprite/GetBounds/256Quads", [](std::size_t iterations) {
+        APE::Sprite sprite;
+        BuildQuadsSprite(sprite, 256);
+        for (std::size_t i = 0; i < iterations; i++) {
+            sprite.GetVertices()[i & 1023].Position.X += 0;
+            DoNotOptimize(sprite.GetBounds());
+        }
+    }, 256 * 4, "vertices");
+}
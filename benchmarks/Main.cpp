@@ -0,0 +1,77 @@
+#include "APE_Benchmark.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace {
+    void PrintUsage(const char* program) {
+        std::cout << "Usage: " << program << " [options]\n"
+                  << "  --filter=TEXT        Only run the benchmarks whose name contain TEXT.\n"
+                  << "  --warmup=N           The number of discarded samples (default 3).\n"
+                  << "  --repetitions=N      The number of measured samples (default 31).\n"
+                  << "  --min-sample-us=N    The minimum duration of a sample in microseconds (default 2000).\n"
+                  << "  --json[=PATH]        Write the results as JSON to PATH (or the standard output).\n"
+                  << "  --list               List the benchmarks and exit.\n";
+    }
+
+    bool ReadOption(const char* argument, const char* name, std::string& value) {
+        std::size_t length = std::strlen(name);
+        if (std::strncmp(argument, name, length) != 0 || argument[length] != '=') return false;
+        value = argument + length + 1;
+        return true;
+    }
+}
+
+int main(int argc, char** argv) {
+    APE::Benchmarks::BenchmarkOptions options;
+    bool json = false, list = false;
+    std::string jsonPath, value;
+
+    for (int i = 1; i < argc; i++) {
+        const char* argument = argv[i];
+        if (ReadOption(argument, "--filter", value)) options.Filter = value;
+        else if (ReadOption(argument, "--warmup", value)) options.Warmup = std::strtoul(value.c_str(), nullptr, 10);
+        else if (ReadOption(argument, "--repetitions", value)) options.Repetitions = std::strtoul(value.c_str(), nullptr, 10);
+        else if (ReadOption(argument, "--min-sample-us", value)) options.MinSampleMicroseconds = std::strtod(value.c_str(), nullptr);
+        else if (ReadOption(argument, "--json", value)) { json = true; jsonPath = value; }
+        else if (std::strcmp(argument, "--json") == 0) json = true;
+        else if (std::strcmp(argument, "--list") == 0) list = true;
+        else {
+            PrintUsage(argv[0]);
+            return std::strcmp(argument, "--help") == 0 ? 0 : 1;
+        }
+    }
+
+    APE::Benchmarks::BenchmarkSuite suite;
+    APE::Benchmarks::AddStructureBenchmarks(suite);
+    APE::Benchmarks::AddColorBenchmarks(suite);
+    APE::Benchmarks::AddSoftwareRendererBenchmarks(suite);
+    if (!APE::Benchmarks::AddSDL2RendererBenchmarks(suite))
+        std::cerr << "SDL2 could not be initialised, the SDL2 renderer benchmarks are skipped.\n";
+
+    if (list) {
+        for (const std::string& name : suite.GetNames(options.Filter))
+            std::cout << name << '\n';
+        return 0;
+    }
+
+    // With JSON on the standard output, the progress goes to the error output so the JSON stay parsable.
+    bool jsonToStdout = json && jsonPath.empty();
+    std::vector<APE::Benchmarks::BenchmarkResult> results = suite.Run(options, jsonToStdout ? &std::cerr : &std::cout);
+
+    if (json) {
+        if (jsonToStdout) APE::Benchmarks::WriteJSON(std::cout, results, options);
+        else {
+            std::ofstream file(jsonPath, std::ios::out | std::ios::trunc);
+            if (!file) {
+                std::cerr << "Could not write " << jsonPath << '\n';
+                return 1;
+            }
+            APE::Benchmarks::WriteJSON(file, results, options);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,104 @@
+#ifndef __APE_BLEND_H__
+#define __APE_BLEND_H__
+
+#include "APE_Color.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace APE {
+    /// @brief The Premultiplied Color class, a 32 bit RGBA color whose red, green and blue channels are already
+    /// multiplied by its alpha channel. Compositing it cost less per pixel, and filtering it doesn't bleed the
+    /// color of the transparent pixels into the edges (no dark or bright fringes).
+    class PremultipliedColor {
+    public:
+        /// @brief The Red channel multiplied by the alpha (from range [0->Alpha]).
+        uint8_t Red = 0;
+        /// @brief The Green channel multiplied by the alpha (from range [0->Alpha]).
+        uint8_t Green = 0;
+        /// @brief The Blue channel multiplied by the alpha (from range [0->Alpha]).
+        uint8_t Blue = 0;
+        /// @brief The Alpha channel (from range [0->255]).
+        uint8_t Alpha = 0;
+
+        /// @brief Create an empty (transparent) Premultiplied Color.
+        constexpr PremultipliedColor() = default;
+        /// @brief Create a new Premultiplied Color from channels already premultiplied.
+        /// @param r The premultiplied red channel value.
+        /// @param g The premultiplied green channel value.
+        /// @param b The premultiplied blue channel value.
+        /// @param a The alpha channel value.
+        constexpr PremultipliedColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a);
+        /// @brief Create a new Premultiplied Color from a Color, with the same result as Color::Premultiply().
+        /// @param color The Color to premultiply.
+        constexpr explicit PremultipliedColor(const Color& color);
+
+        constexpr bool operator==(const PremultipliedColor& c) const;
+        constexpr bool operator!=(const PremultipliedColor& c) const;
+
+        /// @brief Convert back to a Color, by dividing the red, green and blue channels by the alpha (rounded).
+        /// @return The Color, or Color::Empty if the alpha is 0.
+        Color ToColor() const;
+
+        /// @brief Premultiply a span of colors, using the SSE2 or AVX2 kernels if the CPU support them.
+        /// @param colors The colors to premultiply.
+        /// @param out The premultiplied colors.
+        /// @param count The number of colors.
+        static void FromColors(const Color* colors, PremultipliedColor* out, std::size_t count);
+        /// @brief Convert a span of premultiplied colors back to Color, with the same result as ToColor() for each color.
+        /// @param colors The premultiplied colors to convert.
+        /// @param out The colors.
+        /// @param count The number of colors.
+        static void ToColors(const PremultipliedColor* colors, Color* out, std::size_t count);
+    };
+
+    /// @brief The Blend static class, composite premultiplied colors into spans of pixels, with the SSE2 or AVX2
+    /// kernels if the CPU support them. There is a kernel per SDL2DrawBlendMode (and SoftwareBlendMode), each
+    /// give the same result as its blend mode for the straight alpha color (the formulas use the premultiplied
+    /// source s, and its alpha sa):
+    /// - Over (AlphaBlend): dst.rgb = s.rgb + dst.rgb * (1 - sa), dst.a = sa + dst.a * (1 - sa).
+    /// - Add (Additive): dst.rgb = s.rgb + dst.rgb, dst.a = dst.a.
+    /// - Modulate: dst.rgb = s.rgb * dst.rgb, dst.a = dst.a.
+    /// - Multiply: dst.rgb = s.rgb * dst.rgb + dst.rgb * (1 - sa), dst.a = dst.a.
+    /// @note Modulate and Multiply match their blend mode only for opaque sources: for translucent sources they
+    /// are what SDL2 compute when drawing a premultiplied texture, the coverage of the source is respected.
+    class Blend final {
+    public:
+        /// @brief Composite the source colors over the destination colors (AlphaBlend).
+        /// @param src The premultiplied source colors, one per destination color.
+        /// @param dst The destination colors, updated with the result.
+        /// @param count The number of colors.
+        static void Over(const PremultipliedColor* src, Color* dst, std::size_t count);
+        /// @brief Composite a single source color over the destination colors (AlphaBlend).
+        static void Over(const PremultipliedColor& src, Color* dst, std::size_t count);
+        /// @brief Add the source colors to the destination colors, saturated (Additive).
+        static void Add(const PremultipliedColor* src, Color* dst, std::size_t count);
+        /// @brief Add a single source color to the destination colors, saturated (Additive).
+        static void Add(const PremultipliedColor& src, Color* dst, std::size_t count);
+        /// @brief Modulate the destination colors by the source colors (Modulate).
+        static void Modulate(const PremultipliedColor* src, Color* dst, std::size_t count);
+        /// @brief Modulate the destination colors by a single source color (Modulate).
+        static void Modulate(const PremultipliedColor& src, Color* dst, std::size_t count);
+        /// @brief Multiply the destination colors by the source colors, weighted by their coverage (Multiply).
+        static void Multiply(const PremultipliedColor* src, Color* dst, std::size_t count);
+        /// @brief Multiply the destination colors by a single source color, weighted by its coverage (Multiply).
+        static void Multiply(const PremultipliedColor& src, Color* dst, std::size_t count);
+    };
+}
+
+constexpr APE::PremultipliedColor::PremultipliedColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a) : Red(r), Green(g), Blue(b), Alpha(a) {}
+// x * a / 255 rounded exactly, as in Color::Premultiply().
+constexpr APE::PremultipliedColor::PremultipliedColor(const APE::Color& color)
+    : Red(static_cast<uint8_t>(((color.Red * color.Alpha + 128) + ((color.Red * color.Alpha + 128) >> 8)) >> 8)),
+      Green(static_cast<uint8_t>(((color.Green * color.Alpha + 128) + ((color.Green * color.Alpha + 128) >> 8)) >> 8)),
+      Blue(static_cast<uint8_t>(((color.Blue * color.Alpha + 128) + ((color.Blue * color.Alpha + 128) >> 8)) >> 8)),
+      Alpha(color.Alpha) {}
+
+constexpr bool APE::PremultipliedColor::operator==(const APE::PremultipliedColor& c) const {
+    return Red == c.Red && Green == c.Green && Blue == c.Blue && Alpha == c.Alpha;
+}
+constexpr bool APE::PremultipliedColor::operator!=(const APE::PremultipliedColor& c) const {
+    return Red != c.Red || Green != c.Green || Blue != c.Blue || Alpha != c.Alpha;
+}
+
+#endif // __APE_BLEND_H__
@@ -4,8 +4,77 @@
 #include "APE_Define.h"
 
 #include <SDL2/SDL_render.h>
+#include <cstddef>
+#include <string_view>
 
 namespace APE {
+    /// @brief The HSV Color class, a color as its hue, saturation and value (see Color::ToHSV()).
+    class HSVColor {
+    public:
+        /// @brief The Hue of the color, in degrees (from range [0->360)).
+        float Hue = 0.0f;
+        /// @brief The Saturation of the color (from range [0->1]).
+        float Saturation = 0.0f;
+        /// @brief The Value (brightness) of the color (from range [0->1]).
+        float Value = 0.0f;
+        /// @brief The Alpha channel of the color (from range [0->1]).
+        float Alpha = 0.0f;
+
+        /// @brief Create an empty HSV Color with all value are set to 0.
+        constexpr HSVColor() = default;
+        /// @brief Create a new HSV Color.
+        /// @param h The hue, in degrees (any value, wrapped to [0->360)).
+        /// @param s The saturation, in range [0->1].
+        /// @param v The value, in range [0->1].
+        /// @param a The alpha channel value, in range [0->1].
+        constexpr HSVColor(float h, float s, float v, float a = 1.0f) : Hue(h), Saturation(s), Value(v), Alpha(a) {}
+    };
+
+    /// @brief The HSL Color class, a color as its hue, saturation and lightness (see Color::ToHSL()).
+    class HSLColor {
+    public:
+        /// @brief The Hue of the color, in degrees (from range [0->360)).
+        float Hue = 0.0f;
+        /// @brief The Saturation of the color (from range [0->1]).
+        float Saturation = 0.0f;
+        /// @brief The Lightness of the color (from range [0->1]).
+        float Lightness = 0.0f;
+        /// @brief The Alpha channel of the color (from range [0->1]).
+        float Alpha = 0.0f;
+
+        /// @brief Create an empty HSL Color with all value are set to 0.
+        constexpr HSLColor() = default;
+        /// @brief Create a new HSL Color.
+        /// @param h The hue, in degrees (any value, wrapped to [0->360)).
+        /// @param s The saturation, in range [0->1].
+        /// @param l The lightness, in range [0->1].
+        /// @param a The alpha channel value, in range [0->1].
+        constexpr HSLColor(float h, float s, float l, float a = 1.0f) : Hue(h), Saturation(s), Lightness(l), Alpha(a) {}
+    };
+
+    /// @brief The OKLab Color class, a color in the OKLab perceptual color space: the same distance between two
+    /// colors look like the same difference, so interpolating in it give even gradients (see Color::ToOKLab()).
+    class OKLabColor {
+    public:
+        /// @brief The perceived Lightness of the color (from range [0->1]).
+        float Lightness = 0.0f;
+        /// @brief The green (negative) to red (positive) axis, about in range [-0.4->0.4].
+        float A = 0.0f;
+        /// @brief The blue (negative) to yellow (positive) axis, about in range [-0.4->0.4].
+        float B = 0.0f;
+        /// @brief The Alpha channel of the color (from range [0->1]).
+        float Alpha = 0.0f;
+
+        /// @brief Create an empty OKLab Color with all value are set to 0.
+        constexpr OKLabColor() = default;
+        /// @brief Create a new OKLab Color.
+        /// @param l The lightness, in range [0->1].
+        /// @param a The green to red axis value.
+        /// @param b The blue to yellow axis value.
+        /// @param alpha The alpha channel value, in range [0->1].
+        constexpr OKLabColor(float l, float a, float b, float alpha = 1.0f) : Lightness(l), A(a), B(b), Alpha(alpha) {}
+    };
+
     /// @brief The Color class, represent a 32 bit RGBA color.
     class Color {
     public:
@@ -19,50 +88,48 @@ namespace APE {
         uint8_t Alpha = 0;
 
         /// @brief Create an empty Color with all channel value are set to 0.
-        Color();
+        constexpr Color() = default;
         /// @brief Create a new Color with all channel value are the same.
         /// @param rgba The value for all channel of the color.
-        Color(uint8_t rgba);
+        constexpr Color(uint8_t rgba);
         /// @brief Create a new Color with the red, green, blue channel are the same, and with specific
         /// alpha channel.
         /// @param rgb The value for the red, green and blue channel.
         /// @param a The alpha channel value.
-        Color(uint8_t rgb, uint8_t a);
+        constexpr Color(uint8_t rgb, uint8_t a);
         /// @brief Create a new Color with specific red, green and blue channel (The alpha channel are set
         /// to 255).
         /// @param r The red channel value.
         /// @param g The green channel value.
         /// @param b The blue channel value.
-        Color(uint8_t r, uint8_t g, uint8_t b);
+        constexpr Color(uint8_t r, uint8_t g, uint8_t b);
         /// @brief Create a new Color with specific red, green, blue and alpha channel value.
         /// @param r The red channel value.
         /// @param g The green channel value.
         /// @param b The blue channel value.
         /// @param a The alpha channel value.
-        Color(uint8_t r, uint8_t g, uint8_t b, uint8_t a);
+        constexpr Color(uint8_t r, uint8_t g, uint8_t b, uint8_t a);
         /// @brief Create a new Color from the given Color red, green and blue channel value, and the
         /// given alpha channel value.
         /// @param c The Color to get the red, green and blue channel value from.
         /// @param a The alpha channel value.
-        Color(const Color& c, uint8_t a);
-
-        Color(const Color& c);
+        constexpr Color(const Color& c, uint8_t a);
 
-        Color& operator=(uint8_t rgba);
-        Color& operator=(const Color& c);
+        constexpr Color& operator=(uint8_t rgba);
 
-        bool operator==(uint8_t rgba) const;
-        bool operator==(const Color& c) const;
-        bool operator!=(uint8_t rgba) const;
-        bool operator!=(const Color& c) const;
+        constexpr bool operator==(uint8_t rgba) const;
+        constexpr bool operator==(const Color& c) const;
+        constexpr bool operator!=(uint8_t rgba) const;
+        constexpr bool operator!=(const Color& c) const;
 
         /// @brief Convert the color to an unsigned 32 bit integer. The color value was stored in the given order:
         /// Red (bit 25->32), Green (bit 17->24), Blue (bit 9->16), Alpha (bit 1->8).
         /// @return The result of the convertion.
-        uint32_t ToUint32() const;
+        constexpr uint32_t ToUint32() const;
 		/// @brief Linear interpolation from this color to the given color.
 		/// @param target The end color of the interpolation.
-		/// @param t The interpolation value, in range [0->1] (if out of range will clamped it).
+		/// @param t The interpolation value, in range [0->1] (if out of range will clamped it). It's quantized
+		/// to 1/256 steps, so the result is the same as LerpSpan().
 		/// @return The result of the interpolation.
 		Color LerpTo(const Color& target, float t) const;
 		/// @brief Lighten the color by the given percentage (similar to lerp
@@ -75,6 +142,10 @@ namespace APE {
 		/// @param percent The darken percentage, in range [0->100] (if out of range will clamped it).
 		/// @return The result of the darken operation.
 		Color Darken(float percent) const;
+		/// @brief Multiply the red, green and blue channels by the alpha channel (exactly rounded), to get the
+		/// premultiplied alpha form of the color.
+		/// @return The premultiplied color.
+		Color Premultiply() const;
 
 		/// @brief Linear interpolation between two color.
 		/// @param a The start color of the interpolation.
@@ -90,13 +161,105 @@ namespace APE {
 		/// @return The new created Color.
 		static Color From01(float r, float g, float b, float a);
 
+		/// @brief Linear interpolation between two spans of colors, with the same result as LerpTo() for each
+		/// color but using the SSE2 or AVX2 kernels if the CPU support them.
+		/// @param a The start colors of the interpolation.
+		/// @param b The end colors of the interpolation.
+		/// @param t The interpolation value, in range [0->1] (if out of range will clamped it).
+		/// @param out The result colors, can be the same as a or b.
+		/// @param count The number of colors.
+		static void LerpSpan(const Color* a, const Color* b, float t, Color* out, std::size_t count);
+		/// @brief Linear interpolation from a span of colors to a single color, with the same result as
+		/// LerpTo() for each color.
+		/// @param colors The start colors of the interpolation.
+		/// @param target The end color of the interpolation.
+		/// @param t The interpolation value, in range [0->1] (if out of range will clamped it).
+		/// @param out The result colors, can be the same as colors.
+		/// @param count The number of colors.
+		static void LerpSpan(const Color* colors, const Color& target, float t, Color* out, std::size_t count);
+		/// @brief Lighten a span of colors, with the same result as Lighten() for each color.
+		/// @param colors The colors to lighten.
+		/// @param percent The lighten percentage, in range [0->100] (if out of range will clamped it).
+		/// @param out The result colors, can be the same as colors.
+		/// @param count The number of colors.
+		static void LightenSpan(const Color* colors, float percent, Color* out, std::size_t count);
+		/// @brief Darken a span of colors, with the same result as Darken() for each color.
+		/// @param colors The colors to darken.
+		/// @param percent The darken percentage, in range [0->100] (if out of range will clamped it).
+		/// @param out The result colors, can be the same as colors.
+		/// @param count The number of colors.
+		static void DarkenSpan(const Color* colors, float percent, Color* out, std::size_t count);
+		/// @brief Premultiply a span of colors, with the same result as Premultiply() for each color.
+		/// @param colors The colors to premultiply.
+		/// @param out The result colors, can be the same as colors.
+		/// @param count The number of colors.
+		static void PremultiplySpan(const Color* colors, Color* out, std::size_t count);
+
+		/// @brief Convert the color to HSV (hue, saturation, value).
+		/// @return The HSV color, the hue of the grays is 0.
+		HSVColor ToHSV() const;
+		/// @brief Convert the color to HSL (hue, saturation, lightness).
+		/// @return The HSL color, the hue of the grays is 0.
+		HSLColor ToHSL() const;
+		/// @brief Convert the color to OKLab, the sRGB transfer function is removed with the ColorSpace tables.
+		/// @return The OKLab color.
+		OKLabColor ToOKLab() const;
+		/// @brief Create a new Color from an HSV color.
+		/// @param color The HSV color, the saturation, value and alpha are clamped to [0->1].
+		/// @return The new created Color.
+		static Color FromHSV(const HSVColor& color);
+		/// @brief Create a new Color from an HSL color.
+		/// @param color The HSL color, the saturation, lightness and alpha are clamped to [0->1].
+		/// @return The new created Color.
+		static Color FromHSL(const HSLColor& color);
+		/// @brief Create a new Color from an OKLab color, the colors out of the sRGB gamut are clamped.
+		/// @param color The OKLab color.
+		/// @return The new created Color.
+		static Color FromOKLab(const OKLabColor& color);
+
+		/// @brief Convert a span of colors to HSV, with the same result as ToHSV() for each color but using the
+		/// SSE2 kernels if the CPU support them.
+		/// @param colors The colors to convert.
+		/// @param out The HSV colors.
+		/// @param count The number of colors.
+		static void ToHSVSpan(const Color* colors, HSVColor* out, std::size_t count);
+		/// @brief Convert a span of colors to HSL, with the same result as ToHSL() for each color.
+		static void ToHSLSpan(const Color* colors, HSLColor* out, std::size_t count);
+		/// @brief Convert a span of colors to OKLab, with the same result as ToOKLab() for each color.
+		static void ToOKLabSpan(const Color* colors, OKLabColor* out, std::size_t count);
+		/// @brief Convert a span of HSV colors to Color, with the same result as FromHSV() for each color.
+		/// @param colors The HSV colors to convert.
+		/// @param out The colors.
+		/// @param count The number of colors.
+		static void FromHSVSpan(const HSVColor* colors, Color* out, std::size_t count);
+		/// @brief Convert a span of HSL colors to Color, with the same result as FromHSL() for each color.
+		static void FromHSLSpan(const HSLColor* colors, Color* out, std::size_t count);
+		/// @brief Convert a span of OKLab colors to Color, with the same result as FromOKLab() for each color.
+		static void FromOKLabSpan(const OKLabColor* colors, Color* out, std::size_t count);
+
 		/// @brief The Empty Color with all channel are set to 0.
 		static const Color Empty;
-	};;
+	};
 
     /// @brief The Known Color static class, contain the known color.
     class KnownColor final {
     public:
+		/// @brief Get the known color with the given name, the name is case-insensitive (e.g. "CornflowerBlue"
+		/// or "cornflowerblue"). The lookup use a perfect hash built at compile time and doesn't allocate.
+		/// @param name The name of the known color.
+		/// @param color The Color to set to the known color if found (unchanged otherwise).
+		/// @return true if the name is a known color, false otherwise.
+		static bool TryParse(std::string_view name, Color& color);
+		/// @brief Get the name of the known color nearest to the given color, by euclidean distance of the
+		/// red, green and blue channels (the alpha channel is ignored). If several known colors have the same
+		/// value, the first declared is returned.
+		/// @param color The color to look for.
+		/// @return The name of the nearest known color.
+		static std::string_view GetNearestName(const Color& color);
+		/// @brief Get the number of known colors.
+		/// @return The number of known colors.
+		static std::size_t Count();
+
 		/// @brief The Absolute Zero color, RGB value are 0, 72, 186.
 		static const Color AbsoluteZero;
 		/// @brief The Acid Green color, RGB value are 176, 191, 26.
@@ -1875,4 +2038,923 @@ namespace APE {
 		static const Color Zomp;
     };
 }
+
+constexpr APE::Color::Color(uint8_t rgba) : Red(rgba), Green(rgba), Blue(rgba), Alpha(rgba) {}
+constexpr APE::Color::Color(uint8_t rgb, uint8_t a) : Red(rgb), Green(rgb), Blue(rgb), Alpha(a) {}
+constexpr APE::Color::Color(uint8_t r, uint8_t g, uint8_t b) : Red(r), Green(g), Blue(b), Alpha(255) {}
+constexpr APE::Color::Color(uint8_t r, uint8_t g, uint8_t b, uint8_t a) : Red(r), Green(g), Blue(b), Alpha(a) {}
+constexpr APE::Color::Color(const APE::Color& c, uint8_t a) : Red(c.Red), Green(c.Green), Blue(c.Blue), Alpha(a) {}
+
+constexpr APE::Color& APE::Color::operator=(uint8_t rgba) {
+    Red = rgba; Green = rgba; Blue = rgba; Alpha = rgba; return *this;
+}
+
+constexpr bool APE::Color::operator==(uint8_t rgba) const {
+    return Red == rgba && Green == rgba && Blue == rgba && Alpha == rgba;
+}
+constexpr bool APE::Color::operator==(const APE::Color& c) const {
+    return Red == c.Red && Green == c.Green && Blue == c.Blue && Alpha == c.Alpha;
+}
+constexpr bool APE::Color::operator!=(uint8_t rgba) const {
+    return Red != rgba || Green != rgba || Blue != rgba || Alpha != rgba;
+}
+constexpr bool APE::Color::operator!=(const APE::Color& c) const {
+    return Red != c.Red || Green != c.Green || Blue != c.Blue || Alpha != c.Alpha;
+}
+
+constexpr uint32_t APE::Color::ToUint32() const {
+    return ((uint32_t)Red << 24) + ((uint32_t)Green << 16) + ((uint32_t)Blue << 8) + (uint32_t)Alpha;
+}
+
+inline constexpr APE::Color APE::Color::Empty = APE::Color(0, 0, 0, 0);
+
+inline constexpr APE::Color APE::KnownColor::AbsoluteZero = APE::Color(0x00, 0x48, 0xBA, 0xFF);
+inline constexpr APE::Color APE::KnownColor::AcidGreen = APE::Color(0xB0, 0xBF, 0x1A, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Aero = APE::Color(0x7C, 0xB9, 0xE8, 0xFF);
+inline constexpr APE::Color APE::KnownColor::AfricanViolet = APE::Color(0xB2, 0x84, 0xBE, 0xFF);
+inline constexpr APE::Color APE::KnownColor::AirSuperiorityBlue = APE::Color(0x72, 0xA0, 0xC1, 0xFF);
+inline constexpr APE::Color APE::KnownColor::AliceBlue = APE::Color(0xF0, 0xF8, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Alizarin = APE::Color(0xDB, 0x2D, 0x43, 0xFF);
+inline constexpr APE::Color APE::KnownColor::AlloyOrange = APE::Color(0xC4, 0x62, 0x10, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Almond = APE::Color(0xEF, 0xDE, 0xCD, 0xFF);
+inline constexpr APE::Color APE::KnownColor::AmaranthDeepPurple = APE::Color(0x9F, 0x2B, 0x68, 0xFF);
+inline constexpr APE::Color APE::KnownColor::AmaranthPink = APE::Color(0xF1, 0x9C, 0xBB, 0xFF);
+inline constexpr APE::Color APE::KnownColor::AmaranthPurple = APE::Color(0xAB, 0x27, 0x4F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Amazon = APE::Color(0x3B, 0x7A, 0x57, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Amber = APE::Color(0xFF, 0xBF, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Amethyst = APE::Color(0x99, 0x66, 0xCC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::AndroidGreen = APE::Color(0x3D, 0xDC, 0x84, 0xFF);
+inline constexpr APE::Color APE::KnownColor::AntiqueBrass = APE::Color(0xCD, 0x95, 0x75, 0xFF);
+inline constexpr APE::Color APE::KnownColor::AntiqueBronze = APE::Color(0x66, 0x5D, 0x1E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::AntiqueFuchsia = APE::Color(0x91, 0x5C, 0x83, 0xFF);
+inline constexpr APE::Color APE::KnownColor::AntiqueRuby = APE::Color(0x84, 0x1B, 0x2D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::AntiqueWhite = APE::Color(0xFA, 0xEB, 0xD7, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Apricot = APE::Color(0xFB, 0xCE, 0xB1, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Aqua = APE::Color(0x00, 0xFF, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Aquamarine = APE::Color(0x7F, 0xFF, 0xD4, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ArcticLime = APE::Color(0xD0, 0xFF, 0x14, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ArtichokeGreen = APE::Color(0x4B, 0x6F, 0x44, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ArylideYellow = APE::Color(0xE9, 0xD6, 0x6B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::AshGray = APE::Color(0xB2, 0xBE, 0xB5, 0xFF);
+inline constexpr APE::Color APE::KnownColor::AtomicTangerine = APE::Color(0xFF, 0x99, 0x66, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Aureolin = APE::Color(0xFD, 0xEE, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Azure = APE::Color(0x00, 0x7F, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::AzureX11WebColor = APE::Color(0xF0, 0xFF, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BabyBlue = APE::Color(0x89, 0xCF, 0xF0, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BabyBlueEyes = APE::Color(0xA1, 0xCA, 0xF1, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BabyPink = APE::Color(0xF4, 0xC2, 0xC2, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BabyPowder = APE::Color(0xFE, 0xFE, 0xFA, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BakerMillerPink = APE::Color(0xFF, 0x91, 0xAF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BananaMania = APE::Color(0xFA, 0xE7, 0xB5, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BarbiePink = APE::Color(0xDA, 0x18, 0x84, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BarnRed = APE::Color(0x7C, 0x0A, 0x02, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BattleshipGrey = APE::Color(0x84, 0x84, 0x82, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BeauBlue = APE::Color(0xBC, 0xD4, 0xE6, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Beaver = APE::Color(0x9F, 0x81, 0x70, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Beige = APE::Color(0xF5, 0xF5, 0xDC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BDazzledBlue = APE::Color(0x2E, 0x58, 0x94, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BigDipORuby = APE::Color(0x9C, 0x25, 0x42, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Bisque = APE::Color(0xFF, 0xE4, 0xC4, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Bistre = APE::Color(0x3D, 0x2B, 0x1F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BistreBrown = APE::Color(0x96, 0x71, 0x17, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BitterLemon = APE::Color(0xCA, 0xE0, 0x0D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Black = APE::Color(0x00, 0x00, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BlackBean = APE::Color(0x3D, 0x0C, 0x02, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BlackCoral = APE::Color(0x54, 0x62, 0x6F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BlackOlive = APE::Color(0x3B, 0x3C, 0x36, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BlackShadows = APE::Color(0xBF, 0xAF, 0xB2, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BlanchedAlmond = APE::Color(0xFF, 0xEB, 0xCD, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BlastOffBronze = APE::Color(0xA5, 0x71, 0x64, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BleuDeFrance = APE::Color(0x31, 0x8C, 0xE7, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BlizzardBlue = APE::Color(0xAC, 0xE5, 0xEE, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BloodRed = APE::Color(0x66, 0x00, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Blue = APE::Color(0x00, 0x00, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BlueCrayola = APE::Color(0x1F, 0x75, 0xFE, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BlueMunsell = APE::Color(0x00, 0x93, 0xAF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BlueNcs = APE::Color(0x00, 0x87, 0xBD, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BluePantone = APE::Color(0x00, 0x18, 0xA8, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BluePigment = APE::Color(0x33, 0x33, 0x99, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BlueBell = APE::Color(0xA2, 0xA2, 0xD0, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BlueGrayCrayola = APE::Color(0x66, 0x99, 0xCC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BlueJeans = APE::Color(0x5D, 0xAD, 0xEC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BlueSapphire = APE::Color(0x12, 0x61, 0x80, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BlueViolet = APE::Color(0x8A, 0x2B, 0xE2, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BlueYonder = APE::Color(0x50, 0x72, 0xA7, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Bluetiful = APE::Color(0x3C, 0x69, 0xE7, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Blush = APE::Color(0xDE, 0x5D, 0x83, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Bole = APE::Color(0x79, 0x44, 0x3B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Bone = APE::Color(0xE3, 0xDA, 0xC9, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BrickRed = APE::Color(0xCB, 0x41, 0x54, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BrightLilac = APE::Color(0xD8, 0x91, 0xEF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BrightYellowCrayola = APE::Color(0xFF, 0xAA, 0x1D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Bronze = APE::Color(0xCD, 0x7F, 0x32, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Brown = APE::Color(0x88, 0x54, 0x0B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BrownSugar = APE::Color(0xAF, 0x6E, 0x4D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BudGreen = APE::Color(0x7B, 0xB6, 0x61, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Buff = APE::Color(0xFF, 0xC6, 0x80, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Burgundy = APE::Color(0x80, 0x00, 0x20, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Burlywood = APE::Color(0xDE, 0xB8, 0x87, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BurnishedBrown = APE::Color(0xA1, 0x7A, 0x74, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BurntOrange = APE::Color(0xCC, 0x55, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BurntSienna = APE::Color(0xE9, 0x74, 0x51, 0xFF);
+inline constexpr APE::Color APE::KnownColor::BurntUmber = APE::Color(0x8A, 0x33, 0x24, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Byzantine = APE::Color(0xBD, 0x33, 0xA4, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Byzantium = APE::Color(0x70, 0x29, 0x63, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CadetBlue = APE::Color(0x5F, 0x9E, 0xA0, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CadetGrey = APE::Color(0x91, 0xA3, 0xB0, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CadmiumGreen = APE::Color(0x00, 0x6B, 0x3C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CadmiumOrange = APE::Color(0xED, 0x87, 0x2D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CafeAuLait = APE::Color(0xA6, 0x7B, 0x5B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CafeNoir = APE::Color(0x4B, 0x36, 0x21, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CambridgeBlue = APE::Color(0xA3, 0xC1, 0xAD, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Camel = APE::Color(0xC1, 0x9A, 0x6B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CameoPink = APE::Color(0xEF, 0xBB, 0xCC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Canary = APE::Color(0xFF, 0xFF, 0x99, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CanaryYellow = APE::Color(0xFF, 0xEF, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CandyPink = APE::Color(0xE4, 0x71, 0x7A, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Cardinal = APE::Color(0xC4, 0x1E, 0x3A, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CaribbeanGreen = APE::Color(0x00, 0xCC, 0x99, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Carmine = APE::Color(0x96, 0x00, 0x18, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CarmineMP = APE::Color(0xD7, 0x00, 0x40, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CarnationPink = APE::Color(0xFF, 0xA6, 0xC9, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Carnelian = APE::Color(0xB3, 0x1B, 0x1B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CarolinaBlue = APE::Color(0x56, 0xA0, 0xD3, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CarrotOrange = APE::Color(0xED, 0x91, 0x21, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Catawba = APE::Color(0x70, 0x36, 0x42, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CedarChest = APE::Color(0xC9, 0x5A, 0x49, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Celadon = APE::Color(0xAC, 0xE1, 0xAF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Celeste = APE::Color(0xB2, 0xFF, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Cerise = APE::Color(0xDE, 0x31, 0x63, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Cerulean = APE::Color(0x00, 0x7B, 0xA7, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CeruleanBlue = APE::Color(0x2A, 0x52, 0xBE, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CeruleanFrost = APE::Color(0x6D, 0x9B, 0xC3, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CeruleanCrayola = APE::Color(0x1D, 0xAC, 0xD6, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CeruleanRgb = APE::Color(0x00, 0x40, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Champagne = APE::Color(0xF7, 0xE7, 0xCE, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ChampagnePink = APE::Color(0xF1, 0xDD, 0xCF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Charcoal = APE::Color(0x36, 0x45, 0x4F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CharmPink = APE::Color(0xE6, 0x8F, 0xAC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ChartreuseWeb = APE::Color(0x80, 0xFF, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CherryBlossomPink = APE::Color(0xFF, 0xB7, 0xC5, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Chestnut = APE::Color(0x95, 0x45, 0x35, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ChiliRed = APE::Color(0xE2, 0x3D, 0x28, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ChinaPink = APE::Color(0xDE, 0x6F, 0xA1, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ChineseRed = APE::Color(0xAA, 0x38, 0x1E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ChineseViolet = APE::Color(0x85, 0x60, 0x88, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ChineseYellow = APE::Color(0xFF, 0xB2, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ChocolateTraditional = APE::Color(0x7B, 0x3F, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ChocolateWeb = APE::Color(0xD2, 0x69, 0x1E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Cinereous = APE::Color(0x98, 0x81, 0x7B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Cinnabar = APE::Color(0xE3, 0x42, 0x34, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CinnamonSatin = APE::Color(0xCD, 0x60, 0x7E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Citrine = APE::Color(0xE4, 0xD0, 0x0A, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Citron = APE::Color(0x9F, 0xA9, 0x1F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Claret = APE::Color(0x7F, 0x17, 0x34, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Coffee = APE::Color(0x6F, 0x4E, 0x37, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ColumbiaBlue = APE::Color(0xB9, 0xD9, 0xEB, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CongoPink = APE::Color(0xF8, 0x83, 0x79, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CoolGrey = APE::Color(0x8C, 0x92, 0xAC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Copper = APE::Color(0xB8, 0x73, 0x33, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CopperCrayola = APE::Color(0xDA, 0x8A, 0x67, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CopperPenny = APE::Color(0xAD, 0x6F, 0x69, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CopperRed = APE::Color(0xCB, 0x6D, 0x51, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CopperRose = APE::Color(0x99, 0x66, 0x66, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Coquelicot = APE::Color(0xFF, 0x38, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Coral = APE::Color(0xFF, 0x7F, 0x50, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CoralPink = APE::Color(0xF8, 0x83, 0x79, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Cordovan = APE::Color(0x89, 0x3F, 0x45, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Corn = APE::Color(0xFB, 0xEC, 0x5D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CornflowerBlue = APE::Color(0x64, 0x95, 0xED, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Cornsilk = APE::Color(0xFF, 0xF8, 0xDC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CosmicCobalt = APE::Color(0x2E, 0x2D, 0x88, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CosmicLatte = APE::Color(0xFF, 0xF8, 0xE7, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CoyoteBrown = APE::Color(0x81, 0x61, 0x3C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CottonCandy = APE::Color(0xFF, 0xBC, 0xD9, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Cream = APE::Color(0xFF, 0xFD, 0xD0, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Crimson = APE::Color(0xDC, 0x14, 0x3C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CrimsonUa = APE::Color(0x9E, 0x1B, 0x32, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CulturedPearl = APE::Color(0xF5, 0xF5, 0xF5, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Cyan = APE::Color(0x00, 0xFF, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CyanProcess = APE::Color(0x00, 0xB7, 0xEB, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CyberGrape = APE::Color(0x58, 0x42, 0x7C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::CyberYellow = APE::Color(0xFF, 0xD3, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Cyclamen = APE::Color(0xF5, 0x6F, 0xA1, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Dandelion = APE::Color(0xFE, 0xD8, 0x5D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DarkBrown = APE::Color(0x65, 0x43, 0x21, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DarkByzantium = APE::Color(0x5D, 0x39, 0x54, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DarkCyan = APE::Color(0x00, 0x8B, 0x8B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DarkElectricBlue = APE::Color(0x53, 0x68, 0x78, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DarkGoldenrod = APE::Color(0xB8, 0x86, 0x0B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DarkGreenX11 = APE::Color(0x00, 0x64, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DarkJungleGreen = APE::Color(0x1A, 0x24, 0x21, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DarkKhaki = APE::Color(0xBD, 0xB7, 0x6B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DarkLava = APE::Color(0x48, 0x3C, 0x32, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DarkLiverHorses = APE::Color(0x54, 0x3D, 0x37, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DarkMagenta = APE::Color(0x8B, 0x00, 0x8B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DarkOliveGreen = APE::Color(0x55, 0x6B, 0x2F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DarkOrange = APE::Color(0xFF, 0x8C, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DarkOrchid = APE::Color(0x99, 0x32, 0xCC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DarkPurple = APE::Color(0x30, 0x19, 0x34, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DarkRed = APE::Color(0x8B, 0x00, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DarkSalmon = APE::Color(0xE9, 0x96, 0x7A, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DarkSeaGreen = APE::Color(0x8F, 0xBC, 0x8F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DarkSienna = APE::Color(0x3C, 0x14, 0x14, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DarkSkyBlue = APE::Color(0x8C, 0xBE, 0xD6, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DarkSlateBlue = APE::Color(0x48, 0x3D, 0x8B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DarkSlateGray = APE::Color(0x2F, 0x4F, 0x4F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DarkSpringGreen = APE::Color(0x17, 0x72, 0x45, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DarkTurquoise = APE::Color(0x00, 0xCE, 0xD1, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DarkViolet = APE::Color(0x94, 0x00, 0xD3, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DavySGrey = APE::Color(0x55, 0x55, 0x55, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DeepCerise = APE::Color(0xDA, 0x32, 0x87, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DeepChampagne = APE::Color(0xFA, 0xD6, 0xA5, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DeepChestnut = APE::Color(0xB9, 0x4E, 0x48, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DeepJungleGreen = APE::Color(0x00, 0x4B, 0x49, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DeepPink = APE::Color(0xFF, 0x14, 0x93, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DeepSaffron = APE::Color(0xFF, 0x99, 0x33, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DeepSkyBlue = APE::Color(0x00, 0xBF, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DeepSpaceSparkle = APE::Color(0x4A, 0x64, 0x6C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DeepTaupe = APE::Color(0x7E, 0x5E, 0x60, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Denim = APE::Color(0x15, 0x60, 0xBD, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DenimBlue = APE::Color(0x22, 0x43, 0xB6, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Desert = APE::Color(0xC1, 0x9A, 0x6B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DesertSand = APE::Color(0xED, 0xC9, 0xAF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DimGray = APE::Color(0x69, 0x69, 0x69, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DodgerBlue = APE::Color(0x1E, 0x90, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DrabDarkBrown = APE::Color(0x4A, 0x41, 0x2A, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DukeBlue = APE::Color(0x00, 0x00, 0x9C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::DutchWhite = APE::Color(0xEF, 0xDF, 0xBB, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Ebony = APE::Color(0x55, 0x5D, 0x50, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Ecru = APE::Color(0xC2, 0xB2, 0x80, 0xFF);
+inline constexpr APE::Color APE::KnownColor::EerieBlack = APE::Color(0x1B, 0x1B, 0x1B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Eggplant = APE::Color(0x61, 0x40, 0x51, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Eggshell = APE::Color(0xF0, 0xEA, 0xD6, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ElectricLime = APE::Color(0xCC, 0xFF, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ElectricPurple = APE::Color(0xBF, 0x00, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ElectricViolet = APE::Color(0x8F, 0x00, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Emerald = APE::Color(0x50, 0xC8, 0x78, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Eminence = APE::Color(0x6C, 0x30, 0x82, 0xFF);
+inline constexpr APE::Color APE::KnownColor::EnglishLavender = APE::Color(0xB4, 0x83, 0x95, 0xFF);
+inline constexpr APE::Color APE::KnownColor::EnglishRed = APE::Color(0xAB, 0x4B, 0x52, 0xFF);
+inline constexpr APE::Color APE::KnownColor::EnglishVermillion = APE::Color(0xCC, 0x47, 0x4B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::EnglishViolet = APE::Color(0x56, 0x3C, 0x5C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Erin = APE::Color(0x00, 0xFF, 0x40, 0xFF);
+inline constexpr APE::Color APE::KnownColor::EtonBlue = APE::Color(0x96, 0xC8, 0xA2, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Fallow = APE::Color(0xC1, 0x9A, 0x6B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::FaluRed = APE::Color(0x80, 0x18, 0x18, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Fandango = APE::Color(0xB5, 0x33, 0x89, 0xFF);
+inline constexpr APE::Color APE::KnownColor::FandangoPink = APE::Color(0xDE, 0x52, 0x85, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Fawn = APE::Color(0xE5, 0xAA, 0x70, 0xFF);
+inline constexpr APE::Color APE::KnownColor::FernGreen = APE::Color(0x4F, 0x79, 0x42, 0xFF);
+inline constexpr APE::Color APE::KnownColor::FieldDrab = APE::Color(0x6C, 0x54, 0x1E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::FieryRose = APE::Color(0xFF, 0x54, 0x70, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Finn = APE::Color(0x68, 0x30, 0x68, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Firebrick = APE::Color(0xB2, 0x22, 0x22, 0xFF);
+inline constexpr APE::Color APE::KnownColor::FireEngineRed = APE::Color(0xCE, 0x20, 0x29, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Flame = APE::Color(0xE2, 0x58, 0x22, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Flax = APE::Color(0xEE, 0xDC, 0x82, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Flirt = APE::Color(0xA2, 0x00, 0x6D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::FloralWhite = APE::Color(0xFF, 0xFA, 0xF0, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ForestGreenWeb = APE::Color(0x22, 0x8B, 0x22, 0xFF);
+inline constexpr APE::Color APE::KnownColor::FrenchBeige = APE::Color(0xA6, 0x7B, 0x5B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::FrenchBistre = APE::Color(0x85, 0x6D, 0x4D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::FrenchBlue = APE::Color(0x00, 0x72, 0xBB, 0xFF);
+inline constexpr APE::Color APE::KnownColor::FrenchFuchsia = APE::Color(0xFD, 0x3F, 0x92, 0xFF);
+inline constexpr APE::Color APE::KnownColor::FrenchLilac = APE::Color(0x86, 0x60, 0x8E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::FrenchLime = APE::Color(0x9E, 0xFD, 0x38, 0xFF);
+inline constexpr APE::Color APE::KnownColor::FrenchMauve = APE::Color(0xD4, 0x73, 0xD4, 0xFF);
+inline constexpr APE::Color APE::KnownColor::FrenchPink = APE::Color(0xFD, 0x6C, 0x9E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::FrenchRaspberry = APE::Color(0xC7, 0x2C, 0x48, 0xFF);
+inline constexpr APE::Color APE::KnownColor::FrenchSkyBlue = APE::Color(0x77, 0xB5, 0xFE, 0xFF);
+inline constexpr APE::Color APE::KnownColor::FrenchViolet = APE::Color(0x88, 0x06, 0xCE, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Frostbite = APE::Color(0xE9, 0x36, 0xA7, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Fuchsia = APE::Color(0xFF, 0x00, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::FuchsiaCrayola = APE::Color(0xC1, 0x54, 0xC1, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Fulvous = APE::Color(0xE4, 0x84, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::FuzzyWuzzy = APE::Color(0x87, 0x42, 0x1F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Gainsboro = APE::Color(0xDC, 0xDC, 0xDC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Gamboge = APE::Color(0xE4, 0x9B, 0x0F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::GenericViridian = APE::Color(0x00, 0x7F, 0x66, 0xFF);
+inline constexpr APE::Color APE::KnownColor::GhostWhite = APE::Color(0xF8, 0xF8, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Glaucous = APE::Color(0x60, 0x82, 0xB6, 0xFF);
+inline constexpr APE::Color APE::KnownColor::GlossyGrape = APE::Color(0xAB, 0x92, 0xB3, 0xFF);
+inline constexpr APE::Color APE::KnownColor::GoGreen = APE::Color(0x00, 0xAB, 0x66, 0xFF);
+inline constexpr APE::Color APE::KnownColor::GoldMetallic = APE::Color(0xD4, 0xAF, 0x37, 0xFF);
+inline constexpr APE::Color APE::KnownColor::GoldWebGolden = APE::Color(0xFF, 0xD7, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::GoldCrayola = APE::Color(0xE6, 0xBE, 0x8A, 0xFF);
+inline constexpr APE::Color APE::KnownColor::GoldFusion = APE::Color(0x85, 0x75, 0x4E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::GoldenBrown = APE::Color(0x99, 0x65, 0x15, 0xFF);
+inline constexpr APE::Color APE::KnownColor::GoldenPoppy = APE::Color(0xFC, 0xC2, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::GoldenYellow = APE::Color(0xFF, 0xDF, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Goldenrod = APE::Color(0xDA, 0xA5, 0x20, 0xFF);
+inline constexpr APE::Color APE::KnownColor::GothamGreen = APE::Color(0x00, 0x57, 0x3F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::GraniteGray = APE::Color(0x67, 0x67, 0x67, 0xFF);
+inline constexpr APE::Color APE::KnownColor::GrannySmithApple = APE::Color(0xA8, 0xE4, 0xA0, 0xFF);
+inline constexpr APE::Color APE::KnownColor::GrayWeb = APE::Color(0x80, 0x80, 0x80, 0xFF);
+inline constexpr APE::Color APE::KnownColor::GrayX11Gray = APE::Color(0xBE, 0xBE, 0xBE, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Green = APE::Color(0x00, 0xFF, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::GreenCrayola = APE::Color(0x1C, 0xAC, 0x78, 0xFF);
+inline constexpr APE::Color APE::KnownColor::GreenWeb = APE::Color(0x00, 0x80, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::GreenMunsell = APE::Color(0x00, 0xA8, 0x77, 0xFF);
+inline constexpr APE::Color APE::KnownColor::GreenNcs = APE::Color(0x00, 0x9F, 0x6B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::GreenPantone = APE::Color(0x00, 0xAD, 0x43, 0xFF);
+inline constexpr APE::Color APE::KnownColor::GreenPigment = APE::Color(0x00, 0xA5, 0x50, 0xFF);
+inline constexpr APE::Color APE::KnownColor::GreenBlue = APE::Color(0x11, 0x64, 0xB4, 0xFF);
+inline constexpr APE::Color APE::KnownColor::GreenLizard = APE::Color(0xA7, 0xF4, 0x32, 0xFF);
+inline constexpr APE::Color APE::KnownColor::GreenSheen = APE::Color(0x6E, 0xAE, 0xA1, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Gunmetal = APE::Color(0x2a, 0x34, 0x39, 0xFF);
+inline constexpr APE::Color APE::KnownColor::HansaYellow = APE::Color(0xE9, 0xD6, 0x6B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Harlequin = APE::Color(0x3F, 0xFF, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::HarvestGold = APE::Color(0xDA, 0x91, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::HeatWave = APE::Color(0xFF, 0x7A, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Heliotrope = APE::Color(0xDF, 0x73, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::HeliotropeGray = APE::Color(0xAA, 0x98, 0xA9, 0xFF);
+inline constexpr APE::Color APE::KnownColor::HollywoodCerise = APE::Color(0xF4, 0x00, 0xA1, 0xFF);
+inline constexpr APE::Color APE::KnownColor::HonoluluBlue = APE::Color(0x00, 0x6D, 0xB0, 0xFF);
+inline constexpr APE::Color APE::KnownColor::HookerSGreen = APE::Color(0x49, 0x79, 0x6B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::HotMagenta = APE::Color(0xFF, 0x1D, 0xCE, 0xFF);
+inline constexpr APE::Color APE::KnownColor::HotPink = APE::Color(0xFF, 0x69, 0xB4, 0xFF);
+inline constexpr APE::Color APE::KnownColor::HunterGreen = APE::Color(0x35, 0x5E, 0x3B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Iceberg = APE::Color(0x71, 0xA6, 0xD2, 0xFF);
+inline constexpr APE::Color APE::KnownColor::IlluminatingEmerald = APE::Color(0x31, 0x91, 0x77, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ImperialRed = APE::Color(0xED, 0x29, 0x39, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Inchworm = APE::Color(0xB2, 0xEC, 0x5D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Independence = APE::Color(0x4C, 0x51, 0x6D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::IndiaGreen = APE::Color(0x13, 0x88, 0x08, 0xFF);
+inline constexpr APE::Color APE::KnownColor::IndianRed = APE::Color(0xCD, 0x5C, 0x5C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::IndianYellow = APE::Color(0xE3, 0xA8, 0x57, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Indigo = APE::Color(0x4B, 0x00, 0x82, 0xFF);
+inline constexpr APE::Color APE::KnownColor::IndigoDye = APE::Color(0x00, 0x41, 0x6A, 0xFF);
+inline constexpr APE::Color APE::KnownColor::InternationalKleinBlue = APE::Color(0x13, 0x0a, 0x8f, 0xFF);
+inline constexpr APE::Color APE::KnownColor::InternationalOrangeEngineering = APE::Color(0xBA, 0x16, 0x0C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::InternationalOrangeGoldenGateBridge = APE::Color(0xC0, 0x36, 0x2C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Irresistible = APE::Color(0xB3, 0x44, 0x6C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Isabelline = APE::Color(0xF4, 0xF0, 0xEC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ItalianSkyBlue = APE::Color(0xB2, 0xFF, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Ivory = APE::Color(0xFF, 0xFF, 0xF0, 0xFF);
+inline constexpr APE::Color APE::KnownColor::JapaneseCarmine = APE::Color(0x9D, 0x29, 0x33, 0xFF);
+inline constexpr APE::Color APE::KnownColor::JapaneseViolet = APE::Color(0x5B, 0x32, 0x56, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Jasmine = APE::Color(0xF8, 0xDE, 0x7E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::JazzberryJam = APE::Color(0xA5, 0x0B, 0x5E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Jet = APE::Color(0x34, 0x34, 0x34, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Jonquil = APE::Color(0xF4, 0xCA, 0x16, 0xFF);
+inline constexpr APE::Color APE::KnownColor::JuneBud = APE::Color(0xBD, 0xDA, 0x57, 0xFF);
+inline constexpr APE::Color APE::KnownColor::JungleGreen = APE::Color(0x29, 0xAB, 0x87, 0xFF);
+inline constexpr APE::Color APE::KnownColor::KellyGreen = APE::Color(0x4C, 0xBB, 0x17, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Keppel = APE::Color(0x3A, 0xB0, 0x9E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::KeyLime = APE::Color(0xE8, 0xF4, 0x8C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::KhakiWeb = APE::Color(0xC3, 0xB0, 0x91, 0xFF);
+inline constexpr APE::Color APE::KnownColor::KhakiX11LightKhaki = APE::Color(0xF0, 0xE6, 0x8C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Kobe = APE::Color(0x88, 0x2D, 0x17, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Kobi = APE::Color(0xE7, 0x9F, 0xC4, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Kobicha = APE::Color(0x6B, 0x44, 0x23, 0xFF);
+inline constexpr APE::Color APE::KnownColor::KsuPurple = APE::Color(0x51, 0x28, 0x88, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LanguidLavender = APE::Color(0xD6, 0xCA, 0xDD, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LapisLazuli = APE::Color(0x26, 0x61, 0x9C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LaserLemon = APE::Color(0xFF, 0xFF, 0x66, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LaurelGreen = APE::Color(0xA9, 0xBA, 0x9D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Lava = APE::Color(0xCF, 0x10, 0x20, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LavenderFloral = APE::Color(0xB5, 0x7E, 0xDC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LavenderWeb = APE::Color(0xE6, 0xE6, 0xFA, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LavenderBlue = APE::Color(0xCC, 0xCC, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LavenderBlush = APE::Color(0xFF, 0xF0, 0xF5, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LavenderGray = APE::Color(0xC4, 0xC3, 0xD0, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LawnGreen = APE::Color(0x7C, 0xFC, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Lemon = APE::Color(0xFF, 0xF7, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LemonChiffon = APE::Color(0xFF, 0xFA, 0xCD, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LemonCurry = APE::Color(0xCC, 0xA0, 0x1D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LemonGlacier = APE::Color(0xFD, 0xFF, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LemonMeringue = APE::Color(0xF6, 0xEA, 0xBE, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LemonYellow = APE::Color(0xFF, 0xF4, 0x4F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LemonYellowCrayola = APE::Color(0xFF, 0xFF, 0x9F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Liberty = APE::Color(0x54, 0x5A, 0xA7, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LightBlue = APE::Color(0xAD, 0xD8, 0xE6, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LightCoral = APE::Color(0xF0, 0x80, 0x80, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LightCornflowerBlue = APE::Color(0x93, 0xCC, 0xEA, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LightCyan = APE::Color(0xE0, 0xFF, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LightFrenchBeige = APE::Color(0xC8, 0xAD, 0x7F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LightGoldenrodYellow = APE::Color(0xFA, 0xFA, 0xD2, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LightGray = APE::Color(0xD3, 0xD3, 0xD3, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LightGreen = APE::Color(0x90, 0xEE, 0x90, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LightOrange = APE::Color(0xFE, 0xD8, 0xB1, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LightPeriwinkle = APE::Color(0xC5, 0xCB, 0xE1, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LightPink = APE::Color(0xFF, 0xB6, 0xC1, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LightSalmon = APE::Color(0xFF, 0xA0, 0x7A, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LightSeaGreen = APE::Color(0x20, 0xB2, 0xAA, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LightSkyBlue = APE::Color(0x87, 0xCE, 0xFA, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LightSlateGray = APE::Color(0x77, 0x88, 0x99, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LightSteelBlue = APE::Color(0xB0, 0xC4, 0xDE, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LightYellow = APE::Color(0xFF, 0xFF, 0xE0, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Lilac = APE::Color(0xC8, 0xA2, 0xC8, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LilacLuster = APE::Color(0xAE, 0x98, 0xAA, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LimeColorWheel = APE::Color(0xBF, 0xFF, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LimeWebX11Green = APE::Color(0x00, 0xFF, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LimeGreen = APE::Color(0x32, 0xCD, 0x32, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LincolnGreen = APE::Color(0x19, 0x59, 0x05, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Linen = APE::Color(0xFA, 0xF0, 0xE6, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Lion = APE::Color(0xDE, 0xCC, 0x9C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LiseranPurple = APE::Color(0xDE, 0x6F, 0xA1, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LittleBoyBlue = APE::Color(0x6C, 0xA0, 0xDC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Liver = APE::Color(0x67, 0x4C, 0x47, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LiverDogs = APE::Color(0xB8, 0x6D, 0x29, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LiverOrgan = APE::Color(0x6C, 0x2E, 0x1F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::LiverChestnut = APE::Color(0x98, 0x74, 0x56, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Livid = APE::Color(0x66, 0x99, 0xCC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MacaroniAndCheese = APE::Color(0xFF, 0xBD, 0x88, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MadderLake = APE::Color(0xCC, 0x33, 0x36, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Magenta = APE::Color(0xFF, 0x00, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MagentaCrayola = APE::Color(0xF6, 0x53, 0xA6, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MagentaDye = APE::Color(0xCA, 0x1F, 0x7B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MagentaPantone = APE::Color(0xD0, 0x41, 0x7E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MagentaProcess = APE::Color(0xFF, 0x00, 0x90, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MagentaHaze = APE::Color(0x9F, 0x45, 0x76, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MagicMint = APE::Color(0xAA, 0xF0, 0xD1, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Magnolia = APE::Color(0xF2, 0xE8, 0xD7, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Mahogany = APE::Color(0xC0, 0x40, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Maize = APE::Color(0xFB, 0xEC, 0x5D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MaizeCrayola = APE::Color(0xF2, 0xC6, 0x49, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MajorelleBlue = APE::Color(0x60, 0x50, 0xDC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Malachite = APE::Color(0x0B, 0xDA, 0x51, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Manatee = APE::Color(0x97, 0x9A, 0xAA, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Mandarin = APE::Color(0xF3, 0x7A, 0x48, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Mango = APE::Color(0xFD, 0xBE, 0x02, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MangoTango = APE::Color(0xFF, 0x82, 0x43, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Mantis = APE::Color(0x74, 0xC3, 0x65, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MardiGras = APE::Color(0x88, 0x00, 0x85, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Marigold = APE::Color(0xEA, 0xA2, 0x21, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MaroonCrayola = APE::Color(0xC3, 0x21, 0x48, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MaroonWeb = APE::Color(0x80, 0x00, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MaroonX11 = APE::Color(0xB0, 0x30, 0x60, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Mauve = APE::Color(0xE0, 0xB0, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MauveTaupe = APE::Color(0x91, 0x5F, 0x6D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Mauvelous = APE::Color(0xEF, 0x98, 0xAA, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MaximumBlue = APE::Color(0x47, 0xAB, 0xCC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MaximumBlueGreen = APE::Color(0x30, 0xBF, 0xBF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MaximumBluePurple = APE::Color(0xAC, 0xAC, 0xE6, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MaximumGreen = APE::Color(0x5E, 0x8C, 0x31, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MaximumGreenYellow = APE::Color(0xD9, 0xE6, 0x50, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MaximumPurple = APE::Color(0x73, 0x33, 0x80, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MaximumRed = APE::Color(0xD9, 0x21, 0x21, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MaximumRedPurple = APE::Color(0xA6, 0x3A, 0x79, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MaximumYellow = APE::Color(0xFA, 0xFA, 0x37, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MaximumYellowRed = APE::Color(0xF2, 0xBA, 0x49, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MayGreen = APE::Color(0x4C, 0x91, 0x41, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MayaBlue = APE::Color(0x73, 0xC2, 0xFB, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MediumAquamarine = APE::Color(0x66, 0xDD, 0xAA, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MediumBlue = APE::Color(0x00, 0x00, 0xCD, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MediumCandyAppleRed = APE::Color(0xE2, 0x06, 0x2C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MediumCarmine = APE::Color(0xAF, 0x40, 0x35, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MediumChampagne = APE::Color(0xF3, 0xE5, 0xAB, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MediumOrchid = APE::Color(0xBA, 0x55, 0xD3, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MediumPurple = APE::Color(0x93, 0x70, 0xDB, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MediumSeaGreen = APE::Color(0x3C, 0xB3, 0x71, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MediumSlateBlue = APE::Color(0x7B, 0x68, 0xEE, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MediumSpringGreen = APE::Color(0x00, 0xFA, 0x9A, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MediumTurquoise = APE::Color(0x48, 0xD1, 0xCC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MediumVioletRed = APE::Color(0xC7, 0x15, 0x85, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MellowApricot = APE::Color(0xF8, 0xB8, 0x78, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MellowYellow = APE::Color(0xF8, 0xDE, 0x7E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Melon = APE::Color(0xFE, 0xBA, 0xAD, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MetallicGold = APE::Color(0xD3, 0xAF, 0x37, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MetallicSeaweed = APE::Color(0x0A, 0x7E, 0x8C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MetallicSunburst = APE::Color(0x9C, 0x7C, 0x38, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MexicanPink = APE::Color(0xE4, 0x00, 0x7C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MiddleBlue = APE::Color(0x7E, 0xD4, 0xE6, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MiddleBlueGreen = APE::Color(0x8D, 0xD9, 0xCC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MiddleBluePurple = APE::Color(0x8B, 0x72, 0xBE, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MiddleGrey = APE::Color(0x8B, 0x86, 0x80, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MiddleGreen = APE::Color(0x4D, 0x8C, 0x57, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MiddleGreenYellow = APE::Color(0xAC, 0xBF, 0x60, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MiddlePurple = APE::Color(0xD9, 0x82, 0xB5, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MiddleRed = APE::Color(0xE5, 0x8E, 0x73, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MiddleRedPurple = APE::Color(0xA5, 0x53, 0x53, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MiddleYellow = APE::Color(0xFF, 0xEB, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MiddleYellowRed = APE::Color(0xEC, 0xB1, 0x76, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Midnight = APE::Color(0x70, 0x26, 0x70, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MidnightBlue = APE::Color(0x19, 0x19, 0x70, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MidnightGreenEagleGreen = APE::Color(0x00, 0x49, 0x53, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MikadoYellow = APE::Color(0xFF, 0xC4, 0x0C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MimiPink = APE::Color(0xFF, 0xDA, 0xE9, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Mindaro = APE::Color(0xE3, 0xF9, 0x88, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Ming = APE::Color(0x36, 0x74, 0x7D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MinionYellow = APE::Color(0xF5, 0xE0, 0x50, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Mint = APE::Color(0x3E, 0xB4, 0x89, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MintCream = APE::Color(0xF5, 0xFF, 0xFA, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MintGreen = APE::Color(0x98, 0xFF, 0x98, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MistyMoss = APE::Color(0xBB, 0xB4, 0x77, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MistyRose = APE::Color(0xFF, 0xE4, 0xE1, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ModeBeige = APE::Color(0x96, 0x71, 0x17, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MonaLisa = APE::Color(0xFF, 0x94, 0x8E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MorningBlue = APE::Color(0x8D, 0xA3, 0x99, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MossGreen = APE::Color(0x8A, 0x9A, 0x5B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MountainMeadow = APE::Color(0x30, 0xBA, 0x8F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MountbattenPink = APE::Color(0x99, 0x7A, 0x8D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MsuGreen = APE::Color(0x18, 0x45, 0x3B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Mulberry = APE::Color(0xC5, 0x4B, 0x8C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MulberryCrayola = APE::Color(0xC8, 0x50, 0x9B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Mustard = APE::Color(0xFF, 0xDB, 0x58, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MyrtleGreen = APE::Color(0x31, 0x78, 0x73, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Mystic = APE::Color(0xD6, 0x52, 0x82, 0xFF);
+inline constexpr APE::Color APE::KnownColor::MysticMaroon = APE::Color(0xAD, 0x43, 0x79, 0xFF);
+inline constexpr APE::Color APE::KnownColor::NadeshikoPink = APE::Color(0xF6, 0xAD, 0xC6, 0xFF);
+inline constexpr APE::Color APE::KnownColor::NaplesYellow = APE::Color(0xFA, 0xDA, 0x5E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::NavajoWhite = APE::Color(0xFF, 0xDE, 0xAD, 0xFF);
+inline constexpr APE::Color APE::KnownColor::NavyBlue = APE::Color(0x00, 0x00, 0x80, 0xFF);
+inline constexpr APE::Color APE::KnownColor::NavyBlueCrayola = APE::Color(0x19, 0x74, 0xD2, 0xFF);
+inline constexpr APE::Color APE::KnownColor::NeonBlue = APE::Color(0x46, 0x66, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::NeonGreen = APE::Color(0x39, 0xFF, 0x14, 0xFF);
+inline constexpr APE::Color APE::KnownColor::NeonFuchsia = APE::Color(0xFE, 0x41, 0x64, 0xFF);
+inline constexpr APE::Color APE::KnownColor::NewCar = APE::Color(0x21, 0x4F, 0xC6, 0xFF);
+inline constexpr APE::Color APE::KnownColor::NewYorkPink = APE::Color(0xD7, 0x83, 0x7F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Nickel = APE::Color(0x72, 0x74, 0x72, 0xFF);
+inline constexpr APE::Color APE::KnownColor::NonPhotoBlue = APE::Color(0xA4, 0xDD, 0xED, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Nyanza = APE::Color(0xE9, 0xFF, 0xDB, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Ochre = APE::Color(0xCC, 0x77, 0x22, 0xFF);
+inline constexpr APE::Color APE::KnownColor::OldBurgundy = APE::Color(0x43, 0x30, 0x2E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::OldGold = APE::Color(0xCF, 0xB5, 0x3B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::OldLace = APE::Color(0xFD, 0xF5, 0xE6, 0xFF);
+inline constexpr APE::Color APE::KnownColor::OldLavender = APE::Color(0x79, 0x68, 0x78, 0xFF);
+inline constexpr APE::Color APE::KnownColor::OldMauve = APE::Color(0x67, 0x31, 0x47, 0xFF);
+inline constexpr APE::Color APE::KnownColor::OldRose = APE::Color(0xC0, 0x80, 0x81, 0xFF);
+inline constexpr APE::Color APE::KnownColor::OldSilver = APE::Color(0x84, 0x84, 0x82, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Olive = APE::Color(0x80, 0x80, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::OliveDrab3 = APE::Color(0x6B, 0x8E, 0x23, 0xFF);
+inline constexpr APE::Color APE::KnownColor::OliveDrab7 = APE::Color(0x3C, 0x34, 0x1F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::OliveGreen = APE::Color(0xB5, 0xB3, 0x5C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Olivine = APE::Color(0x9A, 0xB9, 0x73, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Onyx = APE::Color(0x35, 0x38, 0x39, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Opal = APE::Color(0xA8, 0xC3, 0xBC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::OperaMauve = APE::Color(0xB7, 0x84, 0xA7, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Orange = APE::Color(0xFF, 0x7F, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::OrangeCrayola = APE::Color(0xFF, 0x75, 0x38, 0xFF);
+inline constexpr APE::Color APE::KnownColor::OrangePantone = APE::Color(0xFF, 0x58, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::OrangeWeb = APE::Color(0xFF, 0xA5, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::OrangePeel = APE::Color(0xFF, 0x9F, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::OrangeRed = APE::Color(0xFF, 0x68, 0x1F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::OrangeRedCrayola = APE::Color(0xFF, 0x53, 0x49, 0xFF);
+inline constexpr APE::Color APE::KnownColor::OrangeSoda = APE::Color(0xFA, 0x5B, 0x3D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::OrangeYellow = APE::Color(0xF5, 0xBD, 0x1F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::OrangeYellowCrayola = APE::Color(0xF8, 0xD5, 0x68, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Orchid = APE::Color(0xDA, 0x70, 0xD6, 0xFF);
+inline constexpr APE::Color APE::KnownColor::OrchidPink = APE::Color(0xF2, 0xBD, 0xCD, 0xFF);
+inline constexpr APE::Color APE::KnownColor::OrchidCrayola = APE::Color(0xE2, 0x9C, 0xD2, 0xFF);
+inline constexpr APE::Color APE::KnownColor::OuterSpaceCrayola = APE::Color(0x2D, 0x38, 0x3A, 0xFF);
+inline constexpr APE::Color APE::KnownColor::OutrageousOrange = APE::Color(0xFF, 0x6E, 0x4A, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Oxblood = APE::Color(0x4A, 0x00, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::OxfordBlue = APE::Color(0x00, 0x21, 0x47, 0xFF);
+inline constexpr APE::Color APE::KnownColor::OuCrimsonRed = APE::Color(0x84, 0x16, 0x17, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PacificBlue = APE::Color(0x1C, 0xA9, 0xC9, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PakistanGreen = APE::Color(0x00, 0x66, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PalatinatePurple = APE::Color(0x68, 0x28, 0x60, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PaleAqua = APE::Color(0xBE, 0xD3, 0xE5, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PaleCerulean = APE::Color(0x9B, 0xC4, 0xE2, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PaleDogwood = APE::Color(0xED, 0x7A, 0x9B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PalePink = APE::Color(0xFA, 0xDA, 0xDD, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PalePurplePantone = APE::Color(0xFA, 0xE6, 0xFA, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PaleSpringBud = APE::Color(0xEC, 0xEB, 0xBD, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PansyPurple = APE::Color(0x78, 0x18, 0x4A, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PaoloVeroneseGreen = APE::Color(0x00, 0x9B, 0x7D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PapayaWhip = APE::Color(0xFF, 0xEF, 0xD5, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ParadisePink = APE::Color(0xE6, 0x3E, 0x62, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Parchment = APE::Color(0xF1, 0xE9, 0xD2, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ParisGreen = APE::Color(0x50, 0xC8, 0x78, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PastelPink = APE::Color(0xDE, 0xA5, 0xA4, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Patriarch = APE::Color(0x80, 0x00, 0x80, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Paua = APE::Color(0x1F, 0x00, 0x5E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PayneSGrey = APE::Color(0x53, 0x68, 0x78, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Peach = APE::Color(0xFF, 0xE5, 0xB4, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PeachCrayola = APE::Color(0xFF, 0xCB, 0xA4, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PeachPuff = APE::Color(0xFF, 0xDA, 0xB9, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Pear = APE::Color(0xD1, 0xE2, 0x31, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PearlyPurple = APE::Color(0xB7, 0x68, 0xA2, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Periwinkle = APE::Color(0xCC, 0xCC, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PeriwinkleCrayola = APE::Color(0xC3, 0xCD, 0xE6, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PermanentGeraniumLake = APE::Color(0xE1, 0x2C, 0x2C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PersianBlue = APE::Color(0x1C, 0x39, 0xBB, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PersianGreen = APE::Color(0x00, 0xA6, 0x93, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PersianIndigo = APE::Color(0x32, 0x12, 0x7A, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PersianOrange = APE::Color(0xD9, 0x90, 0x58, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PersianPink = APE::Color(0xF7, 0x7F, 0xBE, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PersianPlum = APE::Color(0x70, 0x1C, 0x1C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PersianRed = APE::Color(0xCC, 0x33, 0x33, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PersianRose = APE::Color(0xFE, 0x28, 0xA2, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Persimmon = APE::Color(0xEC, 0x58, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PewterBlue = APE::Color(0x8B, 0xA8, 0xB7, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Phlox = APE::Color(0xDF, 0x00, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PhthaloBlue = APE::Color(0x00, 0x0F, 0x89, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PhthaloGreen = APE::Color(0x12, 0x35, 0x24, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PicoteeBlue = APE::Color(0x2E, 0x27, 0x87, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PictorialCarmine = APE::Color(0xC3, 0x0B, 0x4E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PiggyPink = APE::Color(0xFD, 0xDD, 0xE6, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PineGreen = APE::Color(0x01, 0x79, 0x6F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PineTree = APE::Color(0x2A, 0x2F, 0x23, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Pink = APE::Color(0xFF, 0xC0, 0xCB, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PinkPantone = APE::Color(0xD7, 0x48, 0x94, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PinkLace = APE::Color(0xFF, 0xDD, 0xF4, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PinkLavender = APE::Color(0xD8, 0xB2, 0xD1, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PinkSherbet = APE::Color(0xF7, 0x8F, 0xA7, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Pistachio = APE::Color(0x93, 0xC5, 0x72, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Platinum = APE::Color(0xE5, 0xE4, 0xE2, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Plum = APE::Color(0x8E, 0x45, 0x85, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PlumWeb = APE::Color(0xDD, 0xA0, 0xDD, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PlumpPurple = APE::Color(0x59, 0x46, 0xB2, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PolishedPine = APE::Color(0x5D, 0xA4, 0x93, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PompAndPower = APE::Color(0x86, 0x60, 0x8E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Popstar = APE::Color(0xBE, 0x4F, 0x62, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PortlandOrange = APE::Color(0xFF, 0x5A, 0x36, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PowderBlue = APE::Color(0xB0, 0xE0, 0xE6, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PrairieGold = APE::Color(0xE1, 0xCA, 0x7A, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PrincetonOrange = APE::Color(0xF5, 0x80, 0x25, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ProcessYellow = APE::Color(0xFF, 0xEF, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Prune = APE::Color(0x70, 0x1C, 0x1C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PrussianBlue = APE::Color(0x00, 0x31, 0x53, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PsychedelicPurple = APE::Color(0xDF, 0x00, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Puce = APE::Color(0xCC, 0x88, 0x99, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PullmanBrownUpsBrown = APE::Color(0x64, 0x41, 0x17, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Pumpkin = APE::Color(0xFF, 0x75, 0x18, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Purple = APE::Color(0x6A, 0x0D, 0xAD, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PurpleWeb = APE::Color(0x80, 0x00, 0x80, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PurpleMunsell = APE::Color(0x9F, 0x00, 0xC5, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PurpleX11 = APE::Color(0xA0, 0x20, 0xF0, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PurpleMountainMajesty = APE::Color(0x96, 0x78, 0xB6, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PurpleNavy = APE::Color(0x4E, 0x51, 0x80, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PurplePizzazz = APE::Color(0xFE, 0x4E, 0xDA, 0xFF);
+inline constexpr APE::Color APE::KnownColor::PurplePlum = APE::Color(0x9C, 0x51, 0xB6, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Purpureus = APE::Color(0x9A, 0x4E, 0xAE, 0xFF);
+inline constexpr APE::Color APE::KnownColor::QueenBlue = APE::Color(0x43, 0x6B, 0x95, 0xFF);
+inline constexpr APE::Color APE::KnownColor::QueenPink = APE::Color(0xE8, 0xCC, 0xD7, 0xFF);
+inline constexpr APE::Color APE::KnownColor::QuickSilver = APE::Color(0xA6, 0xA6, 0xA6, 0xFF);
+inline constexpr APE::Color APE::KnownColor::QuinacridoneMagenta = APE::Color(0x8E, 0x3A, 0x59, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RadicalRed = APE::Color(0xFF, 0x35, 0x5E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RaisinBlack = APE::Color(0x24, 0x21, 0x24, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Rajah = APE::Color(0xFB, 0xAB, 0x60, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Raspberry = APE::Color(0xE3, 0x0B, 0x5D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RaspberryGlace = APE::Color(0x91, 0x5F, 0x6D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RaspberryRose = APE::Color(0xB3, 0x44, 0x6C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RawSienna = APE::Color(0xD6, 0x8A, 0x59, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RawUmber = APE::Color(0x82, 0x66, 0x44, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RazzleDazzleRose = APE::Color(0xFF, 0x33, 0xCC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Razzmatazz = APE::Color(0xE3, 0x25, 0x6B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RazzmicBerry = APE::Color(0x8D, 0x4E, 0x85, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RebeccaPurple = APE::Color(0x66, 0x33, 0x99, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Red = APE::Color(0xFF, 0x00, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RedCrayola = APE::Color(0xEE, 0x20, 0x4D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RedMunsell = APE::Color(0xF2, 0x00, 0x3C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RedNcs = APE::Color(0xC4, 0x02, 0x33, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RedPantone = APE::Color(0xED, 0x29, 0x39, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RedPigment = APE::Color(0xED, 0x1C, 0x24, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RedRyb = APE::Color(0xFE, 0x27, 0x12, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RedOrange = APE::Color(0xFF, 0x53, 0x49, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RedOrangeCrayola = APE::Color(0xFF, 0x68, 0x1F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RedOrangeColorWheel = APE::Color(0xFF, 0x45, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RedPurple = APE::Color(0xE4, 0x00, 0x78, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RedSalsa = APE::Color(0xFD, 0x3A, 0x4A, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RedViolet = APE::Color(0xC7, 0x15, 0x85, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RedVioletCrayola = APE::Color(0xC0, 0x44, 0x8F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RedVioletColorWheel = APE::Color(0x92, 0x2B, 0x3E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Redwood = APE::Color(0xA4, 0x5A, 0x52, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ResolutionBlue = APE::Color(0x00, 0x23, 0x87, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Rhythm = APE::Color(0x77, 0x76, 0x96, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RichBlack = APE::Color(0x00, 0x40, 0x40, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RichBlackFogra29 = APE::Color(0x01, 0x0B, 0x13, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RichBlackFogra39 = APE::Color(0x01, 0x02, 0x03, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RifleGreen = APE::Color(0x44, 0x4C, 0x38, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RobinEggBlue = APE::Color(0x00, 0xCC, 0xCC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RocketMetallic = APE::Color(0x8A, 0x7F, 0x80, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RojoSpanishRed = APE::Color(0xA9, 0x11, 0x01, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RomanSilver = APE::Color(0x83, 0x89, 0x96, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Rose = APE::Color(0xFF, 0x00, 0x7F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RoseBonbon = APE::Color(0xF9, 0x42, 0x9E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RoseDust = APE::Color(0x9E, 0x5E, 0x6F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RoseEbony = APE::Color(0x67, 0x48, 0x46, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RoseMadder = APE::Color(0xE3, 0x26, 0x36, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RosePink = APE::Color(0xFF, 0x66, 0xCC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RosePompadour = APE::Color(0xED, 0x7A, 0x9B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RoseRed = APE::Color(0xC2, 0x1E, 0x56, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RoseTaupe = APE::Color(0x90, 0x5D, 0x5D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RoseVale = APE::Color(0xAB, 0x4E, 0x52, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Rosewood = APE::Color(0x65, 0x00, 0x0B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RossoCorsa = APE::Color(0xD4, 0x00, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RosyBrown = APE::Color(0xBC, 0x8F, 0x8F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RoyalBlueDark = APE::Color(0x00, 0x23, 0x66, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RoyalBlueLight = APE::Color(0x41, 0x69, 0xE1, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RoyalPurple = APE::Color(0x78, 0x51, 0xA9, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RoyalYellow = APE::Color(0xFA, 0xDA, 0x5E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Ruber = APE::Color(0xCE, 0x46, 0x76, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RubineRed = APE::Color(0xD1, 0x00, 0x56, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Ruby = APE::Color(0xE0, 0x11, 0x5F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RubyRed = APE::Color(0x9B, 0x11, 0x1E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Rufous = APE::Color(0xA8, 0x1C, 0x07, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Russet = APE::Color(0x80, 0x46, 0x1B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RussianGreen = APE::Color(0x67, 0x92, 0x67, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RussianViolet = APE::Color(0x32, 0x17, 0x4D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Rust = APE::Color(0xB7, 0x41, 0x0E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::RustyRed = APE::Color(0xDA, 0x2C, 0x43, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SacramentoStateGreen = APE::Color(0x04, 0x39, 0x27, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SaddleBrown = APE::Color(0x8B, 0x45, 0x13, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SafetyOrange = APE::Color(0xFF, 0x78, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SafetyOrangeBlazeOrange = APE::Color(0xFF, 0x67, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SafetyYellow = APE::Color(0xEE, 0xD2, 0x02, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Saffron = APE::Color(0xF4, 0xC4, 0x30, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Sage = APE::Color(0xBC, 0xB8, 0x8A, 0xFF);
+inline constexpr APE::Color APE::KnownColor::StPatrickSBlue = APE::Color(0x23, 0x29, 0x7A, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Salmon = APE::Color(0xFA, 0x80, 0x72, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SalmonPink = APE::Color(0xFF, 0x91, 0xA4, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Sand = APE::Color(0xC2, 0xB2, 0x80, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SandDune = APE::Color(0x96, 0x71, 0x17, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SandyBrown = APE::Color(0xF4, 0xA4, 0x60, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SapGreen = APE::Color(0x50, 0x7D, 0x2A, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Sapphire = APE::Color(0x0F, 0x52, 0xBA, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SapphireBlue = APE::Color(0x00, 0x67, 0xA5, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SapphireCrayola = APE::Color(0x2D, 0x5D, 0xA1, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SatinSheenGold = APE::Color(0xCB, 0xA1, 0x35, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Scarlet = APE::Color(0xFF, 0x24, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SchaussPink = APE::Color(0xFF, 0x91, 0xAF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SchoolBusYellow = APE::Color(0xFF, 0xD8, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ScreaminGreen = APE::Color(0x66, 0xFF, 0x66, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SeaGreen = APE::Color(0x2E, 0x8B, 0x57, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SeaGreenCrayola = APE::Color(0x00, 0xFF, 0xCD, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Seance = APE::Color(0x61, 0x20, 0x86, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SealBrown = APE::Color(0x59, 0x26, 0x0B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Seashell = APE::Color(0xFF, 0xF5, 0xEE, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Secret = APE::Color(0x76, 0x43, 0x74, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SelectiveYellow = APE::Color(0xFF, 0xBA, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Sepia = APE::Color(0x70, 0x42, 0x14, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Shadow = APE::Color(0x8A, 0x79, 0x5D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ShadowBlue = APE::Color(0x77, 0x8B, 0xA5, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ShamrockGreen = APE::Color(0x00, 0x9E, 0x60, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SheenGreen = APE::Color(0x8F, 0xD4, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ShimmeringBlush = APE::Color(0xD9, 0x86, 0x95, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ShinyShamrock = APE::Color(0x5F, 0xA7, 0x78, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ShockingPink = APE::Color(0xFC, 0x0F, 0xC0, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ShockingPinkCrayola = APE::Color(0xFF, 0x6F, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Sienna = APE::Color(0x88, 0x2D, 0x17, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Silver = APE::Color(0xC0, 0xC0, 0xC0, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SilverCrayola = APE::Color(0xC9, 0xC0, 0xBB, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SilverMetallic = APE::Color(0xAA, 0xA9, 0xAD, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SilverChalice = APE::Color(0xAC, 0xAC, 0xAC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SilverPink = APE::Color(0xC4, 0xAE, 0xAD, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SilverSand = APE::Color(0xBF, 0xC1, 0xC2, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Sinopia = APE::Color(0xCB, 0x41, 0x0B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SizzlingRed = APE::Color(0xFF, 0x38, 0x55, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SizzlingSunrise = APE::Color(0xFF, 0xDB, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Skobeloff = APE::Color(0x00, 0x74, 0x74, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SkyBlue = APE::Color(0x87, 0xCE, 0xEB, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SkyBlueCrayola = APE::Color(0x76, 0xD7, 0xEA, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SkyMagenta = APE::Color(0xCF, 0x71, 0xAF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SlateBlue = APE::Color(0x6A, 0x5A, 0xCD, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SlateGray = APE::Color(0x70, 0x80, 0x90, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SlimyGreen = APE::Color(0x29, 0x96, 0x17, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Smitten = APE::Color(0xC8, 0x41, 0x86, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SmokyBlack = APE::Color(0x10, 0x0C, 0x08, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Snow = APE::Color(0xFF, 0xFA, 0xFA, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SolidPink = APE::Color(0x89, 0x38, 0x43, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SonicSilver = APE::Color(0x75, 0x75, 0x75, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SpaceCadet = APE::Color(0x1D, 0x29, 0x51, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SpanishBistre = APE::Color(0x80, 0x75, 0x32, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SpanishBlue = APE::Color(0x00, 0x70, 0xB8, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SpanishCarmine = APE::Color(0xD1, 0x00, 0x47, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SpanishGray = APE::Color(0x98, 0x98, 0x98, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SpanishGreen = APE::Color(0x00, 0x91, 0x50, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SpanishOrange = APE::Color(0xE8, 0x61, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SpanishPink = APE::Color(0xF7, 0xBF, 0xBE, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SpanishRed = APE::Color(0xE6, 0x00, 0x26, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SpanishSkyBlue = APE::Color(0x00, 0xFF, 0xFE, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SpanishViolet = APE::Color(0x4C, 0x28, 0x82, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SpanishViridian = APE::Color(0x00, 0x7F, 0x5C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SpringBud = APE::Color(0xA7, 0xFC, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SpringFrost = APE::Color(0x87, 0xFF, 0x2A, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SpringGreen = APE::Color(0x00, 0xFF, 0x7F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SpringGreenCrayola = APE::Color(0xEC, 0xEB, 0xBD, 0xFF);
+inline constexpr APE::Color APE::KnownColor::StarCommandBlue = APE::Color(0x00, 0x7B, 0xB8, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SteelBlue = APE::Color(0x46, 0x82, 0xB4, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SteelPink = APE::Color(0xCC, 0x33, 0xCC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::StilDeGrainYellow = APE::Color(0xFA, 0xDA, 0x5E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Straw = APE::Color(0xE4, 0xD9, 0x6F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Strawberry = APE::Color(0xFA, 0x50, 0x53, 0xFF);
+inline constexpr APE::Color APE::KnownColor::StrawberryBlonde = APE::Color(0xFF, 0x93, 0x61, 0xFF);
+inline constexpr APE::Color APE::KnownColor::StrongLimeGreen = APE::Color(0x33, 0xCC, 0x33, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SugarPlum = APE::Color(0x91, 0x4E, 0x75, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Sunglow = APE::Color(0xFF, 0xCC, 0x33, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Sunray = APE::Color(0xE3, 0xAB, 0x57, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Sunset = APE::Color(0xFA, 0xD6, 0xA5, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SuperPink = APE::Color(0xCF, 0x6B, 0xA9, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SweetBrown = APE::Color(0xA8, 0x37, 0x31, 0xFF);
+inline constexpr APE::Color APE::KnownColor::SyracuseOrange = APE::Color(0xD4, 0x45, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Tan = APE::Color(0xD2, 0xB4, 0x8C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::TanCrayola = APE::Color(0xD9, 0x9A, 0x6C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Tangerine = APE::Color(0xF2, 0x85, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::TangoPink = APE::Color(0xE4, 0x71, 0x7A, 0xFF);
+inline constexpr APE::Color APE::KnownColor::TartOrange = APE::Color(0xFB, 0x4D, 0x46, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Taupe = APE::Color(0x48, 0x3C, 0x32, 0xFF);
+inline constexpr APE::Color APE::KnownColor::TaupeGray = APE::Color(0x8B, 0x85, 0x89, 0xFF);
+inline constexpr APE::Color APE::KnownColor::TeaGreen = APE::Color(0xD0, 0xF0, 0xC0, 0xFF);
+inline constexpr APE::Color APE::KnownColor::TeaRose = APE::Color(0xF4, 0xC2, 0xC2, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Teal = APE::Color(0x00, 0x80, 0x80, 0xFF);
+inline constexpr APE::Color APE::KnownColor::TealBlue = APE::Color(0x36, 0x75, 0x88, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Technobotanica = APE::Color(0x00, 0xFF, 0xBF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Telemagenta = APE::Color(0xCF, 0x34, 0x76, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Tawny = APE::Color(0xCD, 0x57, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::TerraCotta = APE::Color(0xE2, 0x72, 0x5B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Thistle = APE::Color(0xD8, 0xBF, 0xD8, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ThulianPink = APE::Color(0xDE, 0x6F, 0xA1, 0xFF);
+inline constexpr APE::Color APE::KnownColor::TickleMePink = APE::Color(0xFC, 0x89, 0xAC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::TiffanyBlue = APE::Color(0x0A, 0xBA, 0xB5, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Timberwolf = APE::Color(0xDB, 0xD7, 0xD2, 0xFF);
+inline constexpr APE::Color APE::KnownColor::TitaniumYellow = APE::Color(0xEE, 0xE6, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Tomato = APE::Color(0xFF, 0x63, 0x47, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Tourmaline = APE::Color(0x86, 0xA1, 0xA9, 0xFF);
+inline constexpr APE::Color APE::KnownColor::TropicalRainforest = APE::Color(0x00, 0x75, 0x5E, 0xFF);
+inline constexpr APE::Color APE::KnownColor::TrueBlue = APE::Color(0x2D, 0x68, 0xC4, 0xFF);
+inline constexpr APE::Color APE::KnownColor::TrypanBlue = APE::Color(0x1C, 0x05, 0xB3, 0xFF);
+inline constexpr APE::Color APE::KnownColor::TuftsBlue = APE::Color(0x3E, 0x8E, 0xDE, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Tumbleweed = APE::Color(0xDE, 0xAA, 0x88, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Turquoise = APE::Color(0x40, 0xE0, 0xD0, 0xFF);
+inline constexpr APE::Color APE::KnownColor::TurquoiseBlue = APE::Color(0x00, 0xFF, 0xEF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::TurquoiseGreen = APE::Color(0xA0, 0xD6, 0xB4, 0xFF);
+inline constexpr APE::Color APE::KnownColor::TurtleGreen = APE::Color(0x8A, 0x9A, 0x5B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Tuscan = APE::Color(0xFA, 0xD6, 0xA5, 0xFF);
+inline constexpr APE::Color APE::KnownColor::TuscanBrown = APE::Color(0x6F, 0x4E, 0x37, 0xFF);
+inline constexpr APE::Color APE::KnownColor::TuscanRed = APE::Color(0x7C, 0x48, 0x48, 0xFF);
+inline constexpr APE::Color APE::KnownColor::TuscanTan = APE::Color(0xA6, 0x7B, 0x5B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Tuscany = APE::Color(0xC0, 0x99, 0x99, 0xFF);
+inline constexpr APE::Color APE::KnownColor::TwilightLavender = APE::Color(0x8A, 0x49, 0x6B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::TyrianPurple = APE::Color(0x66, 0x02, 0x3C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::UaBlue = APE::Color(0x00, 0x33, 0xAA, 0xFF);
+inline constexpr APE::Color APE::KnownColor::UaRed = APE::Color(0xD9, 0x00, 0x4C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Ultramarine = APE::Color(0x3F, 0x00, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::UltramarineBlue = APE::Color(0x41, 0x66, 0xF5, 0xFF);
+inline constexpr APE::Color APE::KnownColor::UltraPink = APE::Color(0xFF, 0x6F, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::UltraRed = APE::Color(0xFC, 0x6C, 0x85, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Umber = APE::Color(0x63, 0x51, 0x47, 0xFF);
+inline constexpr APE::Color APE::KnownColor::UnbleachedSilk = APE::Color(0xFF, 0xDD, 0xCA, 0xFF);
+inline constexpr APE::Color APE::KnownColor::UnitedNationsBlue = APE::Color(0x00, 0x9E, 0xDB, 0xFF);
+inline constexpr APE::Color APE::KnownColor::UniversityOfPennsylvaniaRed = APE::Color(0xA5, 0x00, 0x21, 0xFF);
+inline constexpr APE::Color APE::KnownColor::UnmellowYellow = APE::Color(0xFF, 0xFF, 0x66, 0xFF);
+inline constexpr APE::Color APE::KnownColor::UpForestGreen = APE::Color(0x01, 0x44, 0x21, 0xFF);
+inline constexpr APE::Color APE::KnownColor::UpMaroon = APE::Color(0x7B, 0x11, 0x13, 0xFF);
+inline constexpr APE::Color APE::KnownColor::UpsdellRed = APE::Color(0xAE, 0x20, 0x29, 0xFF);
+inline constexpr APE::Color APE::KnownColor::UranianBlue = APE::Color(0xAF, 0xDB, 0xF5, 0xFF);
+inline constexpr APE::Color APE::KnownColor::UsafaBlue = APE::Color(0x00, 0x4F, 0x98, 0xFF);
+inline constexpr APE::Color APE::KnownColor::VanDykeBrown = APE::Color(0x66, 0x42, 0x28, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Vanilla = APE::Color(0xF3, 0xE5, 0xAB, 0xFF);
+inline constexpr APE::Color APE::KnownColor::VanillaIce = APE::Color(0xF3, 0x8F, 0xA9, 0xFF);
+inline constexpr APE::Color APE::KnownColor::VegasGold = APE::Color(0xC5, 0xB3, 0x58, 0xFF);
+inline constexpr APE::Color APE::KnownColor::VenetianRed = APE::Color(0xC8, 0x08, 0x15, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Verdigris = APE::Color(0x43, 0xB3, 0xAE, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Vermilion = APE::Color(0xE3, 0x42, 0x34, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Veronica = APE::Color(0xA0, 0x20, 0xF0, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Violet = APE::Color(0x8F, 0x00, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::VioletColorWheel = APE::Color(0x7F, 0x00, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::VioletCrayola = APE::Color(0x96, 0x3D, 0x7F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::VioletRyb = APE::Color(0x86, 0x01, 0xAF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::VioletWeb = APE::Color(0xEE, 0x82, 0xEE, 0xFF);
+inline constexpr APE::Color APE::KnownColor::VioletBlue = APE::Color(0x32, 0x4A, 0xB2, 0xFF);
+inline constexpr APE::Color APE::KnownColor::VioletBlueCrayola = APE::Color(0x76, 0x6E, 0xC8, 0xFF);
+inline constexpr APE::Color APE::KnownColor::VioletRed = APE::Color(0xF7, 0x53, 0x94, 0xFF);
+inline constexpr APE::Color APE::KnownColor::VioletRedPerbang = APE::Color(0xF0, 0x59, 0x9C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Viridian = APE::Color(0x40, 0x82, 0x6D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ViridianGreen = APE::Color(0x00, 0x96, 0x98, 0xFF);
+inline constexpr APE::Color APE::KnownColor::VividBurgundy = APE::Color(0x9F, 0x1D, 0x35, 0xFF);
+inline constexpr APE::Color APE::KnownColor::VividSkyBlue = APE::Color(0x00, 0xCC, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::VividTangerine = APE::Color(0xFF, 0xA0, 0x89, 0xFF);
+inline constexpr APE::Color APE::KnownColor::VividViolet = APE::Color(0x9F, 0x00, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Volt = APE::Color(0xCE, 0xFF, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::WarmBlack = APE::Color(0x00, 0x42, 0x42, 0xFF);
+inline constexpr APE::Color APE::KnownColor::WeezyBlue = APE::Color(0x18, 0x9B, 0xCC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Wheat = APE::Color(0xF5, 0xDE, 0xB3, 0xFF);
+inline constexpr APE::Color APE::KnownColor::White = APE::Color(0xFF, 0xFF, 0xFF, 0xFF);
+inline constexpr APE::Color APE::KnownColor::WildBlueYonder = APE::Color(0xA2, 0xAD, 0xD0, 0xFF);
+inline constexpr APE::Color APE::KnownColor::WildOrchid = APE::Color(0xD4, 0x70, 0xA2, 0xFF);
+inline constexpr APE::Color APE::KnownColor::WildStrawberry = APE::Color(0xFF, 0x43, 0xA4, 0xFF);
+inline constexpr APE::Color APE::KnownColor::WildWatermelon = APE::Color(0xFC, 0x6C, 0x85, 0xFF);
+inline constexpr APE::Color APE::KnownColor::WindsorTan = APE::Color(0xA7, 0x55, 0x02, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Wine = APE::Color(0x72, 0x2F, 0x37, 0xFF);
+inline constexpr APE::Color APE::KnownColor::WineDregs = APE::Color(0x67, 0x31, 0x47, 0xFF);
+inline constexpr APE::Color APE::KnownColor::WinterSky = APE::Color(0xFF, 0x00, 0x7C, 0xFF);
+inline constexpr APE::Color APE::KnownColor::WintergreenDream = APE::Color(0x56, 0x88, 0x7D, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Wisteria = APE::Color(0xC9, 0xA0, 0xDC, 0xFF);
+inline constexpr APE::Color APE::KnownColor::WoodBrown = APE::Color(0xC1, 0x9A, 0x6B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Xanadu = APE::Color(0x73, 0x86, 0x78, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Xanthic = APE::Color(0xEE, 0xED, 0x09, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Xanthous = APE::Color(0xF1, 0xB4, 0x2F, 0xFF);
+inline constexpr APE::Color APE::KnownColor::YaleBlue = APE::Color(0x00, 0x35, 0x6B, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Yellow = APE::Color(0xFF, 0xFF, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::YellowCrayola = APE::Color(0xFC, 0xE8, 0x83, 0xFF);
+inline constexpr APE::Color APE::KnownColor::YellowMunsell = APE::Color(0xEF, 0xCC, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::YellowNcs = APE::Color(0xFF, 0xD3, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::YellowPantone = APE::Color(0xFE, 0xDF, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::YellowProcess = APE::Color(0xFF, 0xEF, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::YellowRyb = APE::Color(0xFE, 0xFE, 0x33, 0xFF);
+inline constexpr APE::Color APE::KnownColor::YellowGreen = APE::Color(0x9A, 0xCD, 0x32, 0xFF);
+inline constexpr APE::Color APE::KnownColor::YellowGreenCrayola = APE::Color(0xC5, 0xE3, 0x84, 0xFF);
+inline constexpr APE::Color APE::KnownColor::YellowGreenColorWheel = APE::Color(0x30, 0xB2, 0x1A, 0xFF);
+inline constexpr APE::Color APE::KnownColor::YellowOrange = APE::Color(0xFF, 0xAE, 0x42, 0xFF);
+inline constexpr APE::Color APE::KnownColor::YellowOrangeColorWheel = APE::Color(0xFF, 0x95, 0x05, 0xFF);
+inline constexpr APE::Color APE::KnownColor::YellowSunshine = APE::Color(0xFF, 0xF7, 0x00, 0xFF);
+inline constexpr APE::Color APE::KnownColor::YinmnBlue = APE::Color(0x2E, 0x50, 0x90, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Zaffre = APE::Color(0x00, 0x14, 0xA8, 0xFF);
+inline constexpr APE::Color APE::KnownColor::ZinnwalditeBrown = APE::Color(0x2C, 0x16, 0x08, 0xFF);
+inline constexpr APE::Color APE::KnownColor::Zomp = APE::Color(0x39, 0xA7, 0x8E, 0xFF);
+
 #endif // __APE_COLOR_H__
\ No newline at end of file
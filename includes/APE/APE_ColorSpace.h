@@ -0,0 +1,111 @@
+#ifndef __APE_COLORSPACE_H__
+#define __APE_COLORSPACE_H__
+
+#include "APE_Color.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace APE {
+    /// @brief The Linear Color class, a color with linear light channels (the sRGB transfer function removed),
+    /// on 16 bits so the dark shades keep their precision.
+    class LinearColor {
+    public:
+        /// @brief The Red channel of the Linear Color (from range [0->65535]).
+        uint16_t Red = 0;
+        /// @brief The Green channel of the Linear Color (from range [0->65535]).
+        uint16_t Green = 0;
+        /// @brief The Blue channel of the Linear Color (from range [0->65535]).
+        uint16_t Blue = 0;
+        /// @brief The Alpha channel of the Linear Color (from range [0->65535]), alpha is already linear.
+        uint16_t Alpha = 0;
+
+        /// @brief Create an empty Linear Color with all channel value are set to 0.
+        constexpr LinearColor() = default;
+        /// @brief Create a new Linear Color with specific red, green, blue and alpha channel value.
+        /// @param r The red channel value.
+        /// @param g The green channel value.
+        /// @param b The blue channel value.
+        /// @param a The alpha channel value.
+        constexpr LinearColor(uint16_t r, uint16_t g, uint16_t b, uint16_t a) : Red(r), Green(g), Blue(b), Alpha(a) {}
+
+        constexpr bool operator==(const LinearColor& c) const {
+            return Red == c.Red && Green == c.Green && Blue == c.Blue && Alpha == c.Alpha;
+        }
+        constexpr bool operator!=(const LinearColor& c) const { return !(*this == c); }
+    };
+
+    /// @brief The Color Space static class, convert the sRGB Color to and from linear light, and interpolate
+    /// in linear light (gamma-correct) so the gradients and fades don't go muddy in the middle.
+    /// @note The conversions use lookup tables (256 entries from sRGB, 4096 entries to sRGB) built on the
+    /// first use, every 8-bit sRGB value survive a round trip unchanged.
+    class ColorSpace final {
+    public:
+        /// @brief The number of entries of the linear to sRGB table, the linear values are truncated to 12 bits.
+        static const std::size_t LinearToSRGBTableSize = 4096;
+
+        /// @brief Convert a sRGB channel to linear light.
+        /// @param value The sRGB channel value.
+        /// @return The linear channel value (from range [0->65535]).
+        static uint16_t SRGBToLinear(uint8_t value);
+        /// @brief Convert a linear light channel to sRGB.
+        /// @param value The linear channel value (from range [0->65535]).
+        /// @return The sRGB channel value.
+        static uint8_t LinearToSRGB(uint16_t value);
+
+        /// @brief Convert a Color to linear light.
+        /// @param color The Color to convert.
+        /// @return The linear color.
+        static LinearColor ToLinear(const Color& color);
+        /// @brief Convert a linear light color to a Color.
+        /// @param color The linear color to convert.
+        /// @return The Color.
+        static Color ToSRGB(const LinearColor& color);
+        /// @brief Convert a span of Color to linear light.
+        /// @param colors The colors to convert.
+        /// @param out The linear colors.
+        /// @param count The number of colors.
+        static void ToLinear(const Color* colors, LinearColor* out, std::size_t count);
+        /// @brief Convert a span of linear light colors to Color.
+        /// @param colors The linear colors to convert.
+        /// @param out The colors.
+        /// @param count The number of colors.
+        static void ToSRGB(const LinearColor* colors, Color* out, std::size_t count);
+
+        /// @brief Gamma-correct linear interpolation between two colors, the red, green and blue channels are
+        /// interpolated in linear light (the alpha channel is interpolated as it is, like Color::LerpTo()).
+        /// @param a The start color of the interpolation.
+        /// @param b The end color of the interpolation.
+        /// @param t The interpolation value, in range [0->1] (if out of range will clamped it).
+        /// @return The result of the interpolation.
+        static Color Lerp(const Color& a, const Color& b, float t);
+        /// @brief Gamma-correct lighten (similar to a gamma-correct lerp to a solid white color).
+        /// @param color The color to lighten.
+        /// @param percent The lighten percentage, in range [0->100] (if out of range will clamped it).
+        /// @return The result of the lighten operation.
+        static Color Lighten(const Color& color, float percent);
+        /// @brief Gamma-correct darken (similar to a gamma-correct lerp to a solid black color).
+        /// @param color The color to darken.
+        /// @param percent The darken percentage, in range [0->100] (if out of range will clamped it).
+        /// @return The result of the darken operation.
+        static Color Darken(const Color& color, float percent);
+        /// @brief Gamma-correct linear interpolation between two spans of colors, with the same result as Lerp()
+        /// for each color.
+        /// @param a The start colors of the interpolation.
+        /// @param b The end colors of the interpolation.
+        /// @param t The interpolation value, in range [0->1] (if out of range will clamped it).
+        /// @param out The result colors, can be the same as a or b.
+        /// @param count The number of colors.
+        static void LerpSpan(const Color* a, const Color* b, float t, Color* out, std::size_t count);
+        /// @brief Gamma-correct linear interpolation from a span of colors to a single color, with the same
+        /// result as Lerp() for each color.
+        /// @param colors The start colors of the interpolation.
+        /// @param target The end color of the interpolation.
+        /// @param t The interpolation value, in range [0->1] (if out of range will clamped it).
+        /// @param out The result colors, can be the same as colors.
+        /// @param count The number of colors.
+        static void LerpSpan(const Color* colors, const Color& target, float t, Color* out, std::size_t count);
+    };
+}
+
+#endif // __APE_COLORSPACE_H__
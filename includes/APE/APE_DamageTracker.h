@@ -0,0 +1,57 @@
+#ifndef __APE_DAMAGE_TRACKER_H__
+#define __APE_DAMAGE_TRACKER_H__
+
+#include "APE_Structure.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace APE {
+    /// @brief The Damage Tracker class, keep track of the damaged (changed) regions of an area as a small set of
+    /// coalesced rectangles. Usually to only redraw those regions (through SetClipArea()) and present them.
+    class DamageTracker {
+    private:
+        Size m_size;
+        std::size_t m_maxRectangles;
+        std::vector<Rectangle> m_rectangles;
+
+        /// @brief Merge the two rectangles wasting the least area, until the rectangles count is under the limit.
+        void Coalesce();
+    public:
+        /// @brief Create a new Damage Tracker.
+        /// @param size The size of the tracked area, damages outside of it are ignored.
+        /// @param maxRectangles The maximum number of rectangles to keep, nearby rectangles are merged above it (at least 1).
+        DamageTracker(const Size& size, std::size_t maxRectangles = 16);
+
+        /// @brief Get the size of the tracked area.
+        /// @return The size of the tracked area.
+        Size GetSize() const;
+        /// @brief Get the maximum number of rectangles kept by the Damage Tracker.
+        /// @return The maximum number of rectangles.
+        std::size_t GetMaxRectangles() const;
+
+        /// @brief Mark a region as damaged. It's merged with the existing rectangles when that didn't add
+        /// (or barely add) undamaged area.
+        /// @param area The damaged region, will be clipped to the tracked area.
+        void AddDamage(const Rectangle& area);
+        /// @brief Mark the whole tracked area as damaged.
+        void DamageAll();
+        /// @brief Clear all damages, usually after presenting them.
+        void Clear();
+
+        /// @brief Check if there is any damaged region.
+        /// @return true if any region is damaged, false otherwise.
+        bool IsDamaged() const;
+        /// @brief Get the damaged regions, they never overlap each other's entirely but may partially overlap.
+        /// @return The damaged rectangles (top-left rectangles, inside the tracked area).
+        const std::vector<Rectangle>& GetRectangles() const;
+        /// @brief Get the smallest rectangle containing all damaged regions.
+        /// @return The bounds of the damaged regions, or Rectangle::Empty if not damaged.
+        Rectangle GetBounds() const;
+        /// @brief Get the total area of the damaged rectangles (overlapping parts are counted twice).
+        /// @return The damaged area, in pixels.
+        long long GetDamagedArea() const;
+    };
+}
+
+#endif // __APE_DAMAGE_TRACKER_H__
@@ -0,0 +1,98 @@
+#ifndef __APE_GRADIENT_H__
+#define __APE_GRADIENT_H__
+
+#include "APE_Color.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace APE {
+    /// @brief The Gradient Interpolation enum class, the space the colors of a Gradient are interpolated in.
+    enum class GradientInterpolation {
+        /// @brief In sRGB, like Color::LerpTo() (the middle of the gradients go darker and muddy).
+        SRGB,
+        /// @brief In linear light, like ColorSpace::Lerp().
+        Linear,
+        /// @brief In OKLab, the steps of the gradient look even (see Color::ToOKLab()).
+        OKLab
+    };
+
+    /// @brief The Gradient Stop struct, a color of a Gradient at a position.
+    struct GradientStop {
+    public:
+        /// @brief The position of the stop along the gradient (from range [0->1]).
+        float Position = 0.0f;
+        /// @brief The color of the gradient at the position.
+        Color Value;
+    };
+
+    /// @brief The Gradient class, a multi-stop color gradient baked in a lookup table, so sampling it cost a
+    /// single table lookup. The table is baked again on every change of the stops or of the interpolation.
+    class Gradient {
+    private:
+        std::vector<GradientStop> m_stops;
+        std::vector<Color> m_table;
+        GradientInterpolation m_interpolation;
+
+        /// @brief Fill the table from the stops.
+        void Bake();
+    public:
+        /// @brief The number of entries of a small table, enough for most of the color ramps.
+        static const std::size_t SmallTableSize = 256;
+        /// @brief The number of entries of a large table, for the gradients stretched over many pixels.
+        static const std::size_t LargeTableSize = 1024;
+
+        /// @brief Create a new Gradient without stops (every sample is Color::Empty).
+        /// @param tableSize The number of entries of the table, SmallTableSize or LargeTableSize.
+        /// @param interpolation The space the colors are interpolated in.
+        Gradient(std::size_t tableSize = SmallTableSize, GradientInterpolation interpolation = GradientInterpolation::OKLab);
+        /// @brief Create a new Gradient from a start color to an end color.
+        /// @param start The color at the position 0.
+        /// @param end The color at the position 1.
+        /// @param tableSize The number of entries of the table, SmallTableSize or LargeTableSize.
+        /// @param interpolation The space the colors are interpolated in.
+        Gradient(const Color& start, const Color& end, std::size_t tableSize = SmallTableSize,
+                 GradientInterpolation interpolation = GradientInterpolation::OKLab);
+
+        /// @brief Add a stop to the Gradient. Before the first stop and after the last stop, the gradient keep
+        /// their color; two stops at the same position make a hard edge.
+        /// @param position The position of the stop, in range [0->1] (if out of range will clamped it).
+        /// @param color The color of the stop.
+        void AddStop(float position, const Color& color);
+        /// @brief Replace the stops of the Gradient, the table is baked once for all of them.
+        /// @param stops The stops, in any order (positions out of [0->1] are clamped).
+        /// @param count The number of stops.
+        void SetStops(const GradientStop* stops, std::size_t count);
+        /// @brief Remove all stops of the Gradient.
+        void ClearStops();
+        /// @brief Get the stops of the Gradient.
+        /// @return The stops, sorted by position.
+        const std::vector<GradientStop>& GetStops() const;
+
+        /// @brief Get the space the colors are interpolated in.
+        /// @return The interpolation of the Gradient.
+        GradientInterpolation GetInterpolation() const;
+        /// @brief Set the space the colors are interpolated in.
+        /// @param interpolation The interpolation to set.
+        void SetInterpolation(GradientInterpolation interpolation);
+
+        /// @brief Get the number of entries of the table.
+        /// @return The table size, SmallTableSize or LargeTableSize.
+        std::size_t GetTableSize() const;
+        /// @brief Get the baked table, the entry i is the color at the position i / (GetTableSize() - 1).
+        /// @return The colors of the table.
+        const Color* GetTable() const;
+
+        /// @brief Sample the Gradient at a position, the nearest entry of the table.
+        /// @param t The position, in range [0->1] (if out of range will clamped it, NaN become 0).
+        /// @return The color of the gradient at the position.
+        Color Sample(float t) const;
+        /// @brief Sample the Gradient at many positions, with the same result as Sample() for each one.
+        /// @param t The positions.
+        /// @param out The colors of the gradient at the positions.
+        /// @param count The number of positions.
+        void SampleSpan(const float* t, Color* out, std::size_t count) const;
+    };
+}
+
+#endif // __APE_GRADIENT_H__
@@ -0,0 +1,104 @@
+#ifndef __APE_PALETTE_H__
+#define __APE_PALETTE_H__
+
+#include "APE_Color.h"
+#include "APE_Structure.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace APE {
+    class ThreadPool;
+
+    /// @brief The Palette Method enum class, the algorithm building a palette from an image.
+    enum class PaletteMethod {
+        /// @brief Split the color box holding the most pixels spread along its longest axis, at its median, until
+        /// there is enough boxes. Fast, but the palette colors are not the best fit.
+        MedianCut,
+        /// @brief Start from the median cut palette, then move each palette color to the mean of the pixels
+        /// nearest to it (k-means) for a few iterations. Slower, with a smaller error.
+        KMeans
+    };
+
+    /// @brief The Dither Method enum class, how the quantisation error is spread over the pixels.
+    enum class DitherMethod {
+        /// @brief Every pixel get its nearest palette color, the gradients show bands.
+        None,
+        /// @brief Add an 8x8 Bayer matrix threshold to the pixels before their lookup, a regular pattern that
+        /// doesn't move when the image change (good for animations).
+        Ordered,
+        /// @brief Floyd-Steinberg error diffusion, in serpentine order. The image is dithered in strips of
+        /// StripHeight rows, the error is not carried from one strip to the next.
+        FloydSteinberg
+    };
+
+    /// @brief The Palette class, a set of up to 256 colors to reduce images to, with a nearest color lookup
+    /// accelerated by a grid cache: the RGB cube is split in 16x16x16 cells, each one keep the only palette
+    /// colors that can be the nearest of a color inside it, so a lookup compare a few colors instead of all.
+    /// @note The colors are compared by their RGB euclidean distance, the alpha is ignored.
+    class Palette {
+    private:
+        std::vector<Color> m_colors;
+        /// @brief The start of the candidates of each cell in m_candidates, and the end of the last one.
+        std::vector<uint32_t> m_cellStarts;
+        std::vector<uint8_t> m_candidates;
+
+        /// @brief Build the candidates of every cell of the grid cache.
+        void BuildGrid();
+    public:
+        /// @brief The maximum number of colors of a Palette.
+        static const std::size_t MaxColorsCount = 256;
+        /// @brief The number of rows of the strips, dithered (and run on the threads) independently.
+        static const int StripHeight = 64;
+
+        /// @brief Create an empty Palette.
+        Palette();
+        /// @brief Create a new Palette from colors.
+        /// @param colors The colors of the Palette.
+        /// @param count The number of colors, up to MaxColorsCount.
+        Palette(const Color* colors, std::size_t count);
+
+        /// @brief Build a palette fitting the colors of an image. The colors are counted in a 5 bits per channel
+        /// histogram first, so the cost of the palette building doesn't depend on the number of pixels.
+        /// @param pixels The pixels of the image.
+        /// @param count The number of pixels.
+        /// @param colorsCount The number of colors of the palette to build, in range [1->256] (if out of range
+        /// will clamped it). The palette can have less colors if the image doesn't have enough.
+        /// @param method The algorithm building the palette.
+        /// @param pool The thread pool counting the colors, or nullptr to count them on the calling thread.
+        /// @return The palette, empty if there is no pixels.
+        static Palette Build(const Color* pixels, std::size_t count, std::size_t colorsCount,
+                             PaletteMethod method = PaletteMethod::MedianCut, ThreadPool* pool = nullptr);
+
+        /// @brief Get the number of colors of the Palette.
+        /// @return The number of colors.
+        std::size_t GetColorsCount() const;
+        /// @brief Get the colors of the Palette.
+        /// @return The colors, GetColorsCount() of them.
+        const Color* GetColors() const;
+
+        /// @brief Find the palette color nearest to a color, the same as comparing with every palette color.
+        /// @param color The color to look up.
+        /// @return The index of the nearest palette color (the first one on a tie), or 0 if the Palette is empty.
+        uint8_t FindNearest(const Color& color) const;
+
+        /// @brief Reduce an image to the Palette colors, dithered.
+        /// @param pixels The pixels of the image, row by row, size.Width pixels per row.
+        /// @param size The size of the image.
+        /// @param indices The palette index of each pixel, row by row.
+        /// @param dither How to spread the quantisation error.
+        /// @param pool The thread pool running the strips of rows, or nullptr to run them on the calling thread
+        /// (the result is the same).
+        /// @note Will do nothing if the Palette is empty.
+        void Quantize(const Color* pixels, const Size& size, uint8_t* indices, DitherMethod dither = DitherMethod::None,
+                      ThreadPool* pool = nullptr) const;
+        /// @brief Convert palette indices to their colors.
+        /// @param indices The palette indices, out of range ones become Color::Empty.
+        /// @param out The colors.
+        /// @param count The number of indices.
+        void ToColors(const uint8_t* indices, Color* out, std::size_t count) const;
+    };
+}
+
+#endif // __APE_PALETTE_H__
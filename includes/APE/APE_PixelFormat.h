@@ -0,0 +1,77 @@
+#ifndef __APE_PIXELFORMAT_H__
+#define __APE_PIXELFORMAT_H__
+
+#include "APE_Color.h"
+#include "APE_Structure.h"
+
+#include <SDL2/SDL_pixels.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace APE {
+    /// @brief The Pixel Format enum class, the packed SDL2 pixel formats that Color buffers can be converted to.
+    /// The channels are packed in a native 32-bit (or 16-bit) value, from the highest bits to the lowest.
+    enum class PixelFormat {
+        /// @brief Red, green, blue then alpha, the same packing as Color::ToUint32().
+        RGBA8888 = SDL_PIXELFORMAT_RGBA8888,
+        /// @brief Alpha, red, green then blue.
+        ARGB8888 = SDL_PIXELFORMAT_ARGB8888,
+        /// @brief Alpha, blue, green then red, the same memory layout as Color on little endian CPUs.
+        ABGR8888 = SDL_PIXELFORMAT_ABGR8888,
+        /// @brief Blue, green, red then alpha.
+        BGRA8888 = SDL_PIXELFORMAT_BGRA8888,
+        /// @brief Unused byte, red, green then blue, the alpha is ignored.
+        XRGB8888 = SDL_PIXELFORMAT_RGB888,
+        /// @brief Unused byte, blue, green then red, the alpha is ignored.
+        XBGR8888 = SDL_PIXELFORMAT_BGR888,
+        /// @brief 5 bits red, 6 bits green then 5 bits blue on 16 bits, the alpha is ignored.
+        RGB565 = SDL_PIXELFORMAT_RGB565,
+        Unknown = SDL_PIXELFORMAT_UNKNOWN
+    };
+
+    /// @brief The Pixel Converter static class, convert Color buffers to and from packed pixel buffers, with the
+    /// SSE2 or AVX2 kernels if the CPU support them (no branch per pixel). Made for streaming textures uploads,
+    /// the pixels are written in the native byte order SDL2 expects for the format.
+    /// @note To RGB565 the channels are truncated, from it they are expanded by bit replication (as SDL2 does).
+    class PixelConverter final {
+    public:
+        /// @brief Get the size of a pixel of a pixel format.
+        /// @param format The pixel format.
+        /// @return The number of bytes per pixel, or 0 if the format is not supported.
+        static int GetBytesPerPixel(PixelFormat format);
+
+        /// @brief Convert a span of colors to packed pixels.
+        /// @param colors The colors to convert.
+        /// @param pixels The packed pixels, aligned on their size.
+        /// @param format The pixel format of the packed pixels.
+        /// @param count The number of colors.
+        /// @return False if the format is not supported, true otherwise.
+        static bool ToPixels(const Color* colors, void* pixels, PixelFormat format, std::size_t count);
+        /// @brief Convert rows of colors to packed pixels with a pitch, as given by SDL_LockTexture().
+        /// @param colors The colors to convert, row by row, size.Width colors per row.
+        /// @param size The size of the converted area.
+        /// @param pixels The packed pixels, aligned on their size.
+        /// @param pitch The number of bytes between the start of two rows of pixels.
+        /// @param format The pixel format of the packed pixels.
+        /// @return False if the format is not supported or the pitch is too small, true otherwise.
+        static bool ToPixels(const Color* colors, const Size& size, void* pixels, int pitch, PixelFormat format);
+
+        /// @brief Convert a span of packed pixels to colors.
+        /// @param pixels The packed pixels to convert, aligned on their size.
+        /// @param format The pixel format of the packed pixels.
+        /// @param colors The colors.
+        /// @param count The number of pixels.
+        /// @return False if the format is not supported, true otherwise.
+        static bool FromPixels(const void* pixels, PixelFormat format, Color* colors, std::size_t count);
+        /// @brief Convert rows of packed pixels with a pitch to colors.
+        /// @param pixels The packed pixels to convert, aligned on their size.
+        /// @param pitch The number of bytes between the start of two rows of pixels.
+        /// @param format The pixel format of the packed pixels.
+        /// @param size The size of the converted area.
+        /// @param colors The colors, row by row, size.Width colors per row.
+        /// @return False if the format is not supported or the pitch is too small, true otherwise.
+        static bool FromPixels(const void* pixels, int pitch, PixelFormat format, const Size& size, Color* colors);
+    };
+}
+
+#endif // __APE_PIXELFORMAT_H__
@@ -0,0 +1,148 @@
+#ifndef __APE_PROFILER_H__
+#define __APE_PROFILER_H__
+
+#include "APE_Define.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#define APE_PROFILER_CONCAT_IMPL(a, b) a##b
+#define APE_PROFILER_CONCAT(a, b) APE_PROFILER_CONCAT_IMPL(a, b)
+
+// The instrumentation macros, they compile to nothing unless APE_ENABLE_PROFILER is defined (see the
+// APE_ENABLE_PROFILER CMake option). The names must be string literals (or have a static storage duration).
+#ifdef APE_ENABLE_PROFILER
+    // Time the rest of the current scope as a zone with the given name.
+    #define APE_PROFILE_ZONE(name) APE::ProfilerZone APE_PROFILER_CONCAT(apeProfilerZone, __LINE__)(name)
+    // Add the given value to the counter with the given name, for the current frame.
+    #define APE_PROFILE_COUNTER(name, value) APE::Profiler::AddCounter(name, value)
+    // Mark the end of the current frame (SDL2Renderer::Present() does it).
+    #define APE_PROFILE_FRAME() APE::Profiler::EndFrame()
+#else
+    #define APE_PROFILE_ZONE(name) ((void)0)
+    #define APE_PROFILE_COUNTER(name, value) ((void)0)
+    #define APE_PROFILE_FRAME() ((void)0)
+#endif
+
+namespace APE {
+    /// @brief The Profiler Zone Statistics struct, contain the timing of a zone over a frame.
+    struct ProfilerZoneStatistics {
+    public:
+        /// @brief The name of the zone.
+        const char* Name = nullptr;
+        /// @brief The number of time the zone was entered.
+        std::size_t Calls = 0;
+        /// @brief The total time spent in the zone, in microseconds (nested zones are included).
+        double Microseconds = 0;
+    };
+
+    /// @brief The Profiler Counter Statistics struct, contain the total of a counter over a frame.
+    struct ProfilerCounterStatistics {
+    public:
+        /// @brief The name of the counter.
+        const char* Name = nullptr;
+        /// @brief The sum of the values added to the counter.
+        long long Total = 0;
+    };
+
+    /// @brief The Profiler Frame struct, contain the summary of a profiled frame.
+    struct ProfilerFrame {
+    public:
+        /// @brief The index of the frame, starting from 0.
+        std::size_t Index = 0;
+        /// @brief The time of the frame start, in microseconds since the Profiler started.
+        double StartMicroseconds = 0;
+        /// @brief The duration of the frame (from the previous frame end), in microseconds.
+        double Microseconds = 0;
+        /// @brief The statistics of the zones recorded during the frame, in order of first appearance.
+        std::vector<ProfilerZoneStatistics> Zones;
+        /// @brief The statistics of the counters recorded during the frame, in order of first appearance.
+        std::vector<ProfilerCounterStatistics> Counters;
+        /// @brief The number of events lost because a thread buffer was full.
+        std::size_t DroppedEvents = 0;
+
+        /// @brief Get the statistics of the zone with the given name.
+        /// @return The statistics of the zone, or nullptr if it was not recorded during the frame.
+        const ProfilerZoneStatistics* FindZone(const std::string& name) const;
+        /// @brief Get the statistics of the counter with the given name.
+        /// @return The statistics of the counter, or nullptr if it was not recorded during the frame.
+        const ProfilerCounterStatistics* FindCounter(const std::string& name) const;
+    };
+
+    /// @brief The Profiler class, collect the CPU timing of the instrumented zones and counters (see
+    /// APE_PROFILE_ZONE and APE_PROFILE_COUNTER), and summarise them per frame.
+    /// @note Each thread record into its own lock-free ring buffer, which is drained by EndFrame(). Events are
+    /// dropped (and counted) if a thread record more than the buffer capacity in a frame. Without
+    /// APE_ENABLE_PROFILER, nothing is recorded and all the frames are empty.
+    class Profiler {
+    public:
+        /// @brief The number of events each thread buffer can hold between two frames.
+        static const std::size_t BufferCapacity = 1 << 14;
+
+        Profiler() = delete;
+
+        /// @brief Check if the profiler was compiled in (APE_ENABLE_PROFILER).
+        /// @return true if the profiler is enabled, false otherwise.
+        static bool IsEnabled();
+
+        /// @brief Get the current time of the profiler clock.
+        /// @return The time in nanoseconds, since an unspecified point.
+        static std::uint64_t Now();
+
+        /// @brief Record a zone for the calling thread.
+        /// @param name The name of the zone, must have a static storage duration.
+        /// @param start The start time of the zone (see Now()).
+        /// @param end The end time of the zone (see Now()).
+        static void RecordZone(const char* name, std::uint64_t start, std::uint64_t end);
+        /// @brief Add a value to a counter for the calling thread.
+        /// @param name The name of the counter, must have a static storage duration.
+        /// @param value The value to add.
+        static void AddCounter(const char* name, long long value);
+
+        /// @brief Close the current frame: drain the threads buffers, summarise them, and start a new frame.
+        /// @note This should be called from a single thread, usually the rendering one.
+        static void EndFrame();
+        /// @brief Get the summary of the last closed frame.
+        /// @return The summary of the last frame, empty if no frame was closed yet.
+        static ProfilerFrame GetLastFrame();
+
+        /// @brief Start capturing the events and the frames summaries, for a Chrome trace export.
+        /// @note The previous capture is discarded.
+        static void StartCapture();
+        /// @brief Stop capturing, the captured events are kept until the next StartCapture().
+        static void StopCapture();
+        /// @brief Check if the events are being captured.
+        /// @return true if capturing, false otherwise.
+        static bool IsCapturing();
+
+        /// @brief Write the captured events as Chrome trace_event JSON (loadable in chrome://tracing or Perfetto).
+        /// @param stream The stream to write to.
+        /// @note The zones are written as complete events per thread, the counters as counter events, and the
+        /// frames as complete events on their own track with their summary as arguments.
+        static void WriteChromeTrace(std::ostream& stream);
+        /// @brief Save the captured events as a Chrome trace_event JSON file.
+        /// @param path The path of the file to write.
+        /// @return true on success, false otherwise.
+        static bool SaveChromeTrace(const std::string& path);
+    };
+
+    /// @brief The Profiler Zone class, record the time between its construction and its destruction as a zone.
+    /// @note Use APE_PROFILE_ZONE instead, so it compile away when the profiler is disabled.
+    class ProfilerZone {
+    private:
+        const char* m_name;
+        std::uint64_t m_start;
+    public:
+        /// @brief Start a new zone.
+        /// @param name The name of the zone, must have a static storage duration.
+        explicit ProfilerZone(const char* name) : m_name(name), m_start(Profiler::Now()) {}
+        ~ProfilerZone() { Profiler::RecordZone(m_name, m_start, Profiler::Now()); }
+
+        APE_NOT_COPY_ASSIGNABLE(ProfilerZone)
+    };
+}
+
+#endif // __APE_PROFILER_H__
@@ -0,0 +1,51 @@
+#ifndef __APE_RECTANGLE_PACKER_H__
+#define __APE_RECTANGLE_PACKER_H__
+
+#include "APE_Structure.h"
+
+#include <vector>
+
+namespace APE {
+    /// @brief The Skyline Packer class, pack rectangles into a fixed size area using the skyline bottom-left
+    /// heuristic. Usually for building texture atlases.
+    /// @note Packed rectangles are never moved or removed, the only way to free the space is Clear().
+    class SkylinePacker {
+    private:
+        /// @brief A horizontal segment of the skyline, the area below it is occupied.
+        struct SkylineNode {
+            int X;
+            int Y;
+            int Width;
+        };
+
+        Size m_size;
+        long long m_usedArea = 0;
+        std::vector<SkylineNode> m_skyline;
+
+        /// @brief Find the lowest y position that a rectangle can be placed at, starting at the given node.
+        /// @return The y position, or -1 if the rectangle can't be placed there.
+        int Fit(std::size_t index, int width, int height) const;
+    public:
+        /// @brief Create a new Skyline Packer.
+        /// @param size The size of the area to pack the rectangles into, will be an empty area if not valid.
+        SkylinePacker(const Size& size);
+
+        /// @brief Pack a rectangle of the given size into the area.
+        /// @param size The size of the rectangle to pack.
+        /// @param result The Rectangle that receive the packed (top-left) area on succeed.
+        /// @return true if the rectangle was packed, false if there's no space left for it.
+        bool Insert(const Size& size, Rectangle& result);
+
+        /// @brief Remove all the packed rectangles.
+        void Clear();
+
+        /// @brief Get the size of the packing area.
+        /// @return The size of the packing area.
+        Size GetSize() const;
+        /// @brief Calculate the ratio of the packing area that is used by the packed rectangles.
+        /// @return The occupancy ratio, in range [0->1].
+        double GetOccupancy() const;
+    };
+}
+
+#endif // __APE_RECTANGLE_PACKER_H__
@@ -4,6 +4,11 @@
 #include "APE/APE_Structure.h"
 #include "APE_Define.h"
 #include "APE_Color.h"
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
 #include <vector>
 
 namespace APE {
@@ -22,15 +27,75 @@ namespace APE {
             : Position(position), Color(color), TexturePosition(texturePosition) {}
     };
 
+    /// @brief The Compact Vertex struct, represent a two dimensional vertex in a GPU friendly format.
+    /// @note The layout is 20 bytes (position x, y as float, packed RGBA color, texture position u, v as float),
+    /// which match the vertex layout expected by the renderer backends (e.g. SDL_Vertex), so it can be submitted
+    /// without any conversion.
+    struct CompactVertex {
+    public:
+        /// @brief The x position of the Compact Vertex. Default to 0.
+        float X = 0;
+        /// @brief The y position of the Compact Vertex. Default to 0.
+        float Y = 0;
+        /// @brief The Color of the Compact Vertex. Default to White.
+        APE::Color Color = APE::KnownColor::White;
+        /// @brief The x texture position of the Compact Vertex (from 0 to 1). Default to 0.
+        float U = 0;
+        /// @brief The y texture position of the Compact Vertex (from 0 to 1). Default to 0.
+        float V = 0;
+
+        CompactVertex() = default;
+        CompactVertex(float x, float y, const APE::Color& color, float u, float v)
+            : X(x), Y(y), Color(color), U(u), V(v) {}
+        /// @brief Create a new Compact Vertex from the given Vertex, narrowing its position to float.
+        /// @param vertex The Vertex to convert.
+        explicit CompactVertex(const Vertex& vertex)
+            : X((float)vertex.Position.X), Y((float)vertex.Position.Y), Color(vertex.Color),
+              U((float)vertex.TexturePosition.X), V((float)vertex.TexturePosition.Y) {}
+    };
+
+    /// @brief The ISpriteCache, provide an interface for a renderer to cache its own converted data of a Sprite.
+    class ISpriteCache {
+    public:
+        ISpriteCache() = default;
+        virtual ~ISpriteCache() = default;
+
+        APE_NOT_COPY_ASSIGNABLE(ISpriteCache)
+    };
+
+    /// @brief Get the smallest pixel Rectangle covering the given continuous area.
+    /// @param left The minimum x position of the area.
+    /// @param top The minimum y position of the area.
+    /// @param right The maximum x position of the area.
+    /// @param bottom The maximum y position of the area.
+    /// @return The conservative bounds of the area (coordinates are clamped to a safe integer range).
+    Rectangle GetPixelBounds(double left, double top, double right, double bottom);
+
     /// @brief The Sprite class, represent a two-dimensional sprite use for rendering.
     /// @note A sprite is made of triangles.
     class Sprite {
     private:
         std::vector<Vertex> m_vertices;
         std::vector<std::size_t> m_triangles;
+
+        std::size_t m_revision = 0;
+        bool m_renderCacheEnabled = false;
+        mutable std::unique_ptr<ISpriteCache> m_renderCache;
+
+        mutable Rectangle m_bounds;
+        mutable bool m_boundsValid = false;
+        mutable std::size_t m_boundsRevision = 0;
     public:
         /// @brief Create a new empty Sprite.
         Sprite() = default;
+        /// @brief Create a copy of the given Sprite.
+        /// @param sprite The Sprite to copy.
+        /// @note The render cache of the given Sprite is not copied.
+        Sprite(const Sprite& sprite);
+        Sprite(Sprite&&) = default;
+
+        Sprite& operator=(const Sprite& sprite);
+        Sprite& operator=(Sprite&&) = default;
 
         /// @brief Add a vertex to the sprite.
         /// @param vertex The vertex to add.
@@ -55,15 +120,118 @@ namespace APE {
         /// @brief Get a const reference to the vertices.
         const std::vector<Vertex>& GetVertices() const;
         /// @brief Get a reference to the vertices.
+        /// @note This will count as a modification of the Sprite (see GetRevision()).
         std::vector<Vertex>& GetVertices();
 
         /// @brief Get a const reference to the triangle indices.
         const std::vector<std::size_t>& GetTriangles() const;
         /// @brief Get a reference to the triangle indices.
+        /// @note This will count as a modification of the Sprite (see GetRevision()).
         std::vector<std::size_t>& GetTriangles();
+
+        /// @brief Get the revision of the Sprite, which is changed every time the Sprite vertices or
+        /// triangles may have been modified.
+        /// @return The revision of the Sprite.
+        std::size_t GetRevision() const;
+
+        /// @brief Get the conservative bounds of the Sprite vertices, in pixels.
+        /// @return The bounds of the Sprite, or an empty Rectangle if the Sprite has no vertices.
+        /// @note The bounds are cached and only recomputed when the Sprite is modified (see GetRevision()).
+        Rectangle GetBounds() const;
+
+        /// @brief Allow renderers to cache their converted data of the Sprite, until it's modified.
+        /// @note This is useful for Sprite that rarely change, at the cost of the memory of the cache.
+        void EnableRenderCache();
+        /// @brief Disallow renderers to cache their converted data of the Sprite, and release the cache.
+        void DisableRenderCache();
+        /// @brief Check if renderers are allowed to cache their converted data of the Sprite.
+        /// @return true if the render cache is enabled, false otherwise.
+        bool IsRenderCacheEnabled() const;
+
+        /// @brief Get the render cache of the Sprite.
+        /// @return The render cache of the Sprite, or nullptr if there's none.
+        /// @note This was meant to be used by renderers, which should check GetRevision() to know if the
+        /// cache is still valid.
+        ISpriteCache* GetRenderCache() const;
+        /// @brief Set the render cache of the Sprite, the Sprite will take the ownership of the cache.
+        /// @param cache The render cache to set, will do nothing if the render cache is disabled.
+        /// @note This was meant to be used by renderers.
+        void SetRenderCache(std::unique_ptr<ISpriteCache> cache) const;
     };
     
 
+    /// @brief The Compact Sprite template, represent a two-dimensional sprite stored in a GPU friendly format
+    /// (see CompactVertex), that renderers can submit without any conversion.
+    /// @tparam IndexT The type of the triangle indices, must be either uint16_t or uint32_t.
+    /// @note A sprite is made of triangles.
+    template <typename IndexT>
+    class CompactSprite {
+        static_assert(std::is_same<IndexT, uint16_t>::value || std::is_same<IndexT, uint32_t>::value,
+            "CompactSprite: The index type must be either uint16_t or uint32_t!");
+    private:
+        std::vector<CompactVertex> m_vertices;
+        std::vector<IndexT> m_triangles;
+        std::size_t m_revision = 0;
+
+        mutable Rectangle m_bounds;
+        mutable bool m_boundsValid = false;
+        mutable std::size_t m_boundsRevision = 0;
+    public:
+        /// @brief Create a new empty Compact Sprite.
+        CompactSprite() = default;
+        /// @brief Create a new Compact Sprite from the given Sprite.
+        /// @param sprite The Sprite to convert.
+        /// @note The Sprite indices are narrowed to IndexT, throw if the Sprite has more vertices than IndexT
+        /// can index.
+        explicit CompactSprite(const Sprite& sprite);
+
+        /// @brief Add a vertex to the sprite.
+        /// @param vertex The vertex to add.
+        void AddVertex(const CompactVertex& vertex);
+        /// @brief Add a triangle by specifying indices of three vertices.
+        /// @param i0 Index of the first vertex.
+        /// @param i1 Index of the second vertex.
+        /// @param i2 Index of the third vertex.
+        void AddTriangle(IndexT i0, IndexT i1, IndexT i2);
+
+        /// @brief Count the number of vertices in the sprite.
+        /// @return The number of vertices in the sprite.
+        std::size_t VerticesCount() const;
+        /// @brief Count the number of triangles indices in the sprite.
+        /// @return The number of triangles indices in the sprite.
+        std::size_t TrianglesCount() const;
+
+        /// @brief Remove all vertices and triangles from the sprite.
+        void Clear();
+
+        /// @brief Get a const reference to the vertices.
+        const std::vector<CompactVertex>& GetVertices() const;
+        /// @brief Get a reference to the vertices.
+        /// @note This will count as a modification of the Compact Sprite (see GetRevision()).
+        std::vector<CompactVertex>& GetVertices();
+
+        /// @brief Get a const reference to the triangle indices.
+        const std::vector<IndexT>& GetTriangles() const;
+        /// @brief Get a reference to the triangle indices.
+        /// @note This will count as a modification of the Compact Sprite (see GetRevision()).
+        std::vector<IndexT>& GetTriangles();
+
+        /// @brief Get the revision of the Compact Sprite, which is changed every time the vertices or
+        /// triangles may have been modified.
+        /// @return The revision of the Compact Sprite.
+        std::size_t GetRevision() const;
+
+        /// @brief Get the conservative bounds of the Compact Sprite vertices, in pixels.
+        /// @return The bounds of the Compact Sprite, or an empty Rectangle if it has no vertices.
+        /// @note The bounds are cached and only recomputed when the Compact Sprite is modified (see GetRevision()).
+        Rectangle GetBounds() const;
+    };
+
+    /// @brief The Compact Sprite with 16 bit indices, for sprites with at most 65536 vertices.
+    typedef CompactSprite<uint16_t> CompactSprite16;
+    /// @brief The Compact Sprite with 32 bit indices.
+    typedef CompactSprite<uint32_t> CompactSprite32;
+
     /// @brief The IRenderer, provide an interface to create an APE renderer type.
     class IRenderer {
     public:
@@ -84,4 +252,74 @@ namespace APE {
     };
 }
 
+template <typename IndexT>
+APE::CompactSprite<IndexT>::CompactSprite(const APE::Sprite& sprite) {
+    if (sprite.VerticesCount() > 0 && sprite.VerticesCount() - 1 > std::numeric_limits<IndexT>::max())
+        throw std::runtime_error("CompactSprite: Too many vertices for the index type to create!");
+    m_vertices = std::vector<CompactVertex>(sprite.GetVertices().begin(), sprite.GetVertices().end());
+    const std::vector<std::size_t>& triangles = sprite.GetTriangles();
+    m_triangles.reserve(triangles.size());
+    for (std::size_t index : triangles)
+        m_triangles.push_back(static_cast<IndexT>(index));
+}
+
+template <typename IndexT>
+void APE::CompactSprite<IndexT>::AddVertex(const APE::CompactVertex& vertex) {
+    m_vertices.push_back(vertex);
+    m_revision++;
+}
+template <typename IndexT>
+void APE::CompactSprite<IndexT>::AddTriangle(IndexT i0, IndexT i1, IndexT i2) {
+    m_triangles.push_back(i0);
+    m_triangles.push_back(i1);
+    m_triangles.push_back(i2);
+    m_revision++;
+}
+
+template <typename IndexT>
+std::size_t APE::CompactSprite<IndexT>::VerticesCount() const { return m_vertices.size(); }
+template <typename IndexT>
+std::size_t APE::CompactSprite<IndexT>::TrianglesCount() const { return m_triangles.size(); }
+
+template <typename IndexT>
+void APE::CompactSprite<IndexT>::Clear() {
+    m_vertices.clear();
+    m_triangles.clear();
+    m_revision++;
+}
+
+template <typename IndexT>
+const std::vector<APE::CompactVertex>& APE::CompactSprite<IndexT>::GetVertices() const { return m_vertices; }
+template <typename IndexT>
+std::vector<APE::CompactVertex>& APE::CompactSprite<IndexT>::GetVertices() { m_revision++; return m_vertices; }
+
+template <typename IndexT>
+const std::vector<IndexT>& APE::CompactSprite<IndexT>::GetTriangles() const { return m_triangles; }
+template <typename IndexT>
+std::vector<IndexT>& APE::CompactSprite<IndexT>::GetTriangles() { m_revision++; return m_triangles; }
+
+template <typename IndexT>
+std::size_t APE::CompactSprite<IndexT>::GetRevision() const { return m_revision; }
+
+template <typename IndexT>
+APE::Rectangle APE::CompactSprite<IndexT>::GetBounds() const {
+    if (m_boundsValid && m_boundsRevision == m_revision) return m_bounds;
+
+    if (m_vertices.empty()) m_bounds = APE::Rectangle::Empty;
+    else {
+        float left = m_vertices[0].X, top = m_vertices[0].Y;
+        float right = left, bottom = top;
+        for (const APE::CompactVertex& vertex : m_vertices) {
+            left = APE_MIN(left, vertex.X);
+            top = APE_MIN(top, vertex.Y);
+            right = APE_MAX(right, vertex.X);
+            bottom = APE_MAX(bottom, vertex.Y);
+        }
+        m_bounds = APE::GetPixelBounds(left, top, right, bottom);
+    }
+    m_boundsValid = true;
+    m_boundsRevision = m_revision;
+    return m_bounds;
+}
+
 #endif // __APE_RENDERER_H__
\ No newline at end of file
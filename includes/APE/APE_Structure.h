@@ -1,6 +1,10 @@
 #ifndef __APE_STRUCTURE_H__
 #define __APE_STRUCTURE_H__
 
+#include "APE_Define.h"
+
+#include <cmath>
+
 namespace APE {
     class Vector2;
     class Vector3;
@@ -27,47 +31,42 @@ namespace APE {
         int Y = 0;
 
         /// @brief Create a new Point, and set all value to 0.
-        Point();
+        constexpr Point() = default;
         /// @brief Create a new Point, with x and y are both set to the given value.
         /// @param XY The value of x and y to set.
-        Point(int XY);
+        constexpr Point(int XY);
         /// @brief Create a new Point.
         /// @param X The x value (position along the x-axis) of the Point.
         /// @param Y The y value (position along the y-axis) of the Point.
-        Point(int X, int Y);
-
-        /// @brief Create a copy of the given Point.
-        /// @param p The Point to copy.
-        Point(const Point& p);
+        constexpr Point(int X, int Y);
 
-        Point& operator=(const Point& p);
-        Point& operator=(int xy);
+        constexpr Point& operator=(int xy);
 
-        Point& operator+=(const Point& p);
-        Point& operator+=(int xy);
-        Point operator+(const Point& p) const;
-        Point operator+(int xy) const;
-        friend Point operator+(int xy, const Point& p);
+        constexpr Point& operator+=(const Point& p);
+        constexpr Point& operator+=(int xy);
+        constexpr Point operator+(const Point& p) const;
+        constexpr Point operator+(int xy) const;
+        friend constexpr Point operator+(int xy, const Point& p) { return {xy + p.X, xy + p.Y}; }
 
-        Point& operator-=(const Point& p);
-        Point& operator-=(int xy);
-        Point operator-(const Point& p) const;
-        Point operator-(int xy) const;
-        friend Point operator-(int xy, const Point& p);
+        constexpr Point& operator-=(const Point& p);
+        constexpr Point& operator-=(int xy);
+        constexpr Point operator-(const Point& p) const;
+        constexpr Point operator-(int xy) const;
+        friend constexpr Point operator-(int xy, const Point& p) { return {xy - p.X, xy - p.Y}; }
 
-        Point& operator*=(const Point& p);
-        Point& operator*=(int xy);
-        Point operator*(const Point& p) const;
-        Point operator*(int xy) const;
-        friend Point operator*(int xy, const Point& p);
+        constexpr Point& operator*=(const Point& p);
+        constexpr Point& operator*=(int xy);
+        constexpr Point operator*(const Point& p) const;
+        constexpr Point operator*(int xy) const;
+        friend constexpr Point operator*(int xy, const Point& p) { return {xy * p.X, xy * p.Y}; }
 
-        bool operator==(const Point& p) const;
-        bool operator==(int xy) const;
-        friend bool operator==(int xy, const Point& p);
+        constexpr bool operator==(const Point& p) const;
+        constexpr bool operator==(int xy) const;
+        friend constexpr bool operator==(int xy, const Point& p) { return xy == p.X && xy == p.Y; }
 
-        bool operator!=(const Point& p) const;
-        bool operator!=(int xy) const;
-        friend bool operator!=(int xy, const Point& p);
+        constexpr bool operator!=(const Point& p) const;
+        constexpr bool operator!=(int xy) const;
+        friend constexpr bool operator!=(int xy, const Point& p) { return xy != p.X || xy != p.Y; }
 
         /// @brief Calculate the distance between the two given Point.
         /// @param a The first Point (the starting Point).
@@ -98,56 +97,51 @@ namespace APE {
         int Height = 0;
 
         /// @brief Create a new Size, and set all value to 0.
-        Size();
+        constexpr Size() = default;
         /// @brief Create a new Size, with width and height are both set to the given value.
         /// @param WH The value of width and height to set.
-        Size(int WH);
+        constexpr Size(int WH);
         /// @brief Create a new Size.
         /// @param Width The width of the Size (along the x-axis).
         /// @param Height The height of the Size (along the y-axis).
-        Size(int Width, int Height);
+        constexpr Size(int Width, int Height);
         /// @brief Create a new Size, with width and height value are the x and y of the given Point.
         /// @param p The Point to create.
-        Size(const Point& p);
+        constexpr Size(const Point& p);
 
-        /// @brief Create a copy of the given Size.
-        /// @param p The Size to copy.
-        Size(const Size& p);
+        constexpr operator Point() const;
 
-        operator Point() const;
+        constexpr Size& operator=(int wh);
 
-        Size& operator=(const Size& s);
-        Size& operator=(int wh);
+        constexpr Size& operator+=(const Size& s);
+        constexpr Size& operator+=(int wh);
+        constexpr Size operator+(const Size& s) const;
+        constexpr Size operator+(int wh) const;
+        friend constexpr Size operator+(int wh, const Size& s) { return {wh + s.Width, wh + s.Height}; }
 
-        Size& operator+=(const Size& s);
-        Size& operator+=(int wh);
-        Size operator+(const Size& s) const;
-        Size operator+(int wh) const;
-        friend Size operator+(int wh, const Size& s);
+        constexpr Size& operator-=(const Size& s);
+        constexpr Size& operator-=(int wh);
+        constexpr Size operator-(const Size& s) const;
+        constexpr Size operator-(int wh) const;
+        friend constexpr Size operator-(int wh, const Size& s) { return {wh - s.Width, wh - s.Height}; }
 
-        Size& operator-=(const Size& s);
-        Size& operator-=(int wh);
-        Size operator-(const Size& s) const;
-        Size operator-(int wh) const;
-        friend Size operator-(int wh, const Size& s);
+        constexpr Size& operator*=(const Size& s);
+        constexpr Size& operator*=(int wh);
+        constexpr Size operator*(const Size& s) const;
+        constexpr Size operator*(int wh) const;
+        friend constexpr Size operator*(int wh, const Size& s) { return {wh * s.Width, wh * s.Height}; }
 
-        Size& operator*=(const Size& s);
-        Size& operator*=(int wh);
-        Size operator*(const Size& s) const;
-        Size operator*(int wh) const;
-        friend Size operator*(int wh, const Size& s);
+        constexpr bool operator==(const Size& s) const;
+        constexpr bool operator==(int wh) const;
+        friend constexpr bool operator==(int wh, const Size& s) { return wh == s.Width && wh == s.Height; }
 
-        bool operator==(const Size& s) const;
-        bool operator==(int wh) const;
-        friend bool operator==(int wh, const Size& s);
-
-        bool operator!=(const Size& s) const;
-        bool operator!=(int wh) const;
-        friend bool operator!=(int wh, const Size& s);
+        constexpr bool operator!=(const Size& s) const;
+        constexpr bool operator!=(int wh) const;
+        friend constexpr bool operator!=(int wh, const Size& s) { return wh != s.Width || wh != s.Height; }
 
         /// @brief Create a new Size with the width and height value are the absolute value of this Size width and height.
         /// @return The absolute Size of this Size.
-        Size Absolute() const;
+        constexpr Size Absolute() const;
 
         /// @brief Calculate the ratio (width / height) of the Size.
         /// @return The ratio (width / height) of the Size.
@@ -155,11 +149,11 @@ namespace APE {
     
         /// @brief Check if the area of the Size represent is 0.
         /// @return true if the Size area is empty, false otherwise.
-        bool IsEmptyArea() const;
+        constexpr bool IsEmptyArea() const;
 
         /// @brief Calculate the area that the Size represent.
         /// @return The area of the Size.
-        long long Area() const;
+        constexpr long long Area() const;
 
         /// @brief Create a new Size with the given ratio (width / height).
         /// @param Ratio The ratio of the size (width / height) to create.
@@ -201,170 +195,166 @@ namespace APE {
         int Height = 0;
 
         /// @brief Create a new empty Rectangle.
-        Rectangle();
+        constexpr Rectangle() = default;
         /// @brief Create a new Rectangle.
         /// @param p The position of the Rectangle (usually top-left) corner.
         /// @param s The size of the Rectangle.
-        Rectangle(const Point& p, const Size& s);
+        constexpr Rectangle(const Point& p, const Size& s);
         /// @brief Create a new Rectangle.
         /// @param x The x position of the Rectangle (usually top-left) corner.
         /// @param y The y position of the Rectangle (usually top-left) corner.
         /// @param w The width of the Rectangle (along the x direction).
         /// @param h The height of the Rectangle (along the y direction).
-        Rectangle(int x, int y, int w, int h);
-
-        Rectangle(const Rectangle& r);
+        constexpr Rectangle(int x, int y, int w, int h);
 
-        operator Point() const;
-        operator Size() const;
-
-        Rectangle& operator=(const Rectangle& r);
+        constexpr operator Point() const;
+        constexpr operator Size() const;
 
         /// @brief Get a top-left Rectangle that identical to this Rectangle.
         /// @return A top-left Rectangle that identical to this Rectangle.
-        Rectangle TopLeftRectangle() const;
+        constexpr Rectangle TopLeftRectangle() const;
 
         /// @brief Check if this Rectangle is a top-left Rectangle.
         /// @return true if this Rectangle is a top-left Rectangle, false otherwise.
-        bool IsTopLeftRectangle() const;
+        constexpr bool IsTopLeftRectangle() const;
         /// @brief Check if this Rectangle is a top-right Rectangle.
         /// @return true if this Rectangle is a top-right Rectangle, false otherwise.
-        bool IsTopRightRectangle() const;
+        constexpr bool IsTopRightRectangle() const;
         /// @brief Check if this Rectangle is a bottom-left Rectangle.
         /// @return true if this Rectangle is a bottom-left Rectangle, false otherwise.
-        bool IsBottomLeftRectangle() const;
+        constexpr bool IsBottomLeftRectangle() const;
         /// @brief Check if this Rectangle is a bottom-right Rectangle.
         /// @return true if this Rectangle is a bottom-right Rectangle, false otherwise.
-        bool IsBottomRightRectangle() const;
+        constexpr bool IsBottomRightRectangle() const;
 
         /// @brief Check if the area of the Rectangle is 0.
         /// @return true if the area of the Rectangle is empty, false otherwise.
-        bool IsEmptyArea() const;
+        constexpr bool IsEmptyArea() const;
         /// @brief Calculate the area of the Rectangle.
         /// @return The area of the Rectangle.
-        long long Area() const;
+        constexpr long long Area() const;
 
         /// @brief Set the position of the Rectangle (usually top-left) corner.
         /// @param p The position to set.
-        void SetPosition(const Point& p);
+        constexpr void SetPosition(const Point& p);
         /// @brief Get the position of the Rectangle (usually top-left) corner.
         /// @return The position of the Rectangle.
-        Point GetPosition() const;
+        constexpr Point GetPosition() const;
 
         /// @brief Set the size of the Rectangle.
         /// @param s The size to set.
-        void SetSize(const Size& s);
+        constexpr void SetSize(const Size& s);
         /// @brief Get the size of the Rectangle.
         /// @return The size of the Rectangle.
-        Size GetSize() const;
+        constexpr Size GetSize() const;
         /// @brief Get the absolute size of the Rectangle (similar to GetSize().Absolute()).
         /// @return The absolute size of the Rectangle.
-        Size GetAbsoluteSize() const;
+        constexpr Size GetAbsoluteSize() const;
 
         /// @brief Get the position (along the x direction) of the left side of the Rectangle.
         /// @return The position of the left side of the Rectangle.
-        int LeftSide() const;
+        constexpr int LeftSide() const;
         /// @brief Get the position (along the x direction) of the right side of the Rectangle.
         /// @return The position of the right side of the Rectangle.
-        int RightSide() const;
+        constexpr int RightSide() const;
         /// @brief Get the position (along the x direction) of the center between the left and right the Rectangle.
         /// @return The position of the center between left and right side of the Rectangle.
-        int CenterSide() const;
+        constexpr int CenterSide() const;
         /// @brief Get the position (along the y direction) of the top side of the Rectangle.
         /// @return The position of the top side of the Rectangle.
-        int TopSide() const;
+        constexpr int TopSide() const;
         /// @brief Get the position (along the y direction) of the bottom side of the Rectangle.
         /// @return The position of the bottom side of the Rectangle.
-        int BottomSide() const;
+        constexpr int BottomSide() const;
         /// @brief Get the position (along the y direction) of the middle between the top and bottom the Rectangle.
         /// @return The position of the middle between top and bottom side of the Rectangle.
-        int MiddleSide() const;
+        constexpr int MiddleSide() const;
 
         /// @brief Get the top-left corner position of the Rectangle.
         /// @return The top-left position of the Rectangle.
-        Point TopLeft() const;
+        constexpr Point TopLeft() const;
         /// @brief Get the top-center position of the Rectangle.
         /// @return The top-center position of the Rectangle.
-        Point TopCenter() const;
+        constexpr Point TopCenter() const;
         /// @brief Get the top-right corner position of the Rectangle.
         /// @return The top-right position of the Rectangle.
-        Point TopRight() const;
+        constexpr Point TopRight() const;
         /// @brief Get the middle-left position of the Rectangle.
         /// @return The middle-left position of the Rectangle.
-        Point MiddleLeft() const;
+        constexpr Point MiddleLeft() const;
         /// @brief Get the middle-center position of the Rectangle.
         /// @return The middle-center position of the Rectangle.
-        Point MiddleCenter() const;
+        constexpr Point MiddleCenter() const;
         /// @brief Get the middle-right position of the Rectangle.
         /// @return The middle-right position of the Rectangle.
-        Point MiddleRight() const;
+        constexpr Point MiddleRight() const;
         /// @brief Get the bottom-left corner position of the Rectangle.
         /// @return The bottom-left position of the Rectangle.
-        Point BottomLeft() const;
+        constexpr Point BottomLeft() const;
         /// @brief Get the bottom-center position of the Rectangle.
         /// @return The bottom-center position of the Rectangle.
-        Point BottomCenter() const;
+        constexpr Point BottomCenter() const;
         /// @brief Get the bottom-right corner position of the Rectangle.
         /// @return The bottom-right position of the Rectangle.
-        Point BottomRight() const;
+        constexpr Point BottomRight() const;
 
         /// @brief Check if the Rectangle is contain the given Point.
         /// @param p The Point to check.
         /// @return true if the Rectangle is contain the given Point, false otherwise.
-        bool IsContain(const Point& p) const;
+        constexpr bool IsContain(const Point& p) const;
         /// @brief Check if the Rectangle is contain the given Rectangle.
         /// @param r The Rectangle to check.
         /// @return true if this Rectangle is contain the given Rectangle, false otherwise.
-        bool IsContain(const Rectangle& r) const;
+        constexpr bool IsContain(const Rectangle& r) const;
 
         /// @brief Calculate the smallest Rectangle that contain this Rectangle and the given Point.
         /// @param p The Point to calculate.
         /// @return The smallest Rectangle that contain both this Rectangle and the given Point.
-        Rectangle UnionWith(const Point& p) const;
+        constexpr Rectangle UnionWith(const Point& p) const;
         /// @brief Calculate the smallest Rectangle that contain this Rectangle and the given Rectangle.
         /// @param p The other Rectangle to calculate.
         /// @return The smallest Rectangle that contain both this and the given Rectangle.
-        Rectangle UnionWith(const Rectangle& r) const;
+        constexpr Rectangle UnionWith(const Rectangle& r) const;
 
         /// @brief Calculate the global position of a local position that related to this Rectangle.
         /// @param LocalPosition The local position to calculate. (0, 0) mean the Rectangle top-left corner.
         /// @return The global position of the given local position that related to this Rectangle.
-        Point LocalToGlobal(const Point& LocalPosition) const;
+        constexpr Point LocalToGlobal(const Point& LocalPosition) const;
         /// @brief Calculate the global rectangle of a local rectangle that related to this Rectangle.
         /// @param LocalRectangle The local rectangle to calculate.
         /// @param Alignment The alignment that the given Rectangle is related to this Rectangle. Default is TopLeft.
         /// @return The global rectangle of the given local rectangle that related to this Rectangle.
-        Rectangle LocalToGlobal(const Rectangle& LocalRectangle, RectangleAlignment Alignment = RectangleAlignment::TopLeft) const;
+        constexpr Rectangle LocalToGlobal(const Rectangle& LocalRectangle, RectangleAlignment Alignment = RectangleAlignment::TopLeft) const;
 
         /// @brief Calculate the local position that related to this Rectangle from a global position.
         /// @param GlobalPosition The global position to calculate.
         /// @return The local position that related to this Rectangle ((0, 0) mean the Rectangle top-left corner)
         /// of the given global position.
-        Point GlobalToLocal(const Point& GlobalPosition) const;
+        constexpr Point GlobalToLocal(const Point& GlobalPosition) const;
 
         /// @brief Calculate the smallest Rectangle that contain the two given Point.
         /// @param a The first Point.
         /// @param b The second Point.
         /// @return The result Rectangle.
-        static Rectangle FromTwoPoint(const Point& a, const Point& b);
+        static constexpr Rectangle FromTwoPoint(const Point& a, const Point& b);
 
         /// @brief Calculate the intersection of the given two Rectangle.
         /// @param r1 The first Rectangle.
         /// @param r2 The second Rectangle.
         /// @return The Rectangle represent the intersection, or an empty Rectangle if there're no intersection.
-        static Rectangle Intersect(const Rectangle& r1, const Rectangle& r2);
+        static constexpr Rectangle Intersect(const Rectangle& r1, const Rectangle& r2);
 
         /// @brief Calculate the smallest Rectangle that contain the two given Rectangle and Point.
         /// @param r The given Rectangle to calculate.
         /// @param p The given Point to calculate.
         /// @return The smallest Rectangle that contain the two given Rectangle and Point.
-        static Rectangle Union(const Rectangle& r, const Point& p);
+        static constexpr Rectangle Union(const Rectangle& r, const Point& p);
 
         /// @brief Calculate the smallest Rectangle that contain the two given Rectangle.
         /// @param r1 The first Rectangle.
         /// @param r2 The second Rectangle.
         /// @return The smallest Rectangle that contain the two given Rectangle.
-        static Rectangle Union(const Rectangle& r1, const Rectangle& r2);
+        static constexpr Rectangle Union(const Rectangle& r1, const Rectangle& r2);
 
         /// @brief The empty Rectangle with all value are 0.
         static const Rectangle Empty;
@@ -379,29 +369,27 @@ namespace APE {
         double Y = 0;
 
         /// @brief Default constructor. Initializes x and y to 0.
-        Vector2() = default;
+        constexpr Vector2() = default;
         /// @brief Construct a Vector2 with given x and y.
         /// @param x X component
         /// @param y Y component
-        Vector2(double x, double y);
+        constexpr Vector2(double x, double y);
 
-        Vector2 operator+(const Vector2& right) const;
-        Vector2& operator+=(const Vector2& right);
+        constexpr Vector2 operator+(const Vector2& right) const;
+        constexpr Vector2& operator+=(const Vector2& right);
         
-        Vector2 operator-(const Vector2& right) const;
-        Vector2& operator-=(const Vector2& right);
+        constexpr Vector2 operator-(const Vector2& right) const;
+        constexpr Vector2& operator-=(const Vector2& right);
         
-        Vector2 operator*(double scalar) const;
-        Vector2& operator*=(double scalar);
-        Vector3 operator*(const Vector2& right) const;
-
-        Vector2& operator=(const Vector2& right);
+        constexpr Vector2 operator*(double scalar) const;
+        constexpr Vector2& operator*=(double scalar);
+        constexpr Vector3 operator*(const Vector2& right) const;
 
-        bool operator==(const Vector2& right) const;
-        bool operator!=(const Vector2& right) const;
+        constexpr bool operator==(const Vector2& right) const;
+        constexpr bool operator!=(const Vector2& right) const;
 
         /// @brief Computes the dot product of two Vector2s.
-        static double DotProduct(const Vector2& left, const Vector2& right);
+        static constexpr double DotProduct(const Vector2& left, const Vector2& right);
 
         /// @brief Constant vector (0, 0)
         static const Vector2 Zero;
@@ -428,37 +416,35 @@ namespace APE {
         double Z = 0;
 
         /// @brief Default constructor. Initializes x, y, z to 0.
-        Vector3();
+        constexpr Vector3() = default;
         /// @brief Construct a Vector3 with given x, y, z.
         /// @param x X component
         /// @param y Y component
         /// @param z Z component
-        Vector3(double x, double y, double z);
+        constexpr Vector3(double x, double y, double z);
         /// @brief Construct a Vector3 from a Vector2 and z value.
         /// @param v2 2D vector
         /// @param z Z component (default 0.0)
-        Vector3(const Vector2& v2, double z = 0.0);
+        constexpr Vector3(const Vector2& v2, double z = 0.0);
 
-        operator Vector2() const;
+        constexpr operator Vector2() const;
 
-        Vector3 operator+(const Vector3& right) const;
-        Vector3& operator+=(const Vector3& right);
+        constexpr Vector3 operator+(const Vector3& right) const;
+        constexpr Vector3& operator+=(const Vector3& right);
 
-        Vector3 operator-(const Vector3& right) const;
-        Vector3& operator-=(const Vector3& right);
+        constexpr Vector3 operator-(const Vector3& right) const;
+        constexpr Vector3& operator-=(const Vector3& right);
         
-        Vector3 operator*(double scalar) const;
-        Vector3 operator*(const Vector3& right) const;
-        Vector3& operator*=(double scalar);
-        Vector3& operator*=(const Vector3& right);
-
-        Vector3& operator=(const Vector3& right);
+        constexpr Vector3 operator*(double scalar) const;
+        constexpr Vector3 operator*(const Vector3& right) const;
+        constexpr Vector3& operator*=(double scalar);
+        constexpr Vector3& operator*=(const Vector3& right);
 
-        bool operator==(const Vector3& right) const;
-        bool operator!=(const Vector3& right) const;
+        constexpr bool operator==(const Vector3& right) const;
+        constexpr bool operator!=(const Vector3& right) const;
 
         /// @brief Computes the dot product of two Vector3s.
-        static double DotProduct(const Vector3& left, const Vector3& right);
+        static constexpr double DotProduct(const Vector3& left, const Vector3& right);
 
         /// @brief Constant vector (0, 0, 0)
         static const Vector3 Zero;
@@ -480,4 +466,322 @@ namespace APE {
 
 }
 
+//* --- APE::Point ---
+
+constexpr APE::Point::Point(int XY) : X(XY), Y(XY) {}
+constexpr APE::Point::Point(int X, int Y) : X(X), Y(Y) {}
+
+constexpr APE::Point& APE::Point::operator=(int xy) { X = xy; Y = xy; return *this; }
+
+constexpr APE::Point& APE::Point::operator+=(const APE::Point& p) { X += p.X; Y += p.Y; return *this; }
+constexpr APE::Point& APE::Point::operator+=(int xy) { X += xy; Y += xy; return *this; }
+constexpr APE::Point APE::Point::operator+(const APE::Point& p) const { return {X + p.X, Y + p.Y}; }
+constexpr APE::Point APE::Point::operator+(int xy) const { return {X + xy, Y + xy}; }
+
+constexpr APE::Point& APE::Point::operator-=(const APE::Point& p) { X -= p.X; Y -= p.Y; return *this; }
+constexpr APE::Point& APE::Point::operator-=(int xy) { X -= xy; Y -= xy; return *this; }
+constexpr APE::Point APE::Point::operator-(const APE::Point& p) const { return {X - p.X, Y - p.Y}; }
+constexpr APE::Point APE::Point::operator-(int xy) const { return {X - xy, Y - xy}; }
+
+constexpr APE::Point& APE::Point::operator*=(const APE::Point& p) { X *= p.X; Y *= p.Y; return *this; }
+constexpr APE::Point& APE::Point::operator*=(int xy) { X *= xy; Y *= xy; return *this; }
+constexpr APE::Point APE::Point::operator*(const APE::Point& p) const { return {X * p.X, Y * p.Y}; }
+constexpr APE::Point APE::Point::operator*(int xy) const { return {X * xy, Y * xy}; }
+
+constexpr bool APE::Point::operator==(const APE::Point& p) const { return X == p.X && Y == p.Y; }
+constexpr bool APE::Point::operator==(int xy) const { return X == xy && Y == xy; }
+
+constexpr bool APE::Point::operator!=(const APE::Point& p) const { return X != p.X || Y != p.Y; }
+constexpr bool APE::Point::operator!=(int xy) const { return X != xy || Y != xy; }
+
+inline double APE::Point::Distance(const APE::Point& a, const APE::Point& b) { return std::hypot(b.X - a.X, b.Y - a.Y); }
+
+inline constexpr APE::Point APE::Point::Zero = APE::Point(0, 0);
+inline constexpr APE::Point APE::Point::One = APE::Point(1, 1);
+inline constexpr APE::Point APE::Point::Up = APE::Point(0, 1);
+inline constexpr APE::Point APE::Point::Down = APE::Point(0, -1);
+inline constexpr APE::Point APE::Point::Left = APE::Point(-1, 0);
+inline constexpr APE::Point APE::Point::Right = APE::Point(1, 0);
+
+//* --- APE::Size ---
+
+constexpr APE::Size::Size(int WH) : Width(WH), Height(WH) {}
+constexpr APE::Size::Size(int Width, int Height) : Width(Width), Height(Height) {}
+constexpr APE::Size::Size(const APE::Point& p) : Width(p.X), Height(p.Y) {}
+
+constexpr APE::Size::operator Point() const { return Point(Width, Height); }
+
+constexpr APE::Size& APE::Size::operator=(int wh) { Width = wh; Height = wh; return *this; }
+
+constexpr APE::Size& APE::Size::operator+=(const Size& s) { Width += s.Width; Height += s.Height; return *this; }
+constexpr APE::Size& APE::Size::operator+=(int wh) { Width += wh; Height += wh; return *this; }
+constexpr APE::Size APE::Size::operator+(const Size& s) const { return {Width + s.Width, Height + s.Height}; }
+constexpr APE::Size APE::Size::operator+(int wh) const { return {Width + wh, Height + wh}; }
+
+constexpr APE::Size& APE::Size::operator-=(const Size& s) { Width -= s.Width; Height -= s.Height; return *this; }
+constexpr APE::Size& APE::Size::operator-=(int wh) { Width -= wh; Height -= wh; return *this; }
+constexpr APE::Size APE::Size::operator-(const Size& s) const { return {Width - s.Width, Height - s.Height}; }
+constexpr APE::Size APE::Size::operator-(int wh) const { return {Width - wh, Height - wh}; }
+
+constexpr APE::Size& APE::Size::operator*=(const Size& s) { Width *= s.Width; Height *= s.Height; return *this; }
+constexpr APE::Size& APE::Size::operator*=(int wh) { Width *= wh; Height *= wh; return *this; }
+constexpr APE::Size APE::Size::operator*(const Size& s) const { return {Width * s.Width, Height * s.Height}; }
+constexpr APE::Size APE::Size::operator*(int wh) const { return {Width * wh, Height * wh}; }
+
+constexpr bool APE::Size::operator==(const Size& s) const { return Width == s.Width && Height == s.Height; }
+constexpr bool APE::Size::operator==(int wh) const { return Width == wh && Height == wh; }
+
+constexpr bool APE::Size::operator!=(const Size& s) const { return Width != s.Width || Height != s.Height; }
+constexpr bool APE::Size::operator!=(int wh) const { return Width != wh || Height != wh; }
+
+constexpr APE::Size APE::Size::Absolute() const { return Size(APE_ABS(Width), APE_ABS(Height)); }
+inline double APE::Size::Ratio() const { return std::fabs(Width) / std::fabs(Height); }
+constexpr bool APE::Size::IsEmptyArea() const { return Width == 0 || Height == 0; }
+constexpr long long APE::Size::Area() const { return APE_ABS((long long)Width) * APE_ABS((long long)Height); }
+
+inline APE::Size APE::Size::FromRatio(double Ratio, int Height) { return Size((int)std::abs(Ratio * Height), APE_ABS(Height)); }
+inline APE::Size APE::Size::FromRatioWithWidth(double Ratio, int Width) { return Size(APE_ABS(Width), (int)std::abs((double)Width / Ratio)); }
+
+inline constexpr APE::Size APE::Size::Zero = APE::Size(0, 0);
+inline constexpr APE::Size APE::Size::One = APE::Size(1, 1);
+inline constexpr APE::Size APE::Size::Up = APE::Size(0, 1);
+inline constexpr APE::Size APE::Size::Down = APE::Size(0, -1);
+inline constexpr APE::Size APE::Size::Left = APE::Size(-1, 0);
+inline constexpr APE::Size APE::Size::Right = APE::Size(1, 0);
+
+//* --- APE::Rectangle ---
+
+constexpr APE::Rectangle::Rectangle(const APE::Point& p, const APE::Size& s) : X(p.X), Y(p.Y), Width(s.Width), Height(s.Height) {}
+constexpr APE::Rectangle::Rectangle(int x, int y, int w, int h) : X(x), Y(y), Width(w), Height(h) {}
+
+constexpr APE::Rectangle::operator Point() const { return {X, Y}; }
+constexpr APE::Rectangle::operator Size() const { return {Width, Height}; }
+
+constexpr APE::Rectangle APE::Rectangle::TopLeftRectangle() const { return {LeftSide(), RightSide(), APE_ABS(Width), APE_ABS(Height)}; }
+
+constexpr bool APE::Rectangle::IsTopLeftRectangle() const { return Width >= 0 && Height >= 0; }
+constexpr bool APE::Rectangle::IsTopRightRectangle() const { return Width < 0 && Height >= 0; }
+constexpr bool APE::Rectangle::IsBottomLeftRectangle() const { return Width >= 0 && Height < 0; }
+constexpr bool APE::Rectangle::IsBottomRightRectangle() const { return Width < 0 && Height < 0; }
+
+constexpr bool APE::Rectangle::IsEmptyArea() const { return Width == 0 || Height == 0; }
+constexpr long long APE::Rectangle::Area() const { return APE_ABS((long long)Width) * APE_ABS((long long)Height); }
+
+constexpr void APE::Rectangle::SetPosition(const Point& p) { X = p.X; Y = p.Y; }
+constexpr APE::Point APE::Rectangle::GetPosition() const { return {X, Y}; }
+constexpr void APE::Rectangle::SetSize(const Size& s) { Width = s.Width; Height = s.Height; }
+constexpr APE::Size APE::Rectangle::GetSize() const { return {Width, Height}; }
+constexpr APE::Size APE::Rectangle::GetAbsoluteSize() const { return {APE_ABS(Width), APE_ABS(Height)}; }
+
+constexpr int APE::Rectangle::LeftSide() const { return Width < 0 ? X + Width + 1 : X; }
+constexpr int APE::Rectangle::RightSide() const { return Width > 0 ? X + Width - 1 : X; }
+constexpr int APE::Rectangle::CenterSide() const { return X + (Width / 2); }
+constexpr int APE::Rectangle::TopSide() const { return Height < 0 ? Y + Height + 1 : Y; }
+constexpr int APE::Rectangle::BottomSide() const { return Height > 0 ? Y + Height - 1 : Y; }
+constexpr int APE::Rectangle::MiddleSide() const { return X + (Height / 2); }
+
+constexpr APE::Point APE::Rectangle::TopLeft() const { return {LeftSide(), TopSide()}; }
+constexpr APE::Point APE::Rectangle::TopCenter() const { return {CenterSide(), TopSide()}; }
+constexpr APE::Point APE::Rectangle::TopRight() const { return {RightSide(), TopSide()}; }
+constexpr APE::Point APE::Rectangle::MiddleLeft() const { return {LeftSide(), MiddleSide()}; }
+constexpr APE::Point APE::Rectangle::MiddleCenter() const { return {CenterSide(), MiddleSide()}; }
+constexpr APE::Point APE::Rectangle::MiddleRight() const { return {RightSide(), MiddleSide()}; }
+constexpr APE::Point APE::Rectangle::BottomLeft() const { return {LeftSide(), BottomSide()}; }
+constexpr APE::Point APE::Rectangle::BottomCenter() const { return {CenterSide(), BottomSide()}; }
+constexpr APE::Point APE::Rectangle::BottomRight() const { return {RightSide(), BottomSide()}; }
+
+constexpr bool APE::Rectangle::IsContain(const APE::Point& p) const {
+    return p.X >= LeftSide() && p.X <= RightSide() && p.Y >= TopSide() && p.Y <= BottomSide();
+}
+constexpr bool APE::Rectangle::IsContain(const APE::Rectangle& r) const {
+    int left = LeftSide(), right = RightSide(), top = TopSide(), bottom = BottomSide();
+    Point tl = r.TopLeft(), br = r.BottomRight();
+    return tl.X >= left && tl.X <= right && tl.Y >= top && tl.Y <= bottom   // Top-Left check
+        && br.X >= left && br.X <= right && br.Y >= top && br.Y <= bottom;  // Bottom-Right check
+}
+
+constexpr APE::Rectangle APE::Rectangle::UnionWith(const Point& p) const { return Union(*this, p); }
+constexpr APE::Rectangle APE::Rectangle::UnionWith(const Rectangle& r) const { return Union(*this, r); }
+
+constexpr APE::Point APE::Rectangle::LocalToGlobal(const Point& LocalPosition) const { return Point(LocalPosition.X + LeftSide(), LocalPosition.Y + TopSide()); }
+constexpr APE::Rectangle APE::Rectangle::LocalToGlobal(const Rectangle& LocalRectangle, APE::RectangleAlignment Alignment) const {
+    switch (Alignment)
+    {
+    case RectangleAlignment::TopCenter:
+        return Rectangle(
+            LeftSide() + LocalRectangle.LeftSide() + ((APE_ABS(Width) - APE_ABS(LocalRectangle.Width)) / 2),
+            TopSide() + LocalRectangle.TopSide(),
+            APE_ABS(LocalRectangle.Width), APE_ABS(LocalRectangle.Height));
+    case RectangleAlignment::TopRight:
+        return Rectangle(
+            LeftSide() + LocalRectangle.LeftSide() + (APE_ABS(Width) - APE_ABS(LocalRectangle.Width)),
+            TopSide() + LocalRectangle.TopSide(),
+            APE_ABS(LocalRectangle.Width), APE_ABS(LocalRectangle.Height));
+    case RectangleAlignment::MiddleLeft:
+        return Rectangle(
+            LeftSide() + LocalRectangle.LeftSide(),
+            TopSide() + LocalRectangle.TopSide() + ((APE_ABS(Height) - APE_ABS(LocalRectangle.Height)) / 2),
+            APE_ABS(LocalRectangle.Width), APE_ABS(LocalRectangle.Height));
+    case RectangleAlignment::MiddleCenter:
+        return Rectangle(
+            LeftSide() + LocalRectangle.LeftSide() + ((APE_ABS(Width) - APE_ABS(LocalRectangle.Width)) / 2),
+            TopSide() + LocalRectangle.TopSide() + ((APE_ABS(Height) - APE_ABS(LocalRectangle.Height)) / 2),
+            APE_ABS(LocalRectangle.Width), APE_ABS(LocalRectangle.Height));
+    case RectangleAlignment::MiddleRight:
+        return Rectangle(
+            LeftSide() + LocalRectangle.LeftSide() + (APE_ABS(Width) - APE_ABS(LocalRectangle.Width)),
+            TopSide() + LocalRectangle.TopSide() + ((APE_ABS(Height) - APE_ABS(LocalRectangle.Height)) / 2),
+            APE_ABS(LocalRectangle.Width), APE_ABS(LocalRectangle.Height));
+    case RectangleAlignment::BottomLeft:
+        return Rectangle(
+            LeftSide() + LocalRectangle.LeftSide(),
+            TopSide() + LocalRectangle.TopSide() + (APE_ABS(Height) - APE_ABS(LocalRectangle.Height)),
+            APE_ABS(LocalRectangle.Width), APE_ABS(LocalRectangle.Height));
+    case RectangleAlignment::BottomCenter:
+        return Rectangle(
+            LeftSide() + LocalRectangle.LeftSide() + ((APE_ABS(Width) - APE_ABS(LocalRectangle.Width)) / 2),
+            TopSide() + LocalRectangle.TopSide() + (APE_ABS(Height) - APE_ABS(LocalRectangle.Height)),
+            APE_ABS(LocalRectangle.Width), APE_ABS(LocalRectangle.Height));
+    case RectangleAlignment::BottomRight:
+        return Rectangle(
+            LeftSide() + LocalRectangle.LeftSide() + (APE_ABS(Width) - APE_ABS(LocalRectangle.Width)),
+            TopSide() + LocalRectangle.TopSide() + (APE_ABS(Height) - APE_ABS(LocalRectangle.Height)),
+            APE_ABS(LocalRectangle.Width), APE_ABS(LocalRectangle.Height));
+    default:
+        return Rectangle(
+            LeftSide() + LocalRectangle.LeftSide(),
+            TopSide() + LocalRectangle.TopSide(),
+            APE_ABS(LocalRectangle.Width), APE_ABS(LocalRectangle.Height));
+    }
+}
+
+constexpr APE::Point APE::Rectangle::GlobalToLocal(const APE::Point& GlobalPosition) const { return APE::Point(GlobalPosition.X - LeftSide(), GlobalPosition.Y - TopSide()); }
+constexpr APE::Rectangle APE::Rectangle::FromTwoPoint(const Point& a, const Point& b) {
+    return {APE_MIN(a.X, b.X), APE_MIN(a.Y, b.Y), APE_ABS(b.X - a.X) + 1, APE_ABS(b.Y - a.Y) + 1};
+}
+constexpr APE::Rectangle APE::Rectangle::Intersect(const APE::Rectangle& r1, const APE::Rectangle& r2) {
+    if (r1.IsEmptyArea() || r2.IsEmptyArea())
+        return Rectangle::Empty;
+    Point tl1 = r1.TopLeft(), tl2 = r2.TopLeft(), br1 = r1.BottomRight(), br2 = r2.BottomRight();
+    int left = APE_MAX(tl1.X, tl2.X), top = APE_MAX(tl1.Y, tl2.Y), right = APE_MIN(br1.X, br2.X), bottom = APE_MIN(br1.Y, br2.Y);
+    if (right < left || bottom < top) return Rectangle::Empty;
+    return {left, top, right - left + 1, bottom - top + 1};
+}
+constexpr APE::Rectangle APE::Rectangle::Union(const APE::Rectangle& r, const APE::Point& p) {
+    if (r.IsEmptyArea())
+        return FromTwoPoint(r.GetPosition(), p);
+    int left = r.LeftSide(), top = r.TopSide(), right = r.RightSide(), bottom = r.BottomSide();
+    int x = APE_MIN(left, p.X), y = APE_MIN(top, p.Y);
+    return {x, y, APE_MAX(right, p.X) - x + 1,  APE_MAX(bottom, p.Y) - y + 1};
+}
+constexpr APE::Rectangle APE::Rectangle::Union(const APE::Rectangle& r1, const APE::Rectangle& r2) {
+    if (r1.IsEmptyArea())
+        return Union(r2, r1.GetPosition());
+    if (r2.IsEmptyArea())
+        return Union(r1, r2.GetPosition());
+    int left1 = r1.LeftSide(), top1 = r1.TopSide(), right1 = r1.RightSide(), bottom1 = r1.BottomSide();
+    int left2 = r2.LeftSide(), top2 = r2.TopSide(), right2 = r2.RightSide(), bottom2 = r2.BottomSide();
+    int x = APE_MIN(left1, left2), y = APE_MIN(top1, top2);
+    return {x, y, APE_MAX(right1, right2) - x + 1, APE_MAX(bottom1, bottom2) - y + 1};
+}
+
+inline constexpr APE::Rectangle APE::Rectangle::Empty = APE::Rectangle(0, 0, 0, 0);
+
+//* ---- Vector2 ----
+
+constexpr APE::Vector2::Vector2(double x, double y) : X(x), Y(y) {}
+
+constexpr APE::Vector2& APE::Vector2::operator+=(const Vector2& right) { X += right.X; Y += right.Y; return *this; }
+constexpr APE::Vector2 APE::Vector2::operator+(const Vector2& right) const {
+    return Vector2(X + right.X, Y + right.Y);
+}
+constexpr APE::Vector2& APE::Vector2::operator-=(const Vector2& right) { X -= right.X; Y -= right.Y; return *this; }
+constexpr APE::Vector2 APE::Vector2::operator-(const Vector2& right) const {
+    return Vector2(X - right.X, Y - right.Y);
+}
+
+constexpr APE::Vector2& APE::Vector2::operator*=(double scalar) { X *= scalar; Y *= scalar; return *this; }
+constexpr APE::Vector2 APE::Vector2::operator*(double scalar) const {
+    return Vector2(X * scalar, Y * scalar);
+}
+
+constexpr APE::Vector3 APE::Vector2::operator*(const Vector2& right) const {
+    return Vector3(0, 0, X * right.Y - Y * right.X);
+}
+
+constexpr double APE::Vector2::DotProduct(const Vector2& left, const Vector2& right) {
+    return left.X * right.X + left.Y * right.Y;
+}
+constexpr bool APE::Vector2::operator==(const Vector2& right) const {
+    return X == right.X && Y == right.Y;
+}
+constexpr bool APE::Vector2::operator!=(const Vector2& right) const {
+    return !(*this == right);
+}
+
+// ---- Vector2 constants ----
+inline constexpr APE::Vector2 APE::Vector2::Zero     = APE::Vector2(0.0, 0.0);
+inline constexpr APE::Vector2 APE::Vector2::One      = APE::Vector2(1.0, 1.0);
+inline constexpr APE::Vector2 APE::Vector2::Left     = APE::Vector2(-1.0, 0.0);
+inline constexpr APE::Vector2 APE::Vector2::Right    = APE::Vector2(1.0, 0.0);
+inline constexpr APE::Vector2 APE::Vector2::Up       = APE::Vector2(0.0, 1.0);
+inline constexpr APE::Vector2 APE::Vector2::Down     = APE::Vector2(0.0, -1.0);
+
+//* ---- Vector3 ----
+
+constexpr APE::Vector3::Vector3(double x, double y, double z) : X(x), Y(y), Z(z) {}
+constexpr APE::Vector3::Vector3(const Vector2& v2, double z) : X(v2.X), Y(v2.Y), Z(z) {}
+
+constexpr APE::Vector3& APE::Vector3::operator+=(const Vector3& right) { X += right.X; Y += right.Y; Z += right.Z; return *this; }
+constexpr APE::Vector3 APE::Vector3::operator+(const Vector3& right) const {
+    return Vector3(X + right.X, Y + right.Y, Z + right.Z);
+}
+
+constexpr APE::Vector3& APE::Vector3::operator-=(const Vector3& right) { X -= right.X; Y -= right.Y; Z -= right.Z; return *this; }
+constexpr APE::Vector3 APE::Vector3::operator-(const Vector3& right) const {
+    return Vector3(X - right.X, Y - right.Y, Z - right.Z);
+}
+
+constexpr APE::Vector3& APE::Vector3::operator*=(double scalar) { X *= scalar; Y *= scalar; Z *= scalar; return *this; }
+constexpr APE::Vector3 APE::Vector3::operator*(double scalar) const {
+    return APE::Vector3(X * scalar, Y * scalar, Z * scalar);
+}
+constexpr APE::Vector3& APE::Vector3::operator*=(const Vector3& right) {
+    double tmp_x = 0, tmp_y = 0, tmp_z = 0;
+    tmp_x = Y * right.Z - Z * right.Y;
+    tmp_y = Z * right.X - X * right.Z;
+    tmp_z = X * right.Y - Y * right.X;
+    X = tmp_x; Y = tmp_y; Z = tmp_z;
+    return *this;
+}
+constexpr APE::Vector3 APE::Vector3::operator*(const Vector3& right) const {
+    return Vector3(
+        Y * right.Z - Z * right.Y,
+        Z * right.X - X * right.Z,
+        X * right.Y - Y * right.X
+    );
+}
+
+constexpr double APE::Vector3::DotProduct(const Vector3& left, const Vector3& right) {
+    return left.X * right.X + left.Y * right.Y + left.Z * right.Z;
+}
+
+constexpr bool APE::Vector3::operator==(const Vector3& right) const {
+    return X == right.X && Y == right.Y && Z == right.Z;
+}
+constexpr bool APE::Vector3::operator!=(const Vector3& right) const {
+    return !(*this == right);
+}
+constexpr APE::Vector3::operator Vector2() const { return Vector2(X, Y); }
+
+// ---- Vector3 constants ----
+inline constexpr APE::Vector3 APE::Vector3::Zero      = APE::Vector3(0.0, 0.0, 0.0);
+inline constexpr APE::Vector3 APE::Vector3::One       = APE::Vector3(1.0, 1.0, 1.0);
+inline constexpr APE::Vector3 APE::Vector3::Left      = APE::Vector3(-1.0, 0.0, 0.0);
+inline constexpr APE::Vector3 APE::Vector3::Right     = APE::Vector3(1.0, 0.0, 0.0);
+inline constexpr APE::Vector3 APE::Vector3::Up        = APE::Vector3(0.0, 1.0, 0.0);
+inline constexpr APE::Vector3 APE::Vector3::Down      = APE::Vector3(0.0, -1.0, 0.0);
+inline constexpr APE::Vector3 APE::Vector3::Forward   = APE::Vector3(0.0, 0.0, 1.0);
+inline constexpr APE::Vector3 APE::Vector3::Backward  = APE::Vector3(0.0, 0.0, -1.0);
+
 #endif // __APE_STRUCTURE_H__
\ No newline at end of file
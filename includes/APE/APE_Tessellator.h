@@ -0,0 +1,73 @@
+#ifndef __APE_TESSELLATOR_H__
+#define __APE_TESSELLATOR_H__
+
+#include "APE_Color.h"
+#include "APE_Renderer.h"
+#include "APE_Structure.h"
+
+#include <vector>
+
+namespace APE {
+    /// @brief The Tessellator class, turn shapes into Sprite triangles so any renderer can draw them as geometry
+    /// (and batch them). The number of segments of curves is chosen from their radius, and the unit circle of
+    /// each segments count is computed once and cached.
+    /// @note The shapes use continuous coordinates: a pixel (x, y) cover the area from (x, y) to (x + 1, y + 1).
+    class Tessellator {
+    private:
+        std::vector<std::vector<Vector2>> m_unitCircles;
+        std::vector<Vector2> m_outerPath;
+        std::vector<Vector2> m_innerPath;
+
+        /// @brief Build the outline of an ellipse into the given path.
+        void EllipsePath(std::vector<Vector2>& path, const Vector2& center, double radiusX, double radiusY, int segments);
+        /// @brief Build the outline of a rounded rectangle into the given path.
+        void RoundedRectanglePath(std::vector<Vector2>& path, double left, double top, double right, double bottom, double radius, int segments);
+        /// @brief Append a triangle fan covering the given convex path.
+        static void AppendFan(Sprite& sprite, const std::vector<Vector2>& path, const Color& color);
+        /// @brief Append the triangles between two paths with the same number of points.
+        static void AppendRing(Sprite& sprite, const std::vector<Vector2>& outer, const std::vector<Vector2>& inner, const Color& color);
+    public:
+        Tessellator() = default;
+
+        /// @brief Get the number of segments needed for a curve of the given radius to look smooth, keeping the
+        /// error under an eighth of pixel.
+        /// @param radius The radius of the curve, in pixels.
+        /// @return The number of segments of a whole circle, always a multiple of 4 (between 8 and 1024).
+        static int GetSegmentsCount(double radius);
+        /// @brief Get the points of a unit circle, computed once per segments count.
+        /// @param segments The number of segments, a multiple of 4 (see GetSegmentsCount()).
+        /// @return The points of the unit circle, starting at (1, 0) and going clockwise on screen.
+        const std::vector<Vector2>& GetUnitCircle(int segments);
+
+        /// @brief Append a filled ellipse to a Sprite.
+        /// @param sprite The Sprite to append to.
+        /// @param center The center of the ellipse.
+        /// @param radiusX The radius of the ellipse in the x direction.
+        /// @param radiusY The radius of the ellipse in the y direction.
+        /// @param color The color of the ellipse.
+        void AppendFilledEllipse(Sprite& sprite, const Vector2& center, double radiusX, double radiusY, const Color& color);
+        /// @brief Append the outline of an ellipse to a Sprite.
+        /// @param sprite The Sprite to append to.
+        /// @param center The center of the ellipse.
+        /// @param radiusX The radius of the ellipse in the x direction, the outline is centered on it.
+        /// @param radiusY The radius of the ellipse in the y direction, the outline is centered on it.
+        /// @param thickness The thickness of the outline.
+        /// @param color The color of the outline.
+        void AppendEllipseOutline(Sprite& sprite, const Vector2& center, double radiusX, double radiusY, double thickness, const Color& color);
+        /// @brief Append a filled rounded-corner rectangle to a Sprite.
+        /// @param sprite The Sprite to append to.
+        /// @param area The area of the rectangle (from (X, Y) to (X + Width, Y + Height)).
+        /// @param radius The radius of the corners, clamped to half of the smallest side.
+        /// @param color The color of the rectangle.
+        void AppendFilledRoundedRectangle(Sprite& sprite, const Rectangle& area, double radius, const Color& color);
+        /// @brief Append the outline of a rounded-corner rectangle to a Sprite.
+        /// @param sprite The Sprite to append to.
+        /// @param area The area of the rectangle (from (X, Y) to (X + Width, Y + Height)), the outline is inside it.
+        /// @param radius The radius of the corners, clamped to half of the smallest side.
+        /// @param thickness The thickness of the outline.
+        /// @param color The color of the outline.
+        void AppendRoundedRectangleOutline(Sprite& sprite, const Rectangle& area, double radius, double thickness, const Color& color);
+    };
+}
+
+#endif // __APE_TESSELLATOR_H__
@@ -0,0 +1,57 @@
+#ifndef __APE_THREAD_POOL_H__
+#define __APE_THREAD_POOL_H__
+
+#include "APE_Define.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace APE {
+    /// @brief The Thread Pool class, keep a set of worker threads alive to run batches of independent tasks
+    /// in parallel, without creating threads every time.
+    /// @note Run() must not be called from multiple threads at the same time, or from inside a task.
+    class ThreadPool {
+    private:
+        std::vector<std::thread> m_workers;
+        std::mutex m_mutex;
+        std::condition_variable m_wakeCondition;
+        std::condition_variable m_doneCondition;
+
+        const std::function<void(std::size_t)>* m_task = nullptr;
+        std::size_t m_tasksCount = 0;
+        std::atomic<std::size_t> m_nextTask;
+        std::size_t m_busyWorkers = 0;
+        std::size_t m_generation = 0;
+        bool m_stop = false;
+
+        /// @brief The loop of each worker thread, waiting for a batch then running its tasks.
+        void WorkerLoop();
+        /// @brief Take and run the tasks of the current batch until there is none left.
+        void RunTasks();
+    public:
+        /// @brief Create a new Thread Pool.
+        /// @param threadsCount The number of threads running the tasks, including the one calling Run().
+        /// If 0, the number of hardware threads is used.
+        ThreadPool(std::size_t threadsCount = 0);
+        ~ThreadPool();
+
+        APE_NOT_COPY_ASSIGNABLE(ThreadPool)
+
+        /// @brief Get the number of threads running the tasks, including the one calling Run().
+        /// @return The number of threads.
+        std::size_t ThreadsCount() const;
+
+        /// @brief Run a batch of tasks in parallel and wait for all of them to finish. The calling thread
+        /// run tasks too. The tasks are taken in index order, but may finish in any order.
+        /// @param tasksCount The number of tasks to run.
+        /// @param task The function to run for each task index (from 0 to tasksCount - 1), must not throw.
+        void Run(std::size_t tasksCount, const std::function<void(std::size_t)>& task);
+    };
+}
+
+#endif // __APE_THREAD_POOL_H__
@@ -0,0 +1,116 @@
+#ifndef __APE_SDL2_FONT_H__
+#define __APE_SDL2_FONT_H__
+
+#include "../APE_Color.h"
+#include "../APE_Renderer.h"
+#include "../APE_Structure.h"
+#include "APE_SDL2_Renderer.h"
+#include "APE_SDL2_TextureAtlas.h"
+
+#include <SDL2/SDL_ttf.h>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace APE {
+    namespace SDL2 {
+        /// @brief The SDL2 Glyph struct, contain the cached metrics and atlas region of a font glyph.
+        struct SDL2Glyph {
+        public:
+            /// @brief The size of the glyph image, Size::Zero if the glyph has no image (e.g. a space).
+            Size ImageSize;
+            /// @brief The horizontal distance to move the pen after the glyph.
+            int Advance = 0;
+            /// @brief The atlas region of the glyph image.
+            SDL2TextureRegion Region;
+        };
+
+        /// @brief The SDL2 Font class, provide a font (using SDL2_ttf) that rasterise each glyph once into a
+        /// texture atlas, and build whole strings as sprite geometry.
+        class SDL2Font {
+        private:
+            TTF_Font* m_data = nullptr;
+            SDL2TextureAtlas m_atlas;
+            std::unordered_map<uint32_t, SDL2Glyph> m_glyphs;
+            int m_lineSkip = 0;
+        public:
+            /// @brief Create a new SDL2 Font.
+            /// @param renderer The renderer to create the glyph atlas for.
+            /// @param path The path to the font file to load.
+            /// @param pointSize The size of the font, in points.
+            /// @param atlasPageSize The size of each glyph atlas page. Default to 1024x1024.
+            SDL2Font(SDL2Renderer* renderer, const std::string& path, int pointSize, const Size& atlasPageSize = Size(1024, 1024));
+            virtual ~SDL2Font();
+
+            APE_NOT_COPY_ASSIGNABLE(SDL2Font)
+
+            /// @brief Get the glyph of the given character, rasterising it into the atlas on first use.
+            /// @param codepoint The unicode codepoint of the character.
+            /// @return The glyph, or nullptr if the font doesn't provide it.
+            const SDL2Glyph* GetGlyph(uint32_t codepoint);
+            /// @brief Get the distance between two lines of text.
+            /// @return The line distance, in pixels.
+            int GetLineSkip() const;
+            /// @brief Get the glyph atlas of the font.
+            /// @return The glyph atlas.
+            const SDL2TextureAtlas& GetAtlas() const;
+
+            /// @brief Calculate the size of the given text.
+            /// @param text The UTF-8 text to measure.
+            /// @return The size of the text.
+            Size MeasureText(const std::string& text);
+            /// @brief Build the geometry of the given text, one textured quad per glyph.
+            /// @param text The UTF-8 text to build.
+            /// @param position The top-left position of the text.
+            /// @param color The color of the text.
+            /// @param pages The sprites that receive the geometry, one per glyph atlas page (so the text
+            /// can be rendered with one draw call per page, usually one). Will be cleared first.
+            void BuildText(const std::string& text, const Point& position, const Color& color, std::vector<CompactSprite32>& pages);
+        };
+
+        /// @brief The SDL2 Text class, represent a text rendered with an SDL2 Font. Its geometry is only
+        /// rebuilt when the text, position or color change, so unchanged labels cost only the draw call.
+        class SDL2Text {
+        private:
+            SDL2Font* m_font = nullptr;
+            std::string m_text;
+            Point m_position;
+            Color m_color = KnownColor::White;
+            bool m_dirty = true;
+            std::vector<CompactSprite32> m_pages;
+        public:
+            /// @brief Create a new SDL2 Text.
+            /// @param font The font to render the text with.
+            /// @param text The UTF-8 text. Default to empty.
+            SDL2Text(SDL2Font* font, const std::string& text = "");
+
+            /// @brief Get the text.
+            /// @return The UTF-8 text.
+            const std::string& GetText() const;
+            /// @brief Set the text, will do nothing if it's unchanged.
+            /// @param text The UTF-8 text to set.
+            void SetText(const std::string& text);
+
+            /// @brief Get the top-left position of the text.
+            /// @return The position of the text.
+            Point GetPosition() const;
+            /// @brief Set the top-left position of the text, will do nothing if it's unchanged.
+            /// @param position The position to set.
+            void SetPosition(const Point& position);
+
+            /// @brief Get the color of the text.
+            /// @return The color of the text.
+            Color GetColor() const;
+            /// @brief Set the color of the text, will do nothing if it's unchanged.
+            /// @param color The color to set.
+            void SetColor(const Color& color);
+
+            /// @brief Render the text, rebuilding its geometry only if it has changed.
+            /// @param renderer The renderer to render the text with.
+            void Render(SDL2Renderer& renderer);
+        };
+    }
+}
+
+#endif // __APE_SDL2_FONT_H__
@@ -0,0 +1,71 @@
+#ifndef __APE_SDL2_RENDER_TARGET_H__
+#define __APE_SDL2_RENDER_TARGET_H__
+
+#include "../APE_Color.h"
+#include "../APE_Structure.h"
+#include "APE_SDL2_Renderer.h"
+
+#include <SDL2/SDL_render.h>
+
+namespace APE {
+    namespace SDL2 {
+        /// @brief The SDL2 Render Target class, provide a texture that the SDL2 Renderer can draw into. Usually
+        /// to cache a layer that rarely change: record it once, then composite it with a single copy per frame
+        /// (see SDL2Renderer::Composite()) until it's invalidated.
+        /// @note Some SDL2 backends lose the render targets content (SDL_RENDER_TARGETS_RESET event), call
+        /// Invalidate() when that happen.
+        class SDL2RenderTarget {
+        private:
+            SDL2Renderer* m_renderer = nullptr;
+            SDL_Texture* m_data = nullptr;
+            Size m_size;
+            bool m_valid = false;
+            bool m_recording = false;
+
+            friend class SDL2Renderer;
+        public:
+            /// @brief Create a new SDL2 Render Target.
+            /// @param renderer The renderer to create the render target for.
+            /// @param size The size of the render target to create.
+            SDL2RenderTarget(SDL2Renderer* renderer, const Size& size);
+            virtual ~SDL2RenderTarget();
+
+            APE_NOT_COPY_ASSIGNABLE(SDL2RenderTarget)
+
+            /// @brief Get the size of the SDL2 Render Target.
+            /// @return The size of the SDL2 Render Target.
+            Size GetSize() const;
+
+            /// @brief Get the blend mode use when compositing the SDL2 Render Target.
+            /// @return The blend mode of the SDL2 Render Target, or Invalid on failed.
+            SDL2DrawBlendMode GetBlendMode() const;
+            /// @brief Set the blend mode use when compositing the SDL2 Render Target.
+            /// @param blendMode The blend mode to set.
+            /// @note The default is AlphaBlend. Translucent drawings recorded into a transparent target are
+            /// blended twice when composited, prefer opaque layers or None for a fully covered target.
+            void SetBlendMode(SDL2DrawBlendMode blendMode);
+
+            /// @brief Check if the SDL2 Render Target content is up-to-date (recorded and not invalidated).
+            /// @return true if the content is valid, false if it need to be recorded again.
+            bool IsValid() const;
+            /// @brief Mark the SDL2 Render Target content as outdated, so it will be recorded again.
+            void Invalidate();
+
+            /// @brief Start recording into the SDL2 Render Target: all the renderer drawing go to it until
+            /// EndRecord(). The viewport and clip area are reset to the whole target while recording, and
+            /// restored after. Recording can be nested.
+            /// @param clearColor The color to clear the target with before recording.
+            /// @return true on success, false if render targets aren't supported or already recording.
+            bool BeginRecord(const Color& clearColor = Color::Empty);
+            /// @brief Stop recording, the content become valid and the renderer draw to the previous target again.
+            /// @note The recordings nested inside this one are ended too, their content stay invalid. The
+            /// destructor end the recording, so destroying a recording target always restore the renderer.
+            void EndRecord();
+            /// @brief Check if the SDL2 Render Target is being recorded.
+            /// @return true if recording, false otherwise.
+            bool IsRecording() const;
+        };
+    }
+}
+
+#endif // __APE_SDL2_RENDER_TARGET_H__
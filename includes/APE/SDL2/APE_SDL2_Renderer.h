@@ -2,12 +2,18 @@
 #define __APE_SDL2_RENDERER_H__
 
 #include "../APE_Renderer.h"
+#include "../APE_Tessellator.h"
 #include "APE_SDL2_Window.h"
 
 #include <SDL2/SDL_render.h>
+#include <cstddef>
+#include <vector>
 
 namespace APE {
     namespace SDL2 {
+        class SDL2Texture;
+        class SDL2RenderTarget;
+
         /// @brief The SDL2 Draw Blend Mode enum class, the mode use for blending operation of SDL2 Renderer.
         enum class SDL2DrawBlendMode {
             None = SDL_BLENDMODE_NONE,
@@ -18,10 +24,150 @@ namespace APE {
             Invalid = SDL_BLENDMODE_INVALID
         };
 
+        /// @brief The SDL2 Renderer Statistics struct, contain the rendering statistics of a frame.
+        struct SDL2RendererStatistics {
+        public:
+            /// @brief The number of drawing calls actually issued to SDL2.
+            std::size_t DrawCalls = 0;
+            /// @brief The number of render state calls actually issued to SDL2 (draw color, blend mode, clip area
+            /// and viewport). Redundant state changes are not counted, since they are skipped.
+            std::size_t StateChanges = 0;
+            /// @brief The number of primitives recorded while primitive batching was enabled.
+            std::size_t BatchedPrimitives = 0;
+            /// @brief The number of sprites recorded while sprite batching was enabled.
+            std::size_t BatchedSprites = 0;
+            /// @brief The number of heap allocations made by the renderer buffers and the Sprite render caches.
+            /// @note This should stay 0 once the rendering reached a steady state.
+            std::size_t BufferAllocations = 0;
+            /// @brief The number of drawings dropped because they were outside the viewport or the clip area.
+            std::size_t Culled = 0;
+        };
+
         /// @brief The SDL2 Renderer class, provide an APE renderer that wrap the SDL2 renderer.
         class SDL2Renderer : public IRenderer {
         private:
+            /// @brief The kind of a batched primitive.
+            enum class PrimitiveKind { Point, Line, Rectangle, FilledRectangle };
+            /// @brief A run of consecutive batched primitives with the same kind and color, that will be
+            /// submitted with a single SDL2 call.
+            struct PrimitiveRun {
+                PrimitiveKind Kind;
+                SDL_Color Color;
+                std::size_t First;
+                std::size_t Count;
+            };
+            /// @brief The SDL2 converted data of a Sprite, cached on the Sprite itself.
+            class SpriteCache : public ISpriteCache {
+            public:
+                std::size_t Revision = 0;
+                std::vector<SDL_Vertex> Vertices;
+                std::vector<int> Indices;
+            };
+
             SDL_Renderer* m_data = nullptr;
+
+            // The shadow copy of the SDL2 render state. The draw color is only applied to SDL2 when a drawing
+            // need it, so m_sdlDrawColor keep what SDL2 currently has.
+            SDL_Color m_drawColor = { 0, 0, 0, 255 };
+            SDL_Color m_sdlDrawColor = { 0, 0, 0, 255 };
+            SDL2DrawBlendMode m_blendMode = SDL2DrawBlendMode::None;
+            bool m_clipEnabled = false;
+            SDL_Rect m_clipArea = { 0, 0, 0, 0 };
+            bool m_viewportSet = false;
+            SDL_Rect m_viewport = { 0, 0, 0, 0 };
+
+            bool m_primitiveBatching = false;
+            std::vector<PrimitiveRun> m_primitiveRuns;
+            std::vector<SDL_Point> m_batchPoints;
+            std::vector<SDL_Rect> m_batchRects;
+
+            std::vector<SDL_Vertex> m_spriteVertices;
+            std::vector<int> m_spriteIndices;
+
+            bool m_spriteBatching = false;
+            SDL_Texture* m_spriteBatchTexture = nullptr;
+            std::vector<SDL_Vertex> m_batchVertices;
+            std::vector<int> m_batchIndices;
+
+            Tessellator m_tessellator;
+            Sprite m_shapeSprite;
+
+            // The area that drawings must intersect to not be culled, relative to the viewport like the drawings.
+            bool m_culling = true;
+            bool m_cullAreaValid = false;
+            Rectangle m_cullArea;
+
+            /// @brief The renderer state saved when starting to record into a render target.
+            struct TargetState {
+                SDL2RenderTarget* RenderTarget;
+                SDL_Texture* PreviousTarget;
+                bool ViewportSet;
+                SDL_Rect Viewport;
+                bool ClipEnabled;
+                SDL_Rect ClipArea;
+            };
+            std::vector<TargetState> m_targetStack;
+
+            SDL2RendererStatistics m_frameStatistics;
+            SDL2RendererStatistics m_lastFrameStatistics;
+
+            friend class SDL2Texture;
+            friend class SDL2RenderTarget;
+
+            /// @brief Set the SDL2 draw color, skipping the call if SDL2 already has it.
+            void ApplyDrawColor(const SDL_Color& color);
+            /// @brief Get the run that the next primitive should be appended to, starting a new run if needed.
+            PrimitiveRun& GetPrimitiveRun(PrimitiveKind kind, std::size_t first);
+            /// @brief Submit all the recorded primitives to SDL2.
+            void FlushPrimitives();
+
+            /// @brief Make sure the given buffer can hold the given number of elements, growing it
+            /// geometrically (and counting the allocation) if needed.
+            template <typename T>
+            void EnsureCapacity(std::vector<T>& buffer, std::size_t count);
+            /// @brief Convert the given Sprite to SDL2 vertices and indices, appending them to the given buffers.
+            void ConvertSprite(const Sprite& sprite, std::vector<SDL_Vertex>& vertices, std::vector<int>& indices);
+            /// @brief Get the render cache of the given Sprite, converting it again if it's outdated.
+            /// @return The up-to-date cache, or nullptr if the Sprite render cache is disabled.
+            const SpriteCache* UpdateSpriteCache(const Sprite& sprite);
+
+            /// @brief Prepare the sprite batch to record a sprite with the given texture, flushing the primitives,
+            /// and the sprite batch if the texture changed.
+            void BeginSpriteBatch(SDL_Texture* texture);
+            /// @brief Append the given Sprite to the sprite batch.
+            void AppendSprite(const Sprite& sprite, SDL_Texture* texture);
+            /// @brief Append the given geometry to the sprite batch, rebasing its indices.
+            void AppendGeometry(const SDL_Vertex* vertices, std::size_t vertexCount, const void* indices, std::size_t indexCount, int indexSize);
+            /// @brief Submit the given geometry to SDL2, the indices size must be 2 or 4 bytes.
+            void SubmitGeometry(SDL_Texture* texture, const SDL_Vertex* vertices, std::size_t vertexCount, const void* indices, std::size_t indexCount, int indexSize);
+            /// @brief Render (or batch) the given Sprite with the given texture, unless it's culled.
+            void RenderSpriteWithTexture(const Sprite& sprite, SDL_Texture* texture);
+            /// @brief Render (or batch) the given Sprite with the given texture, without culling it.
+            void SubmitSprite(const Sprite& sprite, SDL_Texture* texture);
+            /// @brief Render (or batch) the given compact sprite with the given texture.
+            void RenderCompactSprite(const CompactSprite16& sprite, SDL_Texture* texture);
+            /// @brief Render (or batch) the given compact sprite with the given texture.
+            void RenderCompactSprite(const CompactSprite32& sprite, SDL_Texture* texture);
+            /// @brief Render (or batch) geometry that is already in the SDL2 vertex layout.
+            void RenderCompactGeometry(const SDL_Vertex* vertices, std::size_t vertexCount, const void* indices, std::size_t indexCount, int indexSize, SDL_Texture* texture);
+            /// @brief Submit the sprite batch to SDL2 as a single geometry.
+            void FlushSprites();
+            /// @brief Render (or batch) the shape tessellated into m_shapeSprite.
+            void RenderShape();
+
+            /// @brief Check if a drawing with the given bounds is entirely outside the viewport or the clip area,
+            /// counting it in the frame statistics if so.
+            /// @param bounds The conservative bounds of the drawing, with a positive size.
+            /// @return true if the drawing should be dropped, false otherwise.
+            bool IsCulled(const Rectangle& bounds);
+
+            /// @brief Redirect the drawing to the given render target, saving the current state.
+            /// @return true on success, false otherwise.
+            bool PushRenderTarget(SDL2RenderTarget& target);
+            /// @brief Restore the drawing state saved by PushRenderTarget() for the target. If targets were pushed
+            /// after it, their recordings are ended too (without becoming valid).
+            /// @return true on success, false otherwise.
+            bool PopRenderTarget(SDL2RenderTarget& target);
         public:
             /// @brief Create a new SDL2 Renderer.
             /// @param window The window to create
@@ -30,6 +176,19 @@ namespace APE {
 
             APE_NOT_COPY_ASSIGNABLE(SDL2Renderer)
 
+            /// @brief Read the render state back from SDL2. The SDL2 Renderer keep a copy of its render state to
+            /// skip the redundant state calls, so this must be called after changing the state directly
+            /// through SDL2 (or after SDL2 reset it, like the viewport on window resize).
+            void ResetStateCache();
+
+            /// @brief Get the current draw color of the SDL2 Renderer.
+            /// @return The current draw color of the SDL2 Renderer.
+            Color GetDrawColor() const;
+            /// @brief Set the draw color of the SDL2 Renderer, use by the primitives drawing.
+            /// @param color The color to set.
+            /// @note This only update the state on the APE side, it is applied to SDL2 when a drawing need it.
+            void SetDrawColor(const Color& color);
+
             /// @brief Get the current draw blend mode of the SDL2 Renderer.
             /// @return The current draw blend mode of the SDL2 Renderer, or Invalid on failed.
             SDL2DrawBlendMode GetDrawBlendMode() const;
@@ -68,8 +227,54 @@ namespace APE {
             /// @return true if clipping is enabled, false otherwise.
             bool IsClipEnabled() const;
 
+            /// @brief Enable primitive batching. While enabled, points, lines and rectangles are recorded
+            /// instead of drawn, and are submitted on Flush() or Present() with consecutive primitives of the
+            /// same kind and color merged into a single SDL2 call.
+            /// @note Any state change (blend mode, viewport, clip area) and any non-batched drawing will flush
+            /// the recorded primitives first, so the drawing order is kept. Lines chained end to start are
+            /// merged into a polyline only with the None blend mode, so blended joints are still drawn twice.
+            void EnablePrimitiveBatching();
+            /// @brief Disable primitive batching, the recorded primitives will be flushed.
+            void DisablePrimitiveBatching();
+            /// @brief Check if primitive batching is enabled.
+            /// @return true if primitive batching is enabled, false otherwise.
+            bool IsPrimitiveBatchingEnabled() const;
+            /// @brief Enable sprite batching. While enabled, the geometry of consecutive rendered sprites is
+            /// appended to a single vertex and index stream, which is submitted as one SDL2 geometry on Flush(),
+            /// Present(), or when the rendering state change. Circles, ellipses and rounded rectangles are
+            /// tessellated into geometry, so they are batched too.
+            /// @note Any state change (blend mode, viewport, clip area) and any non-batched drawing will flush
+            /// the batch first, so the drawing order is kept.
+            void EnableSpriteBatching();
+            /// @brief Disable sprite batching, the recorded sprites will be flushed.
+            void DisableSpriteBatching();
+            /// @brief Check if sprite batching is enabled.
+            /// @return true if sprite batching is enabled, false otherwise.
+            bool IsSpriteBatchingEnabled() const;
+
+            /// @brief Submit all the recorded primitives and sprites to the drawing area.
+            void Flush();
+
+            /// @brief Enable culling (default). While enabled, the drawings whose bounds are entirely outside the
+            /// viewport or the clip area are dropped before being recorded or submitted to SDL2.
+            /// @note The bounds of a Sprite are cached on it (see Sprite::GetBounds()), so culling a static Sprite
+            /// is cheap. The number of culled drawings is reported in the frame statistics.
+            void EnableCulling();
+            /// @brief Disable culling, every drawing will be submitted to SDL2.
+            void DisableCulling();
+            /// @brief Check if culling is enabled.
+            /// @return true if culling is enabled, false otherwise.
+            bool IsCullingEnabled() const;
+
+            /// @brief Get the statistics of the frame currently being rendered.
+            /// @return The statistics since the last call to Present().
+            const SDL2RendererStatistics& GetFrameStatistics() const;
+            /// @brief Get the statistics of the last presented frame.
+            /// @return The statistics of the last presented frame.
+            const SDL2RendererStatistics& GetLastFrameStatistics() const;
+
             /// @brief Clear the entire drawing area.
-            /// @param color The clear color to use.
+            /// @param color The clear color to use, it become the draw color too (see SetDrawColor()).
             void Clear(const Color& color) override;
             /// @brief Display the drawing area to the output.
             void Present() override;
@@ -122,6 +327,36 @@ namespace APE {
             /// @brief Rendering a sprite to the drawing area.
             /// @param sprite The sprite to render.
             void RenderSprite(const Sprite& sprite) override;
+            /// @brief Rendering a textured sprite to the drawing area.
+            /// @param sprite The sprite to render.
+            /// @param texture The texture to render the sprite with, the vertices texture position are
+            /// normalised to it.
+            /// @note Consecutive sprites with the same texture can be batched (see EnableSpriteBatching()),
+            /// so packing the images into an SDL2TextureAtlas will reduce the number of draw calls.
+            void RenderSprite(const Sprite& sprite, const SDL2Texture& texture);
+            /// @brief Rendering a compact sprite to the drawing area.
+            /// @param sprite The compact sprite to render, its vertices are submitted without any conversion.
+            void RenderSprite(const CompactSprite16& sprite);
+            /// @brief Rendering a textured compact sprite to the drawing area.
+            /// @param sprite The compact sprite to render, its vertices are submitted without any conversion.
+            /// @param texture The texture to render the sprite with.
+            void RenderSprite(const CompactSprite16& sprite, const SDL2Texture& texture);
+            /// @brief Rendering a compact sprite to the drawing area.
+            /// @param sprite The compact sprite to render, its vertices are submitted without any conversion.
+            void RenderSprite(const CompactSprite32& sprite);
+            /// @brief Rendering a textured compact sprite to the drawing area.
+            /// @param sprite The compact sprite to render, its vertices are submitted without any conversion.
+            /// @param texture The texture to render the sprite with.
+            void RenderSprite(const CompactSprite32& sprite, const SDL2Texture& texture);
+
+            /// @brief Composite a render target to the drawing area with a single copy.
+            /// @param target The render target to composite, with its blend mode.
+            /// @param position The position of the top-left corner of the render target.
+            void Composite(const SDL2RenderTarget& target, const Point& position);
+            /// @brief Composite a render target to the drawing area with a single copy.
+            /// @param target The render target to composite, with its blend mode.
+            /// @param area The area to stretch the render target to, will not draw if the area is empty.
+            void Composite(const SDL2RenderTarget& target, const Rectangle& area);
         };
     }
 }
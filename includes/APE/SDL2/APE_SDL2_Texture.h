@@ -0,0 +1,93 @@
+#ifndef __APE_SDL2_TEXTURE_H__
+#define __APE_SDL2_TEXTURE_H__
+
+#include "../APE_Blend.h"
+#include "../APE_Color.h"
+#include "../APE_PixelFormat.h"
+#include "../APE_Structure.h"
+#include "APE_SDL2_Renderer.h"
+
+#include <SDL2/SDL_render.h>
+#include <string>
+#include <vector>
+
+namespace APE {
+    namespace SDL2 {
+        /// @brief The SDL2 Texture class, provide an RGBA texture that wrap the SDL2 texture.
+        class SDL2Texture {
+        private:
+            SDL_Texture* m_data = nullptr;
+            Size m_size;
+            SDL2DrawBlendMode m_blendMode = SDL2DrawBlendMode::AlphaBlend;
+            bool m_premultipliedAlpha = false;
+            std::vector<PremultipliedColor> m_uploadBuffer;
+            PixelFormat m_streamingFormat = PixelFormat::Unknown;
+
+            /// @brief Set the blend mode of the SDL2 texture from the blend mode and the premultiplied alpha.
+            /// @return true on success, false if the renderer doesn't support the blend mode.
+            bool ApplyBlendMode();
+            void Upload(const Rectangle& area, const Color* pixels);
+
+            friend class SDL2Renderer;
+        public:
+            /// @brief Create a new transparent SDL2 Texture.
+            /// @param renderer The renderer to create the texture for.
+            /// @param size The size of the texture to create.
+            SDL2Texture(SDL2Renderer* renderer, const Size& size);
+            /// @brief Create a new transparent streaming SDL2 Texture, for the textures updated every frame. The
+            /// pixels are converted to the pixel format when uploaded (see PixelConverter), pick the format of the
+            /// renderer so SDL2 doesn't convert them again.
+            /// @param renderer The renderer to create the texture for.
+            /// @param size The size of the texture to create.
+            /// @param format The pixel format of the texture to create.
+            SDL2Texture(SDL2Renderer* renderer, const Size& size, PixelFormat format);
+            /// @brief Create a new SDL2 Texture from an image file (using SDL2_image), converted to RGBA.
+            /// @param renderer The renderer to create the texture for.
+            /// @param path The path to the image file to load.
+            SDL2Texture(SDL2Renderer* renderer, const std::string& path);
+            virtual ~SDL2Texture();
+
+            APE_NOT_COPY_ASSIGNABLE(SDL2Texture)
+
+            /// @brief Get the size of the SDL2 Texture.
+            /// @return The size of the SDL2 Texture.
+            Size GetSize() const;
+
+            /// @brief Get the blend mode use when rendering with the SDL2 Texture.
+            /// @return The blend mode of the SDL2 Texture, or Invalid on failed.
+            SDL2DrawBlendMode GetBlendMode() const;
+            /// @brief Set the blend mode use when rendering with the SDL2 Texture.
+            /// @param blendMode The blend mode to set.
+            /// @note With premultiplied alpha, AlphaBlend and Additive need custom blend modes. If the renderer
+            /// doesn't support them, the blend mode is not changed (see GetBlendMode()).
+            void SetBlendMode(SDL2DrawBlendMode blendMode);
+
+            /// @brief Enable premultiplied alpha. While enabled, the pixels are premultiplied when uploaded with
+            /// Update() and the blend modes composite them as premultiplied colors (same result as the straight alpha
+            /// blend modes, without the dark fringes when the texture is filtered).
+            /// @note The pixels already uploaded are not converted, upload them again after enabling it. If the
+            /// renderer doesn't support the custom blend modes it needs, it stays disabled (see
+            /// IsPremultipliedAlphaEnabled()).
+            void EnablePremultipliedAlpha();
+            /// @brief Disable premultiplied alpha (default).
+            /// @note The pixels already uploaded are not converted, upload them again after disabling it.
+            void DisablePremultipliedAlpha();
+            /// @brief Check if premultiplied alpha is enabled for the SDL2 Texture.
+            /// @return True if premultiplied alpha is enabled.
+            bool IsPremultipliedAlphaEnabled() const;
+
+            /// @brief Update an area of the SDL2 Texture with the given pixels.
+            /// @param area The area to update, will do nothing if empty.
+            /// @param pixels The pixels to upload, row by row, the area width pixels per row.
+            /// @note The pixels are premultiplied with the SSE2 or AVX2 kernels if premultiplied alpha is enabled.
+            void Update(const Rectangle& area, const Color* pixels);
+            /// @brief Update an area of the SDL2 Texture with already premultiplied pixels.
+            /// @param area The area to update, will do nothing if empty.
+            /// @param pixels The premultiplied pixels to upload, row by row, the area width pixels per row.
+            /// @note Will do nothing if premultiplied alpha is not enabled.
+            void Update(const Rectangle& area, const PremultipliedColor* pixels);
+        };
+    }
+}
+
+#endif // __APE_SDL2_TEXTURE_H__
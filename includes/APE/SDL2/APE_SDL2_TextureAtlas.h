@@ -0,0 +1,109 @@
+#ifndef __APE_SDL2_TEXTURE_ATLAS_H__
+#define __APE_SDL2_TEXTURE_ATLAS_H__
+
+#include "../APE_Color.h"
+#include "../APE_RectanglePacker.h"
+#include "../APE_Renderer.h"
+#include "../APE_Structure.h"
+#include "APE_SDL2_Renderer.h"
+#include "APE_SDL2_Texture.h"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace APE {
+    namespace SDL2 {
+        /// @brief The SDL2 Texture Region struct, represent an image packed into an SDL2 Texture Atlas.
+        struct SDL2TextureRegion {
+        public:
+            /// @brief The index of the atlas page that contain the image.
+            std::size_t Page = 0;
+            /// @brief The area of the image in the atlas page, in pixels.
+            Rectangle Area;
+            /// @brief The normalised texture position of the image top-left corner.
+            Vector2 TopLeft;
+            /// @brief The normalised texture position of the image bottom-right corner.
+            Vector2 BottomRight;
+
+            /// @brief Map a texture position local to the image to the texture position in the atlas page.
+            /// @param local The local texture position, (0, 0) is the image top-left and (1, 1) its bottom-right.
+            /// @return The texture position in the atlas page.
+            Vector2 MapTexturePosition(const Vector2& local) const;
+            /// @brief Map the texture position of every vertex of the given Sprite to the atlas page.
+            /// @param sprite The Sprite to map, its texture positions must be local to the image (see
+            /// MapTexturePosition()).
+            void MapSprite(Sprite& sprite) const;
+        };
+
+        /// @brief The SDL2 Texture Atlas class, pack many images into a few large SDL2 Textures (pages), so
+        /// sprites using different images can still be rendered in a single batch.
+        class SDL2TextureAtlas {
+        private:
+            /// @brief An atlas page, a texture and the packer of its area.
+            struct Page {
+                std::unique_ptr<SDL2Texture> Texture;
+                SkylinePacker Packer;
+            };
+
+            SDL2Renderer* m_renderer = nullptr;
+            Size m_pageSize;
+            int m_padding = 1;
+            std::vector<Page> m_pages;
+            std::unordered_map<std::string, SDL2TextureRegion> m_regions;
+        public:
+            /// @brief Create a new empty SDL2 Texture Atlas.
+            /// @param renderer The renderer to create the atlas pages for.
+            /// @param pageSize The size of each atlas page. Default to 2048x2048.
+            /// @param padding The transparent space kept around each image, to avoid bleeding when the texture
+            /// is filtered. Default to 1.
+            SDL2TextureAtlas(SDL2Renderer* renderer, const Size& pageSize = Size(2048, 2048), int padding = 1);
+            virtual ~SDL2TextureAtlas() = default;
+
+            APE_NOT_COPY_ASSIGNABLE(SDL2TextureAtlas)
+
+            /// @brief Load an image file (using SDL2_image) and pack it into the atlas.
+            /// @param name The name to identify the image, will do nothing if the name already exist.
+            /// @param path The path to the image file to load.
+            /// @return true on succeed, false if the image can't be loaded or is larger than a page.
+            bool AddImage(const std::string& name, const std::string& path);
+            /// @brief Pack the given pixels into the atlas.
+            /// @param name The name to identify the image, will do nothing if the name already exist.
+            /// @param size The size of the image.
+            /// @param pixels The pixels of the image, row by row.
+            /// @return true on succeed, false if the image is larger than a page.
+            bool AddPixels(const std::string& name, const Size& size, const Color* pixels);
+            /// @brief Pack the given pixels into the atlas, without a name to identify it.
+            /// @param size The size of the image.
+            /// @param pixels The pixels of the image, row by row.
+            /// @param region The region that receive the packed image on succeed.
+            /// @return true on succeed, false if the image is larger than a page.
+            bool AddPixels(const Size& size, const Color* pixels, SDL2TextureRegion& region);
+
+            /// @brief Check if the atlas contain an image with the given name.
+            /// @param name The name of the image.
+            /// @return true if the atlas contain the image, false otherwise.
+            bool IsContain(const std::string& name) const;
+            /// @brief Get the region of the image with the given name.
+            /// @param name The name of the image.
+            /// @param region The region that receive the result if found.
+            /// @return true if the image was found, false otherwise.
+            bool TryGetRegion(const std::string& name, SDL2TextureRegion& region) const;
+
+            /// @brief Count the number of pages of the atlas.
+            /// @return The number of pages.
+            std::size_t PagesCount() const;
+            /// @brief Get the texture of the given atlas page.
+            /// @param index The index of the page.
+            /// @return The texture of the page.
+            /// @note Will throw std::out_of_range if the index is out of range.
+            SDL2Texture& GetPage(std::size_t index) const;
+            /// @brief Get the size of each atlas page.
+            /// @return The size of each atlas page.
+            Size GetPageSize() const;
+        };
+    }
+}
+
+#endif // __APE_SDL2_TEXTURE_ATLAS_H__
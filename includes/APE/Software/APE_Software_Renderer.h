@@ -0,0 +1,234 @@
+#ifndef __APE_SOFTWARE_RENDERER_H__
+#define __APE_SOFTWARE_RENDERER_H__
+
+#include "../APE_Color.h"
+#include "../APE_DamageTracker.h"
+#include "../APE_Define.h"
+#include "../APE_Renderer.h"
+#include "../APE_Structure.h"
+#include "../APE_Tessellator.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace APE {
+    namespace Software {
+        /// @brief The Software Blend Mode enum class, the mode use for blending operation of the Software Renderer.
+        /// @note Each mode match the formula of the SDL2 blend mode with the same name.
+        enum class SoftwareBlendMode {
+            /// @brief No blending, dst = src.
+            None,
+            /// @brief Alpha blending, dst.rgb = src.rgb * src.a + dst.rgb * (1 - src.a), dst.a = src.a + dst.a * (1 - src.a).
+            AlphaBlend,
+            /// @brief Additive blending, dst.rgb = src.rgb * src.a + dst.rgb, dst.a = dst.a.
+            Additive,
+            /// @brief Color modulate, dst.rgb = src.rgb * dst.rgb, dst.a = dst.a.
+            Modulate,
+            /// @brief Color multiply, dst.rgb = src.rgb * dst.rgb + dst.rgb * (1 - src.a), dst.a = dst.a.
+            Multiply
+        };
+
+        /// @brief The Software Raster Kernel enum class, the instruction set use by the Software Renderer to
+        /// rasterise triangles.
+        enum class SoftwareRasterKernel {
+            /// @brief Plain C++, one pixel at a time. Always supported.
+            Scalar,
+            /// @brief SSE2, 4 pixels at a time.
+            SSE2,
+            /// @brief AVX2, 8 pixels at a time.
+            AVX2
+        };
+
+        /// @brief The Software Renderer class, provide an APE renderer that rasterise on the CPU into an in-memory
+        /// RGBA framebuffer. It didn't need any window or GPU, so it can be used for testing and benchmarking.
+        class SoftwareRenderer : public IRenderer {
+        private:
+            Size m_size;
+            std::vector<Color> m_backBuffer;
+            std::vector<Color> m_frontBuffer;
+
+            Color m_drawColor = Color(0, 0, 0, 255);
+            SoftwareBlendMode m_blendMode = SoftwareBlendMode::None;
+            Rectangle m_viewport;
+            Rectangle m_clipArea;
+            bool m_clipEnabled = false;
+            SoftwareRasterKernel m_rasterKernel;
+
+            /// @brief The state of the tiled rasterisation (recorded commands, tile bins and worker threads),
+            /// only exist while it's enabled.
+            struct TileState;
+            std::unique_ptr<TileState> m_tiles;
+            std::unique_ptr<DamageTracker> m_damage;
+
+            Tessellator m_tessellator;
+            Sprite m_shapeSprite;
+
+            /// @brief Get the area that can be drawn to, in framebuffer coordinates (viewport and clip area applied).
+            Rectangle GetDrawableArea() const;
+            /// @brief Mark an area (in framebuffer coordinates) as damaged, if damage tracking is enabled.
+            void AddDamage(const Rectangle& area);
+            /// @brief Blend the draw color into the given pixel (in viewport coordinates), if it's drawable.
+            void PlotPixel(int x, int y, const Rectangle& drawable);
+        public:
+            /// @brief Create a new Software Renderer.
+            /// @param size The size of the framebuffer, in pixels.
+            SoftwareRenderer(const Size& size);
+            virtual ~SoftwareRenderer();
+
+            APE_NOT_COPY_ASSIGNABLE(SoftwareRenderer)
+
+            /// @brief Check if a raster kernel is supported, by both the build and the running CPU.
+            /// @param kernel The raster kernel to check.
+            /// @return true if the kernel can be used, false otherwise.
+            static bool IsRasterKernelSupported(SoftwareRasterKernel kernel);
+            /// @brief Get the fastest raster kernel supported on the running CPU.
+            /// @return The fastest supported raster kernel.
+            static SoftwareRasterKernel GetBestRasterKernel();
+
+            /// @brief Get the raster kernel used by the Software Renderer. Default to GetBestRasterKernel().
+            /// @return The current raster kernel.
+            SoftwareRasterKernel GetRasterKernel() const;
+            /// @brief Set the raster kernel used by the Software Renderer.
+            /// @param kernel The raster kernel to use.
+            /// @return true on success, false if the kernel isn't supported.
+            bool SetRasterKernel(SoftwareRasterKernel kernel);
+
+            /// @brief Enable tiled rasterisation. Triangles and filled rectangles are then recorded and binned into
+            /// 64x64 screen tiles, and the tiles are rasterised in parallel on Flush() (or Present()). Each tile keep
+            /// the submission order of its commands, so blending give the same result as immediate rendering.
+            /// @param threadsCount The number of threads rasterising the tiles, 0 to use every hardware thread.
+            void EnableTiledRasterization(std::size_t threadsCount = 0);
+            /// @brief Disable tiled rasterisation, flushing the recorded commands first.
+            void DisableTiledRasterization();
+            /// @brief Check if the Software Renderer has tiled rasterisation enabled.
+            /// @return true if tiled rasterisation is enabled, false otherwise.
+            bool IsTiledRasterizationEnabled() const;
+            /// @brief Rasterise all recorded commands to the back framebuffer. Does nothing if tiled rasterisation
+            /// is disabled. This is called automatically when needed (Present(), points and lines drawing).
+            void Flush();
+
+            /// @brief Enable damage tracking. Every drawing then mark the area it touched as damaged, and Present()
+            /// only copy the damaged regions to the presented framebuffer.
+            /// @param maxRectangles The maximum number of damaged rectangles to track (see DamageTracker).
+            /// @note To reduce the drawing too, redraw the frame once per damaged region of the application,
+            /// with the clip area set to the region (and without calling Clear()).
+            void EnableDamageTracking(std::size_t maxRectangles = 16);
+            /// @brief Disable damage tracking, Present() will copy the whole framebuffer again.
+            void DisableDamageTracking();
+            /// @brief Check if the Software Renderer has damage tracking enabled.
+            /// @return true if damage tracking is enabled, false otherwise.
+            bool IsDamageTrackingEnabled() const;
+            /// @brief Get the damages since the last Present().
+            /// @return The Damage Tracker of the Software Renderer, or nullptr if damage tracking is disabled.
+            const DamageTracker* GetDamageTracker() const;
+
+            /// @brief Get the current draw color of the Software Renderer.
+            /// @return The current draw color.
+            Color GetDrawColor() const;
+            /// @brief Set the draw color of the Software Renderer, use by the primitives drawing.
+            /// @param color The color to set.
+            void SetDrawColor(const Color& color);
+
+            /// @brief Get the current draw blend mode of the Software Renderer.
+            /// @return The current draw blend mode.
+            SoftwareBlendMode GetDrawBlendMode() const;
+            /// @brief Set the current draw blend mode of the Software Renderer.
+            /// @param blendMode The draw blend mode to set.
+            void SetDrawBlendMode(SoftwareBlendMode blendMode);
+
+            /// @brief Get the output size of the Software Renderer.
+            /// @return The size of the framebuffer.
+            Size GetOutputSize() const;
+
+            /// @brief Get the current drawing area of the Software Renderer.
+            /// @return The current drawing area.
+            Rectangle GetViewport() const;
+            /// @brief Set the drawing area of the Software Renderer.
+            /// @param area The Rectangle represent the drawing area to set, will not set if the area is empty.
+            void SetViewport(const Rectangle& area);
+            /// @brief Reset the drawing area to the entire framebuffer.
+            void ResetViewport();
+
+            /// @brief Set the current clip area of the Software Renderer, relative to the viewport (like SDL2).
+            /// @param area The area to set, will do nothing if empty.
+            void SetClipArea(const Rectangle& area);
+            /// @brief Get the current clip area of the Software Renderer.
+            /// @return The clip area of the Software Renderer, or Rectangle::Empty if not clipped.
+            Rectangle GetClipArea() const;
+            /// @brief Disable clipping for the Software Renderer.
+            void DisableClip();
+            /// @brief Check if the Software Renderer has clipping enabled.
+            /// @return true if clipping is enabled, false otherwise.
+            bool IsClipEnabled() const;
+
+            /// @brief Clear the entire framebuffer (ignoring the viewport and clip area, like SDL2).
+            /// @param color The clear color to use.
+            void Clear(const Color& color) override;
+            /// @brief Display the drawing area to the output, by copying it to the presented framebuffer (only the
+            /// damaged regions if damage tracking is enabled).
+            void Present() override;
+
+            /// @brief Draw a point at specific position.
+            /// @param position The position of the point to draw.
+            void DrawPoint(const Point& position);
+            /// @brief Draw a line to the drawing area.
+            /// @param start The position of the start point.
+            /// @param end The position of the end point.
+            void DrawLine(const Point& start, const Point& end);
+            /// @brief Draw a rectangle to the drawing area.
+            /// @param area The area of the Rectangle to draw, will not draw if the area is empty.
+            void DrawRectangle(const Rectangle& area);
+            /// @brief Draw a rounded-corner rectangle to the drawing area.
+            /// @param area The area of the Rectangle to draw, will not draw if the area is empty.
+            /// @param radius The radius of the rounded-corner.
+            void DrawRoundedRectangle(const Rectangle& area, int radius);
+            /// @brief Fill a rectangle to the drawing area.
+            /// @param area The area of the Rectangle to draw, will not draw if the area is empty.
+            void FillRectangle(const Rectangle& area);
+            /// @brief Fill a rounded-corner rectangle to the drawing area.
+            /// @param area The area of the Rectangle to draw, will not draw if the area is empty.
+            /// @param radius The radius of the rounded-corner.
+            void FillRoundedRectangle(const Rectangle& area, int radius);
+
+            /// @brief Draw a circle to the drawing area.
+            /// @param center The position of the center of the circle.
+            /// @param radius The radius of the circle, will not draw if this value is 0.
+            void DrawCircle(const Point& center, int radius);
+            /// @brief Draw an ellipse to the drawing area.
+            /// @param center The position of the center of the ellipse.
+            /// @param radiusX The radius of the ellipse in the x direction, will not draw if this value is 0.
+            /// @param radiusY The radius of the ellipse in the y direction, will not draw if this value is 0.
+            void DrawEllipse(const Point& center, int radiusX, int radiusY);
+
+            /// @brief Fill a circle to the drawing area.
+            /// @param center The position of the center of the circle.
+            /// @param radius The radius of the circle, will not fill if this value is 0.
+            void FillCircle(const Point& center, int radius);
+            /// @brief Fill an ellipse to the drawing area.
+            /// @param center The position of the center of the ellipse.
+            /// @param radiusX The radius of the ellipse in the x direction, will not fill if this value is 0.
+            /// @param radiusY The radius of the ellipse in the y direction, will not fill if this value is 0.
+            void FillEllipse(const Point& center, int radiusX, int radiusY);
+
+            /// @brief Rendering a sprite to the drawing area, interpolating the vertices color.
+            /// @param sprite The sprite to render.
+            /// @note Textures are not supported, the vertices texture position are ignored.
+            void RenderSprite(const Sprite& sprite) override;
+
+            /// @brief Get the pixels being drawn to (not presented yet), row by row.
+            /// @return The pixels of the back framebuffer.
+            /// @note With tiled rasterisation, the recorded commands are only included after Flush().
+            const Color* GetBackBuffer() const;
+            /// @brief Get the presented pixels, row by row.
+            /// @return The pixels of the last presented frame.
+            const Color* GetPixels() const;
+            /// @brief Get a presented pixel.
+            /// @param position The position of the pixel.
+            /// @return The pixel color, or Color::Empty if out of the framebuffer.
+            Color GetPixel(const Point& position) const;
+        };
+    }
+}
+
+#endif // __APE_SOFTWARE_RENDERER_H__
@@ -0,0 +1,72 @@
+#include "APE/APE_Blend.h"
+#include "APE_Color_Span.h"
+
+#include <cstring>
+
+namespace {
+    uint8_t UnpremultiplyChannel(unsigned value, unsigned alpha) {
+        return static_cast<uint8_t>(APE_MIN(255u, (value * 255 + alpha / 2) / alpha));
+    }
+}
+
+//* --- APE::PremultipliedColor ---
+
+APE::Color APE::PremultipliedColor::ToColor() const {
+    if (Alpha == 0) return Color::Empty;
+    return Color(UnpremultiplyChannel(Red, Alpha), UnpremultiplyChannel(Green, Alpha), UnpremultiplyChannel(Blue, Alpha), Alpha);
+}
+
+void APE::PremultipliedColor::FromColors(const APE::Color* colors, APE::PremultipliedColor* out, std::size_t count) {
+    // The premultiply kernels write the premultiplied channels in place of the Color ones.
+    Color::PremultiplySpan(colors, reinterpret_cast<Color*>(out), count);
+}
+void APE::PremultipliedColor::ToColors(const APE::PremultipliedColor* colors, APE::Color* out, std::size_t count) {
+    for (std::size_t i = 0; i < count; i++)
+        out[i] = colors[i].ToColor();
+}
+
+//* --- APE::Blend ---
+
+void APE::Blend::Over(const APE::PremultipliedColor* src, APE::Color* dst, std::size_t count) { BlendColorSpan(BlendOperation::Over, src, 1, dst, count); }
+void APE::Blend::Over(const APE::PremultipliedColor& src, APE::Color* dst, std::size_t count) { BlendColorSpan(BlendOperation::Over, &src, 0, dst, count); }
+void APE::Blend::Add(const APE::PremultipliedColor* src, APE::Color* dst, std::size_t count) { BlendColorSpan(BlendOperation::Add, src, 1, dst, count); }
+void APE::Blend::Add(const APE::PremultipliedColor& src, APE::Color* dst, std::size_t count) { BlendColorSpan(BlendOperation::Add, &src, 0, dst, count); }
+void APE::Blend::Modulate(const APE::PremultipliedColor* src, APE::Color* dst, std::size_t count) { BlendColorSpan(BlendOperation::Modulate, src, 1, dst, count); }
+void APE::Blend::Modulate(const APE::PremultipliedColor& src, APE::Color* dst, std::size_t count) { BlendColorSpan(BlendOperation::Modulate, &src, 0, dst, count); }
+void APE::Blend::Multiply(const APE::PremultipliedColor* src, APE::Color* dst, std::size_t count) { BlendColorSpan(BlendOperation::Multiply, src, 1, dst, count); }
+void APE::Blend::Multiply(const APE::PremultipliedColor& src, APE::Color* dst, std::size_t count) { BlendColorSpan(BlendOperation::Multiply, &src, 0, dst, count); }
+
+//* --- APE::Blend kernels ---
+
+void APE::BlendColorSpan(BlendOperation operation, const APE::PremultipliedColor* src, std::size_t srcStep, APE::Color* dst, std::size_t count) {
+    switch (GetColorKernel()) {
+    case ColorKernel::AVX2: BlendColorSpanAVX2(operation, src, srcStep, dst, count); break;
+    case ColorKernel::SSE2: BlendColorSpanSSE2(operation, src, srcStep, dst, count); break;
+    default: BlendColorSpanScalar(operation, src, srcStep, dst, count); break;
+    }
+}
+
+void APE::BlendColorSpanScalar(BlendOperation operation, const APE::PremultipliedColor* src, std::size_t srcStep, APE::Color* dst, std::size_t count) {
+    for (std::size_t i = 0; i < count; i++)
+        dst[i] = BlendPremultipliedColor(operation, src[i * srcStep], dst[i]);
+}
+
+#ifdef APE_COLOR_SSE2
+void APE::BlendColorSpanSSE2(BlendOperation operation, const APE::PremultipliedColor* src, std::size_t srcStep, APE::Color* dst, std::size_t count) {
+    int32_t color;
+    std::memcpy(&color, src, sizeof(color));
+    __m128i sv = _mm_set1_epi32(color);
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        if (srcStep) sv = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i dv = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), BlendColorsSSE2(operation, sv, dv));
+    }
+    BlendColorSpanScalar(operation, src + i * srcStep, srcStep, dst + i, count - i);
+}
+#else
+void APE::BlendColorSpanSSE2(BlendOperation operation, const APE::PremultipliedColor* src, std::size_t srcStep, APE::Color* dst, std::size_t count) {
+    BlendColorSpanScalar(operation, src, srcStep, dst, count);
+}
+#endif
@@ -1,49 +1,1042 @@
-#include "APE/APE_Color.h"
-
-APE::Color::Color() = default;
-APE::Color::Color(uint8_t rgba) : Red(rgba), Green(rgba), Blue(rgba), Alpha(rgba) {}
-APE::Color::Color(uint8_t rgb, uint8_t a) : Red(rgb), Green(rgb), Blue(rgb), Alpha(a) {}
-APE::Color::Color(uint8_t r, uint8_t g, uint8_t b) : Red(r), Green(g), Blue(b), Alpha(255) {}
-APE::Color::Color(uint8_t r, uint8_t g, uint8_t b, uint8_t a) : Red(r), Green(g), Blue(b), Alpha(a) {}
-APE::Color::Color(const Color& c, uint8_t a) : Red(c.Red), Green(c.Green), Blue(c.Blue), Alpha(a) {}
-APE::Color::Color(const APE::Color& c) : Red(c.Red), Green(c.Green), Blue(c.Blue), Alpha(c.Alpha) {}
-
-APE::Color& APE::Color::operator=(uint8_t rgba) {
-    Red = rgba; Green = rgba; Blue = rgba; Alpha = rgba; return *this;
-}
-APE::Color& APE::Color::operator=(const APE::Color& c) {
-    Red = c.Red; Green = c.Green; Blue = c.Blue; Alpha = c.Alpha; return *this;
-}
+#include "APE_Color_Span.h"
 
-bool APE::Color::operator==(uint8_t rgba) const {
-    return Red == rgba && Green == rgba && Blue == rgba && Alpha == rgba;
-}
-bool APE::Color::operator==(const Color& c) const {
-    return Red == c.Red && Green == c.Green && Blue == c.Blue && Alpha == c.Alpha;
-}
-bool APE::Color::operator!=(uint8_t rgba) const {
-    return Red != rgba || Green != rgba || Blue != rgba || Alpha != rgba;
-}
-bool APE::Color::operator!=(const Color& c) const {
-    return Red != c.Red || Green != c.Green || Blue != c.Blue || Alpha != c.Alpha;
+#include <cstdint>
+#include <cstring>
+
+#include <SDL2/SDL_cpuinfo.h>
+
+
+namespace {
+    struct NamedColor {
+        std::string_view Name;
+        APE::Color Value;
+    };
+
+    // In the same order as their declaration in KnownColor.
+    constexpr NamedColor KnownColors[] = {
+        { "AbsoluteZero", APE::KnownColor::AbsoluteZero },
+        { "AcidGreen", APE::KnownColor::AcidGreen },
+        { "Aero", APE::KnownColor::Aero },
+        { "AfricanViolet", APE::KnownColor::AfricanViolet },
+        { "AirSuperiorityBlue", APE::KnownColor::AirSuperiorityBlue },
+        { "AliceBlue", APE::KnownColor::AliceBlue },
+        { "Alizarin", APE::KnownColor::Alizarin },
+        { "AlloyOrange", APE::KnownColor::AlloyOrange },
+        { "Almond", APE::KnownColor::Almond },
+        { "AmaranthDeepPurple", APE::KnownColor::AmaranthDeepPurple },
+        { "AmaranthPink", APE::KnownColor::AmaranthPink },
+        { "AmaranthPurple", APE::KnownColor::AmaranthPurple },
+        { "Amazon", APE::KnownColor::Amazon },
+        { "Amber", APE::KnownColor::Amber },
+        { "Amethyst", APE::KnownColor::Amethyst },
+        { "AndroidGreen", APE::KnownColor::AndroidGreen },
+        { "AntiqueBrass", APE::KnownColor::AntiqueBrass },
+        { "AntiqueBronze", APE::KnownColor::AntiqueBronze },
+        { "AntiqueFuchsia", APE::KnownColor::AntiqueFuchsia },
+        { "AntiqueRuby", APE::KnownColor::AntiqueRuby },
+        { "AntiqueWhite", APE::KnownColor::AntiqueWhite },
+        { "Apricot", APE::KnownColor::Apricot },
+        { "Aqua", APE::KnownColor::Aqua },
+        { "Aquamarine", APE::KnownColor::Aquamarine },
+        { "ArcticLime", APE::KnownColor::ArcticLime },
+        { "ArtichokeGreen", APE::KnownColor::ArtichokeGreen },
+        { "ArylideYellow", APE::KnownColor::ArylideYellow },
+        { "AshGray", APE::KnownColor::AshGray },
+        { "AtomicTangerine", APE::KnownColor::AtomicTangerine },
+        { "Aureolin", APE::KnownColor::Aureolin },
+        { "Azure", APE::KnownColor::Azure },
+        { "AzureX11WebColor", APE::KnownColor::AzureX11WebColor },
+        { "BabyBlue", APE::KnownColor::BabyBlue },
+        { "BabyBlueEyes", APE::KnownColor::BabyBlueEyes },
+        { "BabyPink", APE::KnownColor::BabyPink },
+        { "BabyPowder", APE::KnownColor::BabyPowder },
+        { "BakerMillerPink", APE::KnownColor::BakerMillerPink },
+        { "BananaMania", APE::KnownColor::BananaMania },
+        { "BarbiePink", APE::KnownColor::BarbiePink },
+        { "BarnRed", APE::KnownColor::BarnRed },
+        { "BattleshipGrey", APE::KnownColor::BattleshipGrey },
+        { "BeauBlue", APE::KnownColor::BeauBlue },
+        { "Beaver", APE::KnownColor::Beaver },
+        { "Beige", APE::KnownColor::Beige },
+        { "BDazzledBlue", APE::KnownColor::BDazzledBlue },
+        { "BigDipORuby", APE::KnownColor::BigDipORuby },
+        { "Bisque", APE::KnownColor::Bisque },
+        { "Bistre", APE::KnownColor::Bistre },
+        { "BistreBrown", APE::KnownColor::BistreBrown },
+        { "BitterLemon", APE::KnownColor::BitterLemon },
+        { "Black", APE::KnownColor::Black },
+        { "BlackBean", APE::KnownColor::BlackBean },
+        { "BlackCoral", APE::KnownColor::BlackCoral },
+        { "BlackOlive", APE::KnownColor::BlackOlive },
+        { "BlackShadows", APE::KnownColor::BlackShadows },
+        { "BlanchedAlmond", APE::KnownColor::BlanchedAlmond },
+        { "BlastOffBronze", APE::KnownColor::BlastOffBronze },
+        { "BleuDeFrance", APE::KnownColor::BleuDeFrance },
+        { "BlizzardBlue", APE::KnownColor::BlizzardBlue },
+        { "BloodRed", APE::KnownColor::BloodRed },
+        { "Blue", APE::KnownColor::Blue },
+        { "BlueCrayola", APE::KnownColor::BlueCrayola },
+        { "BlueMunsell", APE::KnownColor::BlueMunsell },
+        { "BlueNcs", APE::KnownColor::BlueNcs },
+        { "BluePantone", APE::KnownColor::BluePantone },
+        { "BluePigment", APE::KnownColor::BluePigment },
+        { "BlueBell", APE::KnownColor::BlueBell },
+        { "BlueGrayCrayola", APE::KnownColor::BlueGrayCrayola },
+        { "BlueJeans", APE::KnownColor::BlueJeans },
+        { "BlueSapphire", APE::KnownColor::BlueSapphire },
+        { "BlueViolet", APE::KnownColor::BlueViolet },
+        { "BlueYonder", APE::KnownColor::BlueYonder },
+        { "Bluetiful", APE::KnownColor::Bluetiful },
+        { "Blush", APE::KnownColor::Blush },
+        { "Bole", APE::KnownColor::Bole },
+        { "Bone", APE::KnownColor::Bone },
+        { "BrickRed", APE::KnownColor::BrickRed },
+        { "BrightLilac", APE::KnownColor::BrightLilac },
+        { "BrightYellowCrayola", APE::KnownColor::BrightYellowCrayola },
+        { "Bronze", APE::KnownColor::Bronze },
+        { "Brown", APE::KnownColor::Brown },
+        { "BrownSugar", APE::KnownColor::BrownSugar },
+        { "BudGreen", APE::KnownColor::BudGreen },
+        { "Buff", APE::KnownColor::Buff },
+        { "Burgundy", APE::KnownColor::Burgundy },
+        { "Burlywood", APE::KnownColor::Burlywood },
+        { "BurnishedBrown", APE::KnownColor::BurnishedBrown },
+        { "BurntOrange", APE::KnownColor::BurntOrange },
+        { "BurntSienna", APE::KnownColor::BurntSienna },
+        { "BurntUmber", APE::KnownColor::BurntUmber },
+        { "Byzantine", APE::KnownColor::Byzantine },
+        { "Byzantium", APE::KnownColor::Byzantium },
+        { "CadetBlue", APE::KnownColor::CadetBlue },
+        { "CadetGrey", APE::KnownColor::CadetGrey },
+        { "CadmiumGreen", APE::KnownColor::CadmiumGreen },
+        { "CadmiumOrange", APE::KnownColor::CadmiumOrange },
+        { "CafeAuLait", APE::KnownColor::CafeAuLait },
+        { "CafeNoir", APE::KnownColor::CafeNoir },
+        { "CambridgeBlue", APE::KnownColor::CambridgeBlue },
+        { "Camel", APE::KnownColor::Camel },
+        { "CameoPink", APE::KnownColor::CameoPink },
+        { "Canary", APE::KnownColor::Canary },
+        { "CanaryYellow", APE::KnownColor::CanaryYellow },
+        { "CandyPink", APE::KnownColor::CandyPink },
+        { "Cardinal", APE::KnownColor::Cardinal },
+        { "CaribbeanGreen", APE::KnownColor::CaribbeanGreen },
+        { "Carmine", APE::KnownColor::Carmine },
+        { "CarmineMP", APE::KnownColor::CarmineMP },
+        { "CarnationPink", APE::KnownColor::CarnationPink },
+        { "Carnelian", APE::KnownColor::Carnelian },
+        { "CarolinaBlue", APE::KnownColor::CarolinaBlue },
+        { "CarrotOrange", APE::KnownColor::CarrotOrange },
+        { "Catawba", APE::KnownColor::Catawba },
+        { "CedarChest", APE::KnownColor::CedarChest },
+        { "Celadon", APE::KnownColor::Celadon },
+        { "Celeste", APE::KnownColor::Celeste },
+        { "Cerise", APE::KnownColor::Cerise },
+        { "Cerulean", APE::KnownColor::Cerulean },
+        { "CeruleanBlue", APE::KnownColor::CeruleanBlue },
+        { "CeruleanFrost", APE::KnownColor::CeruleanFrost },
+        { "CeruleanCrayola", APE::KnownColor::CeruleanCrayola },
+        { "CeruleanRgb", APE::KnownColor::CeruleanRgb },
+        { "Champagne", APE::KnownColor::Champagne },
+        { "ChampagnePink", APE::KnownColor::ChampagnePink },
+        { "Charcoal", APE::KnownColor::Charcoal },
+        { "CharmPink", APE::KnownColor::CharmPink },
+        { "ChartreuseWeb", APE::KnownColor::ChartreuseWeb },
+        { "CherryBlossomPink", APE::KnownColor::CherryBlossomPink },
+        { "Chestnut", APE::KnownColor::Chestnut },
+        { "ChiliRed", APE::KnownColor::ChiliRed },
+        { "ChinaPink", APE::KnownColor::ChinaPink },
+        { "ChineseRed", APE::KnownColor::ChineseRed },
+        { "ChineseViolet", APE::KnownColor::ChineseViolet },
+        { "ChineseYellow", APE::KnownColor::ChineseYellow },
+        { "ChocolateTraditional", APE::KnownColor::ChocolateTraditional },
+        { "ChocolateWeb", APE::KnownColor::ChocolateWeb },
+        { "Cinereous", APE::KnownColor::Cinereous },
+        { "Cinnabar", APE::KnownColor::Cinnabar },
+        { "CinnamonSatin", APE::KnownColor::CinnamonSatin },
+        { "Citrine", APE::KnownColor::Citrine },
+        { "Citron", APE::KnownColor::Citron },
+        { "Claret", APE::KnownColor::Claret },
+        { "Coffee", APE::KnownColor::Coffee },
+        { "ColumbiaBlue", APE::KnownColor::ColumbiaBlue },
+        { "CongoPink", APE::KnownColor::CongoPink },
+        { "CoolGrey", APE::KnownColor::CoolGrey },
+        { "Copper", APE::KnownColor::Copper },
+        { "CopperCrayola", APE::KnownColor::CopperCrayola },
+        { "CopperPenny", APE::KnownColor::CopperPenny },
+        { "CopperRed", APE::KnownColor::CopperRed },
+        { "CopperRose", APE::KnownColor::CopperRose },
+        { "Coquelicot", APE::KnownColor::Coquelicot },
+        { "Coral", APE::KnownColor::Coral },
+        { "CoralPink", APE::KnownColor::CoralPink },
+        { "Cordovan", APE::KnownColor::Cordovan },
+        { "Corn", APE::KnownColor::Corn },
+        { "CornflowerBlue", APE::KnownColor::CornflowerBlue },
+        { "Cornsilk", APE::KnownColor::Cornsilk },
+        { "CosmicCobalt", APE::KnownColor::CosmicCobalt },
+        { "CosmicLatte", APE::KnownColor::CosmicLatte },
+        { "CoyoteBrown", APE::KnownColor::CoyoteBrown },
+        { "CottonCandy", APE::KnownColor::CottonCandy },
+        { "Cream", APE::KnownColor::Cream },
+        { "Crimson", APE::KnownColor::Crimson },
+        { "CrimsonUa", APE::KnownColor::CrimsonUa },
+        { "CulturedPearl", APE::KnownColor::CulturedPearl },
+        { "Cyan", APE::KnownColor::Cyan },
+        { "CyanProcess", APE::KnownColor::CyanProcess },
+        { "CyberGrape", APE::KnownColor::CyberGrape },
+        { "CyberYellow", APE::KnownColor::CyberYellow },
+        { "Cyclamen", APE::KnownColor::Cyclamen },
+        { "Dandelion", APE::KnownColor::Dandelion },
+        { "DarkBrown", APE::KnownColor::DarkBrown },
+        { "DarkByzantium", APE::KnownColor::DarkByzantium },
+        { "DarkCyan", APE::KnownColor::DarkCyan },
+        { "DarkElectricBlue", APE::KnownColor::DarkElectricBlue },
+        { "DarkGoldenrod", APE::KnownColor::DarkGoldenrod },
+        { "DarkGreenX11", APE::KnownColor::DarkGreenX11 },
+        { "DarkJungleGreen", APE::KnownColor::DarkJungleGreen },
+        { "DarkKhaki", APE::KnownColor::DarkKhaki },
+        { "DarkLava", APE::KnownColor::DarkLava },
+        { "DarkLiverHorses", APE::KnownColor::DarkLiverHorses },
+        { "DarkMagenta", APE::KnownColor::DarkMagenta },
+        { "DarkOliveGreen", APE::KnownColor::DarkOliveGreen },
+        { "DarkOrange", APE::KnownColor::DarkOrange },
+        { "DarkOrchid", APE::KnownColor::DarkOrchid },
+        { "DarkPurple", APE::KnownColor::DarkPurple },
+        { "DarkRed", APE::KnownColor::DarkRed },
+        { "DarkSalmon", APE::KnownColor::DarkSalmon },
+        { "DarkSeaGreen", APE::KnownColor::DarkSeaGreen },
+        { "DarkSienna", APE::KnownColor::DarkSienna },
+        { "DarkSkyBlue", APE::KnownColor::DarkSkyBlue },
+        { "DarkSlateBlue", APE::KnownColor::DarkSlateBlue },
+        { "DarkSlateGray", APE::KnownColor::DarkSlateGray },
+        { "DarkSpringGreen", APE::KnownColor::DarkSpringGreen },
+        { "DarkTurquoise", APE::KnownColor::DarkTurquoise },
+        { "DarkViolet", APE::KnownColor::DarkViolet },
+        { "DavySGrey", APE::KnownColor::DavySGrey },
+        { "DeepCerise", APE::KnownColor::DeepCerise },
+        { "DeepChampagne", APE::KnownColor::DeepChampagne },
+        { "DeepChestnut", APE::KnownColor::DeepChestnut },
+        { "DeepJungleGreen", APE::KnownColor::DeepJungleGreen },
+        { "DeepPink", APE::KnownColor::DeepPink },
+        { "DeepSaffron", APE::KnownColor::DeepSaffron },
+        { "DeepSkyBlue", APE::KnownColor::DeepSkyBlue },
+        { "DeepSpaceSparkle", APE::KnownColor::DeepSpaceSparkle },
+        { "DeepTaupe", APE::KnownColor::DeepTaupe },
+        { "Denim", APE::KnownColor::Denim },
+        { "DenimBlue", APE::KnownColor::DenimBlue },
+        { "Desert", APE::KnownColor::Desert },
+        { "DesertSand", APE::KnownColor::DesertSand },
+        { "DimGray", APE::KnownColor::DimGray },
+        { "DodgerBlue", APE::KnownColor::DodgerBlue },
+        { "DrabDarkBrown", APE::KnownColor::DrabDarkBrown },
+        { "DukeBlue", APE::KnownColor::DukeBlue },
+        { "DutchWhite", APE::KnownColor::DutchWhite },
+        { "Ebony", APE::KnownColor::Ebony },
+        { "Ecru", APE::KnownColor::Ecru },
+        { "EerieBlack", APE::KnownColor::EerieBlack },
+        { "Eggplant", APE::KnownColor::Eggplant },
+        { "Eggshell", APE::KnownColor::Eggshell },
+        { "ElectricLime", APE::KnownColor::ElectricLime },
+        { "ElectricPurple", APE::KnownColor::ElectricPurple },
+        { "ElectricViolet", APE::KnownColor::ElectricViolet },
+        { "Emerald", APE::KnownColor::Emerald },
+        { "Eminence", APE::KnownColor::Eminence },
+        { "EnglishLavender", APE::KnownColor::EnglishLavender },
+        { "EnglishRed", APE::KnownColor::EnglishRed },
+        { "EnglishVermillion", APE::KnownColor::EnglishVermillion },
+        { "EnglishViolet", APE::KnownColor::EnglishViolet },
+        { "Erin", APE::KnownColor::Erin },
+        { "EtonBlue", APE::KnownColor::EtonBlue },
+        { "Fallow", APE::KnownColor::Fallow },
+        { "FaluRed", APE::KnownColor::FaluRed },
+        { "Fandango", APE::KnownColor::Fandango },
+        { "FandangoPink", APE::KnownColor::FandangoPink },
+        { "Fawn", APE::KnownColor::Fawn },
+        { "FernGreen", APE::KnownColor::FernGreen },
+        { "FieldDrab", APE::KnownColor::FieldDrab },
+        { "FieryRose", APE::KnownColor::FieryRose },
+        { "Finn", APE::KnownColor::Finn },
+        { "Firebrick", APE::KnownColor::Firebrick },
+        { "FireEngineRed", APE::KnownColor::FireEngineRed },
+        { "Flame", APE::KnownColor::Flame },
+        { "Flax", APE::KnownColor::Flax },
+        { "Flirt", APE::KnownColor::Flirt },
+        { "FloralWhite", APE::KnownColor::FloralWhite },
+        { "ForestGreenWeb", APE::KnownColor::ForestGreenWeb },
+        { "FrenchBeige", APE::KnownColor::FrenchBeige },
+        { "FrenchBistre", APE::KnownColor::FrenchBistre },
+        { "FrenchBlue", APE::KnownColor::FrenchBlue },
+        { "FrenchFuchsia", APE::KnownColor::FrenchFuchsia },
+        { "FrenchLilac", APE::KnownColor::FrenchLilac },
+        { "FrenchLime", APE::KnownColor::FrenchLime },
+        { "FrenchMauve", APE::KnownColor::FrenchMauve },
+        { "FrenchPink", APE::KnownColor::FrenchPink },
+        { "FrenchRaspberry", APE::KnownColor::FrenchRaspberry },
+        { "FrenchSkyBlue", APE::KnownColor::FrenchSkyBlue },
+        { "FrenchViolet", APE::KnownColor::FrenchViolet },
+        { "Frostbite", APE::KnownColor::Frostbite },
+        { "Fuchsia", APE::KnownColor::Fuchsia },
+        { "FuchsiaCrayola", APE::KnownColor::FuchsiaCrayola },
+        { "Fulvous", APE::KnownColor::Fulvous },
+        { "FuzzyWuzzy", APE::KnownColor::FuzzyWuzzy },
+        { "Gainsboro", APE::KnownColor::Gainsboro },
+        { "Gamboge", APE::KnownColor::Gamboge },
+        { "GenericViridian", APE::KnownColor::GenericViridian },
+        { "GhostWhite", APE::KnownColor::GhostWhite },
+        { "Glaucous", APE::KnownColor::Glaucous },
+        { "GlossyGrape", APE::KnownColor::GlossyGrape },
+        { "GoGreen", APE::KnownColor::GoGreen },
+        { "GoldMetallic", APE::KnownColor::GoldMetallic },
+        { "GoldWebGolden", APE::KnownColor::GoldWebGolden },
+        { "GoldCrayola", APE::KnownColor::GoldCrayola },
+        { "GoldFusion", APE::KnownColor::GoldFusion },
+        { "GoldenBrown", APE::KnownColor::GoldenBrown },
+        { "GoldenPoppy", APE::KnownColor::GoldenPoppy },
+        { "GoldenYellow", APE::KnownColor::GoldenYellow },
+        { "Goldenrod", APE::KnownColor::Goldenrod },
+        { "GothamGreen", APE::KnownColor::GothamGreen },
+        { "GraniteGray", APE::KnownColor::GraniteGray },
+        { "GrannySmithApple", APE::KnownColor::GrannySmithApple },
+        { "GrayWeb", APE::KnownColor::GrayWeb },
+        { "GrayX11Gray", APE::KnownColor::GrayX11Gray },
+        { "Green", APE::KnownColor::Green },
+        { "GreenCrayola", APE::KnownColor::GreenCrayola },
+        { "GreenWeb", APE::KnownColor::GreenWeb },
+        { "GreenMunsell", APE::KnownColor::GreenMunsell },
+        { "GreenNcs", APE::KnownColor::GreenNcs },
+        { "GreenPantone", APE::KnownColor::GreenPantone },
+        { "GreenPigment", APE::KnownColor::GreenPigment },
+        { "GreenBlue", APE::KnownColor::GreenBlue },
+        { "GreenLizard", APE::KnownColor::GreenLizard },
+        { "GreenSheen", APE::KnownColor::GreenSheen },
+        { "Gunmetal", APE::KnownColor::Gunmetal },
+        { "HansaYellow", APE::KnownColor::HansaYellow },
+        { "Harlequin", APE::KnownColor::Harlequin },
+        { "HarvestGold", APE::KnownColor::HarvestGold },
+        { "HeatWave", APE::KnownColor::HeatWave },
+        { "Heliotrope", APE::KnownColor::Heliotrope },
+        { "HeliotropeGray", APE::KnownColor::HeliotropeGray },
+        { "HollywoodCerise", APE::KnownColor::HollywoodCerise },
+        { "HonoluluBlue", APE::KnownColor::HonoluluBlue },
+        { "HookerSGreen", APE::KnownColor::HookerSGreen },
+        { "HotMagenta", APE::KnownColor::HotMagenta },
+        { "HotPink", APE::KnownColor::HotPink },
+        { "HunterGreen", APE::KnownColor::HunterGreen },
+        { "Iceberg", APE::KnownColor::Iceberg },
+        { "IlluminatingEmerald", APE::KnownColor::IlluminatingEmerald },
+        { "ImperialRed", APE::KnownColor::ImperialRed },
+        { "Inchworm", APE::KnownColor::Inchworm },
+        { "Independence", APE::KnownColor::Independence },
+        { "IndiaGreen", APE::KnownColor::IndiaGreen },
+        { "IndianRed", APE::KnownColor::IndianRed },
+        { "IndianYellow", APE::KnownColor::IndianYellow },
+        { "Indigo", APE::KnownColor::Indigo },
+        { "IndigoDye", APE::KnownColor::IndigoDye },
+        { "InternationalKleinBlue", APE::KnownColor::InternationalKleinBlue },
+        { "InternationalOrangeEngineering", APE::KnownColor::InternationalOrangeEngineering },
+        { "InternationalOrangeGoldenGateBridge", APE::KnownColor::InternationalOrangeGoldenGateBridge },
+        { "Irresistible", APE::KnownColor::Irresistible },
+        { "Isabelline", APE::KnownColor::Isabelline },
+        { "ItalianSkyBlue", APE::KnownColor::ItalianSkyBlue },
+        { "Ivory", APE::KnownColor::Ivory },
+        { "JapaneseCarmine", APE::KnownColor::JapaneseCarmine },
+        { "JapaneseViolet", APE::KnownColor::JapaneseViolet },
+        { "Jasmine", APE::KnownColor::Jasmine },
+        { "JazzberryJam", APE::KnownColor::JazzberryJam },
+        { "Jet", APE::KnownColor::Jet },
+        { "Jonquil", APE::KnownColor::Jonquil },
+        { "JuneBud", APE::KnownColor::JuneBud },
+        { "JungleGreen", APE::KnownColor::JungleGreen },
+        { "KellyGreen", APE::KnownColor::KellyGreen },
+        { "Keppel", APE::KnownColor::Keppel },
+        { "KeyLime", APE::KnownColor::KeyLime },
+        { "KhakiWeb", APE::KnownColor::KhakiWeb },
+        { "KhakiX11LightKhaki", APE::KnownColor::KhakiX11LightKhaki },
+        { "Kobe", APE::KnownColor::Kobe },
+        { "Kobi", APE::KnownColor::Kobi },
+        { "Kobicha", APE::KnownColor::Kobicha },
+        { "KsuPurple", APE::KnownColor::KsuPurple },
+        { "LanguidLavender", APE::KnownColor::LanguidLavender },
+        { "LapisLazuli", APE::KnownColor::LapisLazuli },
+        { "LaserLemon", APE::KnownColor::LaserLemon },
+        { "LaurelGreen", APE::KnownColor::LaurelGreen },
+        { "Lava", APE::KnownColor::Lava },
+        { "LavenderFloral", APE::KnownColor::LavenderFloral },
+        { "LavenderWeb", APE::KnownColor::LavenderWeb },
+        { "LavenderBlue", APE::KnownColor::LavenderBlue },
+        { "LavenderBlush", APE::KnownColor::LavenderBlush },
+        { "LavenderGray", APE::KnownColor::LavenderGray },
+        { "LawnGreen", APE::KnownColor::LawnGreen },
+        { "Lemon", APE::KnownColor::Lemon },
+        { "LemonChiffon", APE::KnownColor::LemonChiffon },
+        { "LemonCurry", APE::KnownColor::LemonCurry },
+        { "LemonGlacier", APE::KnownColor::LemonGlacier },
+        { "LemonMeringue", APE::KnownColor::LemonMeringue },
+        { "LemonYellow", APE::KnownColor::LemonYellow },
+        { "LemonYellowCrayola", APE::KnownColor::LemonYellowCrayola },
+        { "Liberty", APE::KnownColor::Liberty },
+        { "LightBlue", APE::KnownColor::LightBlue },
+        { "LightCoral", APE::KnownColor::LightCoral },
+        { "LightCornflowerBlue", APE::KnownColor::LightCornflowerBlue },
+        { "LightCyan", APE::KnownColor::LightCyan },
+        { "LightFrenchBeige", APE::KnownColor::LightFrenchBeige },
+        { "LightGoldenrodYellow", APE::KnownColor::LightGoldenrodYellow },
+        { "LightGray", APE::KnownColor::LightGray },
+        { "LightGreen", APE::KnownColor::LightGreen },
+        { "LightOrange", APE::KnownColor::LightOrange },
+        { "LightPeriwinkle", APE::KnownColor::LightPeriwinkle },
+        { "LightPink", APE::KnownColor::LightPink },
+        { "LightSalmon", APE::KnownColor::LightSalmon },
+        { "LightSeaGreen", APE::KnownColor::LightSeaGreen },
+        { "LightSkyBlue", APE::KnownColor::LightSkyBlue },
+        { "LightSlateGray", APE::KnownColor::LightSlateGray },
+        { "LightSteelBlue", APE::KnownColor::LightSteelBlue },
+        { "LightYellow", APE::KnownColor::LightYellow },
+        { "Lilac", APE::KnownColor::Lilac },
+        { "LilacLuster", APE::KnownColor::LilacLuster },
+        { "LimeColorWheel", APE::KnownColor::LimeColorWheel },
+        { "LimeWebX11Green", APE::KnownColor::LimeWebX11Green },
+        { "LimeGreen", APE::KnownColor::LimeGreen },
+        { "LincolnGreen", APE::KnownColor::LincolnGreen },
+        { "Linen", APE::KnownColor::Linen },
+        { "Lion", APE::KnownColor::Lion },
+        { "LiseranPurple", APE::KnownColor::LiseranPurple },
+        { "LittleBoyBlue", APE::KnownColor::LittleBoyBlue },
+        { "Liver", APE::KnownColor::Liver },
+        { "LiverDogs", APE::KnownColor::LiverDogs },
+        { "LiverOrgan", APE::KnownColor::LiverOrgan },
+        { "LiverChestnut", APE::KnownColor::LiverChestnut },
+        { "Livid", APE::KnownColor::Livid },
+        { "MacaroniAndCheese", APE::KnownColor::MacaroniAndCheese },
+        { "MadderLake", APE::KnownColor::MadderLake },
+        { "Magenta", APE::KnownColor::Magenta },
+        { "MagentaCrayola", APE::KnownColor::MagentaCrayola },
+        { "MagentaDye", APE::KnownColor::MagentaDye },
+        { "MagentaPantone", APE::KnownColor::MagentaPantone },
+        { "MagentaProcess", APE::KnownColor::MagentaProcess },
+        { "MagentaHaze", APE::KnownColor::MagentaHaze },
+        { "MagicMint", APE::KnownColor::MagicMint },
+        { "Magnolia", APE::KnownColor::Magnolia },
+        { "Mahogany", APE::KnownColor::Mahogany },
+        { "Maize", APE::KnownColor::Maize },
+        { "MaizeCrayola", APE::KnownColor::MaizeCrayola },
+        { "MajorelleBlue", APE::KnownColor::MajorelleBlue },
+        { "Malachite", APE::KnownColor::Malachite },
+        { "Manatee", APE::KnownColor::Manatee },
+        { "Mandarin", APE::KnownColor::Mandarin },
+        { "Mango", APE::KnownColor::Mango },
+        { "MangoTango", APE::KnownColor::MangoTango },
+        { "Mantis", APE::KnownColor::Mantis },
+        { "MardiGras", APE::KnownColor::MardiGras },
+        { "Marigold", APE::KnownColor::Marigold },
+        { "MaroonCrayola", APE::KnownColor::MaroonCrayola },
+        { "MaroonWeb", APE::KnownColor::MaroonWeb },
+        { "MaroonX11", APE::KnownColor::MaroonX11 },
+        { "Mauve", APE::KnownColor::Mauve },
+        { "MauveTaupe", APE::KnownColor::MauveTaupe },
+        { "Mauvelous", APE::KnownColor::Mauvelous },
+        { "MaximumBlue", APE::KnownColor::MaximumBlue },
+        { "MaximumBlueGreen", APE::KnownColor::MaximumBlueGreen },
+        { "MaximumBluePurple", APE::KnownColor::MaximumBluePurple },
+        { "MaximumGreen", APE::KnownColor::MaximumGreen },
+        { "MaximumGreenYellow", APE::KnownColor::MaximumGreenYellow },
+        { "MaximumPurple", APE::KnownColor::MaximumPurple },
+        { "MaximumRed", APE::KnownColor::MaximumRed },
+        { "MaximumRedPurple", APE::KnownColor::MaximumRedPurple },
+        { "MaximumYellow", APE::KnownColor::MaximumYellow },
+        { "MaximumYellowRed", APE::KnownColor::MaximumYellowRed },
+        { "MayGreen", APE::KnownColor::MayGreen },
+        { "MayaBlue", APE::KnownColor::MayaBlue },
+        { "MediumAquamarine", APE::KnownColor::MediumAquamarine },
+        { "MediumBlue", APE::KnownColor::MediumBlue },
+        { "MediumCandyAppleRed", APE::KnownColor::MediumCandyAppleRed },
+        { "MediumCarmine", APE::KnownColor::MediumCarmine },
+        { "MediumChampagne", APE::KnownColor::MediumChampagne },
+        { "MediumOrchid", APE::KnownColor::MediumOrchid },
+        { "MediumPurple", APE::KnownColor::MediumPurple },
+        { "MediumSeaGreen", APE::KnownColor::MediumSeaGreen },
+        { "MediumSlateBlue", APE::KnownColor::MediumSlateBlue },
+        { "MediumSpringGreen", APE::KnownColor::MediumSpringGreen },
+        { "MediumTurquoise", APE::KnownColor::MediumTurquoise },
+        { "MediumVioletRed", APE::KnownColor::MediumVioletRed },
+        { "MellowApricot", APE::KnownColor::MellowApricot },
+        { "MellowYellow", APE::KnownColor::MellowYellow },
+        { "Melon", APE::KnownColor::Melon },
+        { "MetallicGold", APE::KnownColor::MetallicGold },
+        { "MetallicSeaweed", APE::KnownColor::MetallicSeaweed },
+        { "MetallicSunburst", APE::KnownColor::MetallicSunburst },
+        { "MexicanPink", APE::KnownColor::MexicanPink },
+        { "MiddleBlue", APE::KnownColor::MiddleBlue },
+        { "MiddleBlueGreen", APE::KnownColor::MiddleBlueGreen },
+        { "MiddleBluePurple", APE::KnownColor::MiddleBluePurple },
+        { "MiddleGrey", APE::KnownColor::MiddleGrey },
+        { "MiddleGreen", APE::KnownColor::MiddleGreen },
+        { "MiddleGreenYellow", APE::KnownColor::MiddleGreenYellow },
+        { "MiddlePurple", APE::KnownColor::MiddlePurple },
+        { "MiddleRed", APE::KnownColor::MiddleRed },
+        { "MiddleRedPurple", APE::KnownColor::MiddleRedPurple },
+        { "MiddleYellow", APE::KnownColor::MiddleYellow },
+        { "MiddleYellowRed", APE::KnownColor::MiddleYellowRed },
+        { "Midnight", APE::KnownColor::Midnight },
+        { "MidnightBlue", APE::KnownColor::MidnightBlue },
+        { "MidnightGreenEagleGreen", APE::KnownColor::MidnightGreenEagleGreen },
+        { "MikadoYellow", APE::KnownColor::MikadoYellow },
+        { "MimiPink", APE::KnownColor::MimiPink },
+        { "Mindaro", APE::KnownColor::Mindaro },
+        { "Ming", APE::KnownColor::Ming },
+        { "MinionYellow", APE::KnownColor::MinionYellow },
+        { "Mint", APE::KnownColor::Mint },
+        { "MintCream", APE::KnownColor::MintCream },
+        { "MintGreen", APE::KnownColor::MintGreen },
+        { "MistyMoss", APE::KnownColor::MistyMoss },
+        { "MistyRose", APE::KnownColor::MistyRose },
+        { "ModeBeige", APE::KnownColor::ModeBeige },
+        { "MonaLisa", APE::KnownColor::MonaLisa },
+        { "MorningBlue", APE::KnownColor::MorningBlue },
+        { "MossGreen", APE::KnownColor::MossGreen },
+        { "MountainMeadow", APE::KnownColor::MountainMeadow },
+        { "MountbattenPink", APE::KnownColor::MountbattenPink },
+        { "MsuGreen", APE::KnownColor::MsuGreen },
+        { "Mulberry", APE::KnownColor::Mulberry },
+        { "MulberryCrayola", APE::KnownColor::MulberryCrayola },
+        { "Mustard", APE::KnownColor::Mustard },
+        { "MyrtleGreen", APE::KnownColor::MyrtleGreen },
+        { "Mystic", APE::KnownColor::Mystic },
+        { "MysticMaroon", APE::KnownColor::MysticMaroon },
+        { "NadeshikoPink", APE::KnownColor::NadeshikoPink },
+        { "NaplesYellow", APE::KnownColor::NaplesYellow },
+        { "NavajoWhite", APE::KnownColor::NavajoWhite },
+        { "NavyBlue", APE::KnownColor::NavyBlue },
+        { "NavyBlueCrayola", APE::KnownColor::NavyBlueCrayola },
+        { "NeonBlue", APE::KnownColor::NeonBlue },
+        { "NeonGreen", APE::KnownColor::NeonGreen },
+        { "NeonFuchsia", APE::KnownColor::NeonFuchsia },
+        { "NewCar", APE::KnownColor::NewCar },
+        { "NewYorkPink", APE::KnownColor::NewYorkPink },
+        { "Nickel", APE::KnownColor::Nickel },
+        { "NonPhotoBlue", APE::KnownColor::NonPhotoBlue },
+        { "Nyanza", APE::KnownColor::Nyanza },
+        { "Ochre", APE::KnownColor::Ochre },
+        { "OldBurgundy", APE::KnownColor::OldBurgundy },
+        { "OldGold", APE::KnownColor::OldGold },
+        { "OldLace", APE::KnownColor::OldLace },
+        { "OldLavender", APE::KnownColor::OldLavender },
+        { "OldMauve", APE::KnownColor::OldMauve },
+        { "OldRose", APE::KnownColor::OldRose },
+        { "OldSilver", APE::KnownColor::OldSilver },
+        { "Olive", APE::KnownColor::Olive },
+        { "OliveDrab3", APE::KnownColor::OliveDrab3 },
+        { "OliveDrab7", APE::KnownColor::OliveDrab7 },
+        { "OliveGreen", APE::KnownColor::OliveGreen },
+        { "Olivine", APE::KnownColor::Olivine },
+        { "Onyx", APE::KnownColor::Onyx },
+        { "Opal", APE::KnownColor::Opal },
+        { "OperaMauve", APE::KnownColor::OperaMauve },
+        { "Orange", APE::KnownColor::Orange },
+        { "OrangeCrayola", APE::KnownColor::OrangeCrayola },
+        { "OrangePantone", APE::KnownColor::OrangePantone },
+        { "OrangeWeb", APE::KnownColor::OrangeWeb },
+        { "OrangePeel", APE::KnownColor::OrangePeel },
+        { "OrangeRed", APE::KnownColor::OrangeRed },
+        { "OrangeRedCrayola", APE::KnownColor::OrangeRedCrayola },
+        { "OrangeSoda", APE::KnownColor::OrangeSoda },
+        { "OrangeYellow", APE::KnownColor::OrangeYellow },
+        { "OrangeYellowCrayola", APE::KnownColor::OrangeYellowCrayola },
+        { "Orchid", APE::KnownColor::Orchid },
+        { "OrchidPink", APE::KnownColor::OrchidPink },
+        { "OrchidCrayola", APE::KnownColor::OrchidCrayola },
+        { "OuterSpaceCrayola", APE::KnownColor::OuterSpaceCrayola },
+        { "OutrageousOrange", APE::KnownColor::OutrageousOrange },
+        { "Oxblood", APE::KnownColor::Oxblood },
+        { "OxfordBlue", APE::KnownColor::OxfordBlue },
+        { "OuCrimsonRed", APE::KnownColor::OuCrimsonRed },
+        { "PacificBlue", APE::KnownColor::PacificBlue },
+        { "PakistanGreen", APE::KnownColor::PakistanGreen },
+        { "PalatinatePurple", APE::KnownColor::PalatinatePurple },
+        { "PaleAqua", APE::KnownColor::PaleAqua },
+        { "PaleCerulean", APE::KnownColor::PaleCerulean },
+        { "PaleDogwood", APE::KnownColor::PaleDogwood },
+        { "PalePink", APE::KnownColor::PalePink },
+        { "PalePurplePantone", APE::KnownColor::PalePurplePantone },
+        { "PaleSpringBud", APE::KnownColor::PaleSpringBud },
+        { "PansyPurple", APE::KnownColor::PansyPurple },
+        { "PaoloVeroneseGreen", APE::KnownColor::PaoloVeroneseGreen },
+        { "PapayaWhip", APE::KnownColor::PapayaWhip },
+        { "ParadisePink", APE::KnownColor::ParadisePink },
+        { "Parchment", APE::KnownColor::Parchment },
+        { "ParisGreen", APE::KnownColor::ParisGreen },
+        { "PastelPink", APE::KnownColor::PastelPink },
+        { "Patriarch", APE::KnownColor::Patriarch },
+        { "Paua", APE::KnownColor::Paua },
+        { "PayneSGrey", APE::KnownColor::PayneSGrey },
+        { "Peach", APE::KnownColor::Peach },
+        { "PeachCrayola", APE::KnownColor::PeachCrayola },
+        { "PeachPuff", APE::KnownColor::PeachPuff },
+        { "Pear", APE::KnownColor::Pear },
+        { "PearlyPurple", APE::KnownColor::PearlyPurple },
+        { "Periwinkle", APE::KnownColor::Periwinkle },
+        { "PeriwinkleCrayola", APE::KnownColor::PeriwinkleCrayola },
+        { "PermanentGeraniumLake", APE::KnownColor::PermanentGeraniumLake },
+        { "PersianBlue", APE::KnownColor::PersianBlue },
+        { "PersianGreen", APE::KnownColor::PersianGreen },
+        { "PersianIndigo", APE::KnownColor::PersianIndigo },
+        { "PersianOrange", APE::KnownColor::PersianOrange },
+        { "PersianPink", APE::KnownColor::PersianPink },
+        { "PersianPlum", APE::KnownColor::PersianPlum },
+        { "PersianRed", APE::KnownColor::PersianRed },
+        { "PersianRose", APE::KnownColor::PersianRose },
+        { "Persimmon", APE::KnownColor::Persimmon },
+        { "PewterBlue", APE::KnownColor::PewterBlue },
+        { "Phlox", APE::KnownColor::Phlox },
+        { "PhthaloBlue", APE::KnownColor::PhthaloBlue },
+        { "PhthaloGreen", APE::KnownColor::PhthaloGreen },
+        { "PicoteeBlue", APE::KnownColor::PicoteeBlue },
+        { "PictorialCarmine", APE::KnownColor::PictorialCarmine },
+        { "PiggyPink", APE::KnownColor::PiggyPink },
+        { "PineGreen", APE::KnownColor::PineGreen },
+        { "PineTree", APE::KnownColor::PineTree },
+        { "Pink", APE::KnownColor::Pink },
+        { "PinkPantone", APE::KnownColor::PinkPantone },
+        { "PinkLace", APE::KnownColor::PinkLace },
+        { "PinkLavender", APE::KnownColor::PinkLavender },
+        { "PinkSherbet", APE::KnownColor::PinkSherbet },
+        { "Pistachio", APE::KnownColor::Pistachio },
+        { "Platinum", APE::KnownColor::Platinum },
+        { "Plum", APE::KnownColor::Plum },
+        { "PlumWeb", APE::KnownColor::PlumWeb },
+        { "PlumpPurple", APE::KnownColor::PlumpPurple },
+        { "PolishedPine", APE::KnownColor::PolishedPine },
+        { "PompAndPower", APE::KnownColor::PompAndPower },
+        { "Popstar", APE::KnownColor::Popstar },
+        { "PortlandOrange", APE::KnownColor::PortlandOrange },
+        { "PowderBlue", APE::KnownColor::PowderBlue },
+        { "PrairieGold", APE::KnownColor::PrairieGold },
+        { "PrincetonOrange", APE::KnownColor::PrincetonOrange },
+        { "ProcessYellow", APE::KnownColor::ProcessYellow },
+        { "Prune", APE::KnownColor::Prune },
+        { "PrussianBlue", APE::KnownColor::PrussianBlue },
+        { "PsychedelicPurple", APE::KnownColor::PsychedelicPurple },
+        { "Puce", APE::KnownColor::Puce },
+        { "PullmanBrownUpsBrown", APE::KnownColor::PullmanBrownUpsBrown },
+        { "Pumpkin", APE::KnownColor::Pumpkin },
+        { "Purple", APE::KnownColor::Purple },
+        { "PurpleWeb", APE::KnownColor::PurpleWeb },
+        { "PurpleMunsell", APE::KnownColor::PurpleMunsell },
+        { "PurpleX11", APE::KnownColor::PurpleX11 },
+        { "PurpleMountainMajesty", APE::KnownColor::PurpleMountainMajesty },
+        { "PurpleNavy", APE::KnownColor::PurpleNavy },
+        { "PurplePizzazz", APE::KnownColor::PurplePizzazz },
+        { "PurplePlum", APE::KnownColor::PurplePlum },
+        { "Purpureus", APE::KnownColor::Purpureus },
+        { "QueenBlue", APE::KnownColor::QueenBlue },
+        { "QueenPink", APE::KnownColor::QueenPink },
+        { "QuickSilver", APE::KnownColor::QuickSilver },
+        { "QuinacridoneMagenta", APE::KnownColor::QuinacridoneMagenta },
+        { "RadicalRed", APE::KnownColor::RadicalRed },
+        { "RaisinBlack", APE::KnownColor::RaisinBlack },
+        { "Rajah", APE::KnownColor::Rajah },
+        { "Raspberry", APE::KnownColor::Raspberry },
+        { "RaspberryGlace", APE::KnownColor::RaspberryGlace },
+        { "RaspberryRose", APE::KnownColor::RaspberryRose },
+        { "RawSienna", APE::KnownColor::RawSienna },
+        { "RawUmber", APE::KnownColor::RawUmber },
+        { "RazzleDazzleRose", APE::KnownColor::RazzleDazzleRose },
+        { "Razzmatazz", APE::KnownColor::Razzmatazz },
+        { "RazzmicBerry", APE::KnownColor::RazzmicBerry },
+        { "RebeccaPurple", APE::KnownColor::RebeccaPurple },
+        { "Red", APE::KnownColor::Red },
+        { "RedCrayola", APE::KnownColor::RedCrayola },
+        { "RedMunsell", APE::KnownColor::RedMunsell },
+        { "RedNcs", APE::KnownColor::RedNcs },
+        { "RedPantone", APE::KnownColor::RedPantone },
+        { "RedPigment", APE::KnownColor::RedPigment },
+        { "RedRyb", APE::KnownColor::RedRyb },
+        { "RedOrange", APE::KnownColor::RedOrange },
+        { "RedOrangeCrayola", APE::KnownColor::RedOrangeCrayola },
+        { "RedOrangeColorWheel", APE::KnownColor::RedOrangeColorWheel },
+        { "RedPurple", APE::KnownColor::RedPurple },
+        { "RedSalsa", APE::KnownColor::RedSalsa },
+        { "RedViolet", APE::KnownColor::RedViolet },
+        { "RedVioletCrayola", APE::KnownColor::RedVioletCrayola },
+        { "RedVioletColorWheel", APE::KnownColor::RedVioletColorWheel },
+        { "Redwood", APE::KnownColor::Redwood },
+        { "ResolutionBlue", APE::KnownColor::ResolutionBlue },
+        { "Rhythm", APE::KnownColor::Rhythm },
+        { "RichBlack", APE::KnownColor::RichBlack },
+        { "RichBlackFogra29", APE::KnownColor::RichBlackFogra29 },
+        { "RichBlackFogra39", APE::KnownColor::RichBlackFogra39 },
+        { "RifleGreen", APE::KnownColor::RifleGreen },
+        { "RobinEggBlue", APE::KnownColor::RobinEggBlue },
+        { "RocketMetallic", APE::KnownColor::RocketMetallic },
+        { "RojoSpanishRed", APE::KnownColor::RojoSpanishRed },
+        { "RomanSilver", APE::KnownColor::RomanSilver },
+        { "Rose", APE::KnownColor::Rose },
+        { "RoseBonbon", APE::KnownColor::RoseBonbon },
+        { "RoseDust", APE::KnownColor::RoseDust },
+        { "RoseEbony", APE::KnownColor::RoseEbony },
+        { "RoseMadder", APE::KnownColor::RoseMadder },
+        { "RosePink", APE::KnownColor::RosePink },
+        { "RosePompadour", APE::KnownColor::RosePompadour },
+        { "RoseRed", APE::KnownColor::RoseRed },
+        { "RoseTaupe", APE::KnownColor::RoseTaupe },
+        { "RoseVale", APE::KnownColor::RoseVale },
+        { "Rosewood", APE::KnownColor::Rosewood },
+        { "RossoCorsa", APE::KnownColor::RossoCorsa },
+        { "RosyBrown", APE::KnownColor::RosyBrown },
+        { "RoyalBlueDark", APE::KnownColor::RoyalBlueDark },
+        { "RoyalBlueLight", APE::KnownColor::RoyalBlueLight },
+        { "RoyalPurple", APE::KnownColor::RoyalPurple },
+        { "RoyalYellow", APE::KnownColor::RoyalYellow },
+        { "Ruber", APE::KnownColor::Ruber },
+        { "RubineRed", APE::KnownColor::RubineRed },
+        { "Ruby", APE::KnownColor::Ruby },
+        { "RubyRed", APE::KnownColor::RubyRed },
+        { "Rufous", APE::KnownColor::Rufous },
+        { "Russet", APE::KnownColor::Russet },
+        { "RussianGreen", APE::KnownColor::RussianGreen },
+        { "RussianViolet", APE::KnownColor::RussianViolet },
+        { "Rust", APE::KnownColor::Rust },
+        { "RustyRed", APE::KnownColor::RustyRed },
+        { "SacramentoStateGreen", APE::KnownColor::SacramentoStateGreen },
+        { "SaddleBrown", APE::KnownColor::SaddleBrown },
+        { "SafetyOrange", APE::KnownColor::SafetyOrange },
+        { "SafetyOrangeBlazeOrange", APE::KnownColor::SafetyOrangeBlazeOrange },
+        { "SafetyYellow", APE::KnownColor::SafetyYellow },
+        { "Saffron", APE::KnownColor::Saffron },
+        { "Sage", APE::KnownColor::Sage },
+        { "StPatrickSBlue", APE::KnownColor::StPatrickSBlue },
+        { "Salmon", APE::KnownColor::Salmon },
+        { "SalmonPink", APE::KnownColor::SalmonPink },
+        { "Sand", APE::KnownColor::Sand },
+        { "SandDune", APE::KnownColor::SandDune },
+        { "SandyBrown", APE::KnownColor::SandyBrown },
+        { "SapGreen", APE::KnownColor::SapGreen },
+        { "Sapphire", APE::KnownColor::Sapphire },
+        { "SapphireBlue", APE::KnownColor::SapphireBlue },
+        { "SapphireCrayola", APE::KnownColor::SapphireCrayola },
+        { "SatinSheenGold", APE::KnownColor::SatinSheenGold },
+        { "Scarlet", APE::KnownColor::Scarlet },
+        { "SchaussPink", APE::KnownColor::SchaussPink },
+        { "SchoolBusYellow", APE::KnownColor::SchoolBusYellow },
+        { "ScreaminGreen", APE::KnownColor::ScreaminGreen },
+        { "SeaGreen", APE::KnownColor::SeaGreen },
+        { "SeaGreenCrayola", APE::KnownColor::SeaGreenCrayola },
+        { "Seance", APE::KnownColor::Seance },
+        { "SealBrown", APE::KnownColor::SealBrown },
+        { "Seashell", APE::KnownColor::Seashell },
+        { "Secret", APE::KnownColor::Secret },
+        { "SelectiveYellow", APE::KnownColor::SelectiveYellow },
+        { "Sepia", APE::KnownColor::Sepia },
+        { "Shadow", APE::KnownColor::Shadow },
+        { "ShadowBlue", APE::KnownColor::ShadowBlue },
+        { "ShamrockGreen", APE::KnownColor::ShamrockGreen },
+        { "SheenGreen", APE::KnownColor::SheenGreen },
+        { "ShimmeringBlush", APE::KnownColor::ShimmeringBlush },
+        { "ShinyShamrock", APE::KnownColor::ShinyShamrock },
+        { "ShockingPink", APE::KnownColor::ShockingPink },
+        { "ShockingPinkCrayola", APE::KnownColor::ShockingPinkCrayola },
+        { "Sienna", APE::KnownColor::Sienna },
+        { "Silver", APE::KnownColor::Silver },
+        { "SilverCrayola", APE::KnownColor::SilverCrayola },
+        { "SilverMetallic", APE::KnownColor::SilverMetallic },
+        { "SilverChalice", APE::KnownColor::SilverChalice },
+        { "SilverPink", APE::KnownColor::SilverPink },
+        { "SilverSand", APE::KnownColor::SilverSand },
+        { "Sinopia", APE::KnownColor::Sinopia },
+        { "SizzlingRed", APE::KnownColor::SizzlingRed },
+        { "SizzlingSunrise", APE::KnownColor::SizzlingSunrise },
+        { "Skobeloff", APE::KnownColor::Skobeloff },
+        { "SkyBlue", APE::KnownColor::SkyBlue },
+        { "SkyBlueCrayola", APE::KnownColor::SkyBlueCrayola },
+        { "SkyMagenta", APE::KnownColor::SkyMagenta },
+        { "SlateBlue", APE::KnownColor::SlateBlue },
+        { "SlateGray", APE::KnownColor::SlateGray },
+        { "SlimyGreen", APE::KnownColor::SlimyGreen },
+        { "Smitten", APE::KnownColor::Smitten },
+        { "SmokyBlack", APE::KnownColor::SmokyBlack },
+        { "Snow", APE::KnownColor::Snow },
+        { "SolidPink", APE::KnownColor::SolidPink },
+        { "SonicSilver", APE::KnownColor::SonicSilver },
+        { "SpaceCadet", APE::KnownColor::SpaceCadet },
+        { "SpanishBistre", APE::KnownColor::SpanishBistre },
+        { "SpanishBlue", APE::KnownColor::SpanishBlue },
+        { "SpanishCarmine", APE::KnownColor::SpanishCarmine },
+        { "SpanishGray", APE::KnownColor::SpanishGray },
+        { "SpanishGreen", APE::KnownColor::SpanishGreen },
+        { "SpanishOrange", APE::KnownColor::SpanishOrange },
+        { "SpanishPink", APE::KnownColor::SpanishPink },
+        { "SpanishRed", APE::KnownColor::SpanishRed },
+        { "SpanishSkyBlue", APE::KnownColor::SpanishSkyBlue },
+        { "SpanishViolet", APE::KnownColor::SpanishViolet },
+        { "SpanishViridian", APE::KnownColor::SpanishViridian },
+        { "SpringBud", APE::KnownColor::SpringBud },
+        { "SpringFrost", APE::KnownColor::SpringFrost },
+        { "SpringGreen", APE::KnownColor::SpringGreen },
+        { "SpringGreenCrayola", APE::KnownColor::SpringGreenCrayola },
+        { "StarCommandBlue", APE::KnownColor::StarCommandBlue },
+        { "SteelBlue", APE::KnownColor::SteelBlue },
+        { "SteelPink", APE::KnownColor::SteelPink },
+        { "StilDeGrainYellow", APE::KnownColor::StilDeGrainYellow },
+        { "Straw", APE::KnownColor::Straw },
+        { "Strawberry", APE::KnownColor::Strawberry },
+        { "StrawberryBlonde", APE::KnownColor::StrawberryBlonde },
+        { "StrongLimeGreen", APE::KnownColor::StrongLimeGreen },
+        { "SugarPlum", APE::KnownColor::SugarPlum },
+        { "Sunglow", APE::KnownColor::Sunglow },
+        { "Sunray", APE::KnownColor::Sunray },
+        { "Sunset", APE::KnownColor::Sunset },
+        { "SuperPink", APE::KnownColor::SuperPink },
+        { "SweetBrown", APE::KnownColor::SweetBrown },
+        { "SyracuseOrange", APE::KnownColor::SyracuseOrange },
+        { "Tan", APE::KnownColor::Tan },
+        { "TanCrayola", APE::KnownColor::TanCrayola },
+        { "Tangerine", APE::KnownColor::Tangerine },
+        { "TangoPink", APE::KnownColor::TangoPink },
+        { "TartOrange", APE::KnownColor::TartOrange },
+        { "Taupe", APE::KnownColor::Taupe },
+        { "TaupeGray", APE::KnownColor::TaupeGray },
+        { "TeaGreen", APE::KnownColor::TeaGreen },
+        { "TeaRose", APE::KnownColor::TeaRose },
+        { "Teal", APE::KnownColor::Teal },
+        { "TealBlue", APE::KnownColor::TealBlue },
+        { "Technobotanica", APE::KnownColor::Technobotanica },
+        { "Telemagenta", APE::KnownColor::Telemagenta },
+        { "Tawny", APE::KnownColor::Tawny },
+        { "TerraCotta", APE::KnownColor::TerraCotta },
+        { "Thistle", APE::KnownColor::Thistle },
+        { "ThulianPink", APE::KnownColor::ThulianPink },
+        { "TickleMePink", APE::KnownColor::TickleMePink },
+        { "TiffanyBlue", APE::KnownColor::TiffanyBlue },
+        { "Timberwolf", APE::KnownColor::Timberwolf },
+        { "TitaniumYellow", APE::KnownColor::TitaniumYellow },
+        { "Tomato", APE::KnownColor::Tomato },
+        { "Tourmaline", APE::KnownColor::Tourmaline },
+        { "TropicalRainforest", APE::KnownColor::TropicalRainforest },
+        { "TrueBlue", APE::KnownColor::TrueBlue },
+        { "TrypanBlue", APE::KnownColor::TrypanBlue },
+        { "TuftsBlue", APE::KnownColor::TuftsBlue },
+        { "Tumbleweed", APE::KnownColor::Tumbleweed },
+        { "Turquoise", APE::KnownColor::Turquoise },
+        { "TurquoiseBlue", APE::KnownColor::TurquoiseBlue },
+        { "TurquoiseGreen", APE::KnownColor::TurquoiseGreen },
+        { "TurtleGreen", APE::KnownColor::TurtleGreen },
+        { "Tuscan", APE::KnownColor::Tuscan },
+        { "TuscanBrown", APE::KnownColor::TuscanBrown },
+        { "TuscanRed", APE::KnownColor::TuscanRed },
+        { "TuscanTan", APE::KnownColor::TuscanTan },
+        { "Tuscany", APE::KnownColor::Tuscany },
+        { "TwilightLavender", APE::KnownColor::TwilightLavender },
+        { "TyrianPurple", APE::KnownColor::TyrianPurple },
+        { "UaBlue", APE::KnownColor::UaBlue },
+        { "UaRed", APE::KnownColor::UaRed },
+        { "Ultramarine", APE::KnownColor::Ultramarine },
+        { "UltramarineBlue", APE::KnownColor::UltramarineBlue },
+        { "UltraPink", APE::KnownColor::UltraPink },
+        { "UltraRed", APE::KnownColor::UltraRed },
+        { "Umber", APE::KnownColor::Umber },
+        { "UnbleachedSilk", APE::KnownColor::UnbleachedSilk },
+        { "UnitedNationsBlue", APE::KnownColor::UnitedNationsBlue },
+        { "UniversityOfPennsylvaniaRed", APE::KnownColor::UniversityOfPennsylvaniaRed },
+        { "UnmellowYellow", APE::KnownColor::UnmellowYellow },
+        { "UpForestGreen", APE::KnownColor::UpForestGreen },
+        { "UpMaroon", APE::KnownColor::UpMaroon },
+        { "UpsdellRed", APE::KnownColor::UpsdellRed },
+        { "UranianBlue", APE::KnownColor::UranianBlue },
+        { "UsafaBlue", APE::KnownColor::UsafaBlue },
+        { "VanDykeBrown", APE::KnownColor::VanDykeBrown },
+        { "Vanilla", APE::KnownColor::Vanilla },
+        { "VanillaIce", APE::KnownColor::VanillaIce },
+        { "VegasGold", APE::KnownColor::VegasGold },
+        { "VenetianRed", APE::KnownColor::VenetianRed },
+        { "Verdigris", APE::KnownColor::Verdigris },
+        { "Vermilion", APE::KnownColor::Vermilion },
+        { "Veronica", APE::KnownColor::Veronica },
+        { "Violet", APE::KnownColor::Violet },
+        { "VioletColorWheel", APE::KnownColor::VioletColorWheel },
+        { "VioletCrayola", APE::KnownColor::VioletCrayola },
+        { "VioletRyb", APE::KnownColor::VioletRyb },
+        { "VioletWeb", APE::KnownColor::VioletWeb },
+        { "VioletBlue", APE::KnownColor::VioletBlue },
+        { "VioletBlueCrayola", APE::KnownColor::VioletBlueCrayola },
+        { "VioletRed", APE::KnownColor::VioletRed },
+        { "VioletRedPerbang", APE::KnownColor::VioletRedPerbang },
+        { "Viridian", APE::KnownColor::Viridian },
+        { "ViridianGreen", APE::KnownColor::ViridianGreen },
+        { "VividBurgundy", APE::KnownColor::VividBurgundy },
+        { "VividSkyBlue", APE::KnownColor::VividSkyBlue },
+        { "VividTangerine", APE::KnownColor::VividTangerine },
+        { "VividViolet", APE::KnownColor::VividViolet },
+        { "Volt", APE::KnownColor::Volt },
+        { "WarmBlack", APE::KnownColor::WarmBlack },
+        { "WeezyBlue", APE::KnownColor::WeezyBlue },
+        { "Wheat", APE::KnownColor::Wheat },
+        { "White", APE::KnownColor::White },
+        { "WildBlueYonder", APE::KnownColor::WildBlueYonder },
+        { "WildOrchid", APE::KnownColor::WildOrchid },
+        { "WildStrawberry", APE::KnownColor::WildStrawberry },
+        { "WildWatermelon", APE::KnownColor::WildWatermelon },
+        { "WindsorTan", APE::KnownColor::WindsorTan },
+        { "Wine", APE::KnownColor::Wine },
+        { "WineDregs", APE::KnownColor::WineDregs },
+        { "WinterSky", APE::KnownColor::WinterSky },
+        { "WintergreenDream", APE::KnownColor::WintergreenDream },
+        { "Wisteria", APE::KnownColor::Wisteria },
+        { "WoodBrown", APE::KnownColor::WoodBrown },
+        { "Xanadu", APE::KnownColor::Xanadu },
+        { "Xanthic", APE::KnownColor::Xanthic },
+        { "Xanthous", APE::KnownColor::Xanthous },
+        { "YaleBlue", APE::KnownColor::YaleBlue },
+        { "Yellow", APE::KnownColor::Yellow },
+        { "YellowCrayola", APE::KnownColor::YellowCrayola },
+        { "YellowMunsell", APE::KnownColor::YellowMunsell },
+        { "YellowNcs", APE::KnownColor::YellowNcs },
+        { "YellowPantone", APE::KnownColor::YellowPantone },
+        { "YellowProcess", APE::KnownColor::YellowProcess },
+        { "YellowRyb", APE::KnownColor::YellowRyb },
+        { "YellowGreen", APE::KnownColor::YellowGreen },
+        { "YellowGreenCrayola", APE::KnownColor::YellowGreenCrayola },
+        { "YellowGreenColorWheel", APE::KnownColor::YellowGreenColorWheel },
+        { "YellowOrange", APE::KnownColor::YellowOrange },
+        { "YellowOrangeColorWheel", APE::KnownColor::YellowOrangeColorWheel },
+        { "YellowSunshine", APE::KnownColor::YellowSunshine },
+        { "YinmnBlue", APE::KnownColor::YinmnBlue },
+        { "Zaffre", APE::KnownColor::Zaffre },
+        { "ZinnwalditeBrown", APE::KnownColor::ZinnwalditeBrown },
+        { "Zomp", APE::KnownColor::Zomp },
+    };
+    constexpr std::size_t KnownColorsCount = sizeof(KnownColors) / sizeof(KnownColors[0]);
+
+    constexpr char ToLower(char c) { return (c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : c; }
+
+    constexpr bool IsSameName(std::string_view a, std::string_view b) {
+        if (a.size() != b.size()) return false;
+        for (std::size_t i = 0; i < a.size(); i++)
+            if (ToLower(a[i]) != ToLower(b[i])) return false;
+        return true;
+    }
+
+    // The 64 bit FNV-1a hash of the lowercase name.
+    constexpr std::uint64_t HashName(std::string_view name) {
+        std::uint64_t hash = 14695981039346656037ull;
+        for (std::size_t i = 0; i < name.size(); i++) {
+            hash ^= (std::uint8_t)ToLower(name[i]);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    // A perfect hash built by hash and displace: the names are split in buckets by the high bits of their
+    // hash, then each bucket (the biggest first) get the first seed that send all its names to free slots.
+    // A lookup hash the name once, then only mix the hash with the seed of its bucket.
+    constexpr std::size_t BucketsCount = 512;
+    constexpr std::size_t SlotsCount = 2048;
+    constexpr std::uint16_t EmptySlot = 0xFFFF;
+    constexpr std::uint16_t MaxSeed = 0xFFFF;
+
+    struct PerfectHash {
+        // The seed of each bucket, 0 for the empty buckets.
+        std::uint16_t Seeds[BucketsCount] = {};
+        // The index in KnownColors of the name in each slot, or EmptySlot.
+        std::uint16_t Slots[SlotsCount] = {};
+        bool Valid = false;
+    };
+
+    constexpr std::size_t GetBucket(std::uint64_t hash) { return (std::size_t)(hash >> 32) % BucketsCount; }
+
+    constexpr std::size_t GetSlot(std::uint64_t hash, std::uint16_t seed) {
+        std::uint64_t x = hash + seed * 0x9E3779B97F4A7C15ull;
+        x ^= x >> 33;
+        x *= 0xFF51AFD7ED558CCDull;
+        x ^= x >> 33;
+        return (std::size_t)(x % SlotsCount);
+    }
+
+    constexpr PerfectHash BuildPerfectHash() {
+        PerfectHash result;
+        for (std::size_t slot = 0; slot < SlotsCount; slot++) result.Slots[slot] = EmptySlot;
+
+        // Sort the names by bucket (counting sort), to iterate over a bucket names.
+        std::uint64_t hashes[KnownColorsCount] = {};
+        std::size_t bucketStarts[BucketsCount + 1] = {};
+        std::size_t order[KnownColorsCount] = {};
+        for (std::size_t i = 0; i < KnownColorsCount; i++) {
+            hashes[i] = HashName(KnownColors[i].Name);
+            bucketStarts[GetBucket(hashes[i]) + 1]++;
+        }
+        std::size_t maxBucketSize = 0;
+        for (std::size_t bucket = 0; bucket < BucketsCount; bucket++) {
+            maxBucketSize = APE_MAX(maxBucketSize, bucketStarts[bucket + 1]);
+            bucketStarts[bucket + 1] += bucketStarts[bucket];
+        }
+        std::size_t bucketFills[BucketsCount] = {};
+        for (std::size_t i = 0; i < KnownColorsCount; i++) {
+            std::size_t bucket = GetBucket(hashes[i]);
+            order[bucketStarts[bucket] + bucketFills[bucket]++] = i;
+        }
+
+        for (std::size_t size = maxBucketSize; size > 0; size--) {
+            for (std::size_t bucket = 0; bucket < BucketsCount; bucket++) {
+                std::size_t first = bucketStarts[bucket], last = bucketStarts[bucket + 1];
+                if (last - first != size) continue;
+
+                std::uint16_t seed = 1;
+                for (; seed < MaxSeed; seed++) {
+                    // Place the names one by one, and remove them if one of them collide.
+                    std::size_t placed = first;
+                    for (; placed < last; placed++) {
+                        std::size_t slot = GetSlot(hashes[order[placed]], seed);
+                        if (result.Slots[slot] != EmptySlot) break;
+                        result.Slots[slot] = (std::uint16_t)order[placed];
+                    }
+                    if (placed == last) break;
+                    for (std::size_t i = first; i < placed; i++)
+                        result.Slots[GetSlot(hashes[order[i]], seed)] = EmptySlot;
+                }
+                if (seed == MaxSeed) return result;
+                result.Seeds[bucket] = seed;
+            }
+        }
+        result.Valid = true;
+        return result;
+    }
+
+    constexpr PerfectHash KnownColorsHash = BuildPerfectHash();
+    static_assert(KnownColorsCount < EmptySlot, "Too many known colors for the perfect hash slots.");
+    static_assert(KnownColorsHash.Valid, "No perfect hash found for the known color names.");
+
+    void LerpColorSpan(const APE::Color* a, const APE::Color* b, std::size_t bStep, unsigned weight, APE::Color* out, std::size_t count) {
+        switch (APE::GetColorKernel()) {
+        case APE::ColorKernel::AVX2: APE::LerpColorSpanAVX2(a, b, bStep, weight, out, count); break;
+        case APE::ColorKernel::SSE2: APE::LerpColorSpanSSE2(a, b, bStep, weight, out, count); break;
+        default: APE::LerpColorSpanScalar(a, b, bStep, weight, out, count); break;
+        }
+    }
 }
 
-uint32_t APE::Color::ToUint32() const {
-    return ((uint32_t)Red << 24) + ((uint32_t)Green << 16) + ((uint32_t)Blue << 8) + (uint32_t)Alpha;
+//* --- APE::Color kernels dispatch ---
+
+APE::ColorKernel APE::GetColorKernel() {
+    static const ColorKernel kernel =
+        (IsColorAVX2KernelCompiled() && SDL_HasAVX2() == SDL_TRUE) ? ColorKernel::AVX2 :
+#ifdef APE_COLOR_SSE2
+        (SDL_HasSSE2() == SDL_TRUE) ? ColorKernel::SSE2 :
+#endif
+        ColorKernel::Scalar;
+    return kernel;
 }
+
+//* --- APE::Color ---
+
 APE::Color APE::Color::LerpTo(const APE::Color& target, float t) const {
-    return Color {
-        (uint8_t)round(Red + APE_FAST_CLAMP(0, 1, t)*((int)target.Red - Red)),
-        (uint8_t)round(Green + APE_FAST_CLAMP(0, 1, t)*((int)target.Green - Green)),
-        (uint8_t)round(Blue + APE_FAST_CLAMP(0, 1, t)*((int)target.Blue - Red)),
-        (uint8_t)round(Alpha + APE_FAST_CLAMP(0, 1, t)*((int)target.Alpha - Alpha))
-    };
+    return LerpColor(*this, target, GetLerpWeight(t));
 }
 APE::Color APE::Color::Lighten(float percent) const {
-    return LerpTo(Color(255), SDL_clamp(percent, 0, 100) * 0.01);
+    return LerpTo(Color(255), percent * 0.01f);
 }
 APE::Color APE::Color::Darken(float percent) const {
-    return LerpTo(Color(0, 255), SDL_clamp(percent, 0, 100) * 0.01);
+    return LerpTo(Color(0, 255), percent * 0.01f);
+}
+APE::Color APE::Color::Premultiply() const {
+    return Color(MultiplyChannel(Red, Alpha), MultiplyChannel(Green, Alpha), MultiplyChannel(Blue, Alpha), Alpha);
 }
 
 APE::Color APE::Color::Lerp(const Color& a, const Color& b, float t) { return a.LerpTo(b, t); }
@@ -56,893 +1049,107 @@ APE::Color APE::Color::From01(float r, float g, float b, float a) {
     };
 }
 
-const APE::Color APE::Color::Empty = Color(0, 0, 0, 0);
-
-const APE::Color APE::KnownColor::AbsoluteZero = APE::Color(0x00, 0x48, 0xBA, 0xFF);
-const APE::Color APE::KnownColor::AcidGreen = APE::Color(0xB0, 0xBF, 0x1A, 0xFF);
-const APE::Color APE::KnownColor::Aero = APE::Color(0x7C, 0xB9, 0xE8, 0xFF);
-const APE::Color APE::KnownColor::AfricanViolet = APE::Color(0xB2, 0x84, 0xBE, 0xFF);
-const APE::Color APE::KnownColor::AirSuperiorityBlue = APE::Color(0x72, 0xA0, 0xC1, 0xFF);
-const APE::Color APE::KnownColor::AliceBlue = APE::Color(0xF0, 0xF8, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::Alizarin = APE::Color(0xDB, 0x2D, 0x43, 0xFF);
-const APE::Color APE::KnownColor::AlloyOrange = APE::Color(0xC4, 0x62, 0x10, 0xFF);
-const APE::Color APE::KnownColor::Almond = APE::Color(0xEF, 0xDE, 0xCD, 0xFF);
-const APE::Color APE::KnownColor::AmaranthDeepPurple = APE::Color(0x9F, 0x2B, 0x68, 0xFF);
-const APE::Color APE::KnownColor::AmaranthPink = APE::Color(0xF1, 0x9C, 0xBB, 0xFF);
-const APE::Color APE::KnownColor::AmaranthPurple = APE::Color(0xAB, 0x27, 0x4F, 0xFF);
-const APE::Color APE::KnownColor::Amazon = APE::Color(0x3B, 0x7A, 0x57, 0xFF);
-const APE::Color APE::KnownColor::Amber = APE::Color(0xFF, 0xBF, 0x00, 0xFF);
-const APE::Color APE::KnownColor::Amethyst = APE::Color(0x99, 0x66, 0xCC, 0xFF);
-const APE::Color APE::KnownColor::AndroidGreen = APE::Color(0x3D, 0xDC, 0x84, 0xFF);
-const APE::Color APE::KnownColor::AntiqueBrass = APE::Color(0xCD, 0x95, 0x75, 0xFF);
-const APE::Color APE::KnownColor::AntiqueBronze = APE::Color(0x66, 0x5D, 0x1E, 0xFF);
-const APE::Color APE::KnownColor::AntiqueFuchsia = APE::Color(0x91, 0x5C, 0x83, 0xFF);
-const APE::Color APE::KnownColor::AntiqueRuby = APE::Color(0x84, 0x1B, 0x2D, 0xFF);
-const APE::Color APE::KnownColor::AntiqueWhite = APE::Color(0xFA, 0xEB, 0xD7, 0xFF);
-const APE::Color APE::KnownColor::Apricot = APE::Color(0xFB, 0xCE, 0xB1, 0xFF);
-const APE::Color APE::KnownColor::Aqua = APE::Color(0x00, 0xFF, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::Aquamarine = APE::Color(0x7F, 0xFF, 0xD4, 0xFF);
-const APE::Color APE::KnownColor::ArcticLime = APE::Color(0xD0, 0xFF, 0x14, 0xFF);
-const APE::Color APE::KnownColor::ArtichokeGreen = APE::Color(0x4B, 0x6F, 0x44, 0xFF);
-const APE::Color APE::KnownColor::ArylideYellow = APE::Color(0xE9, 0xD6, 0x6B, 0xFF);
-const APE::Color APE::KnownColor::AshGray = APE::Color(0xB2, 0xBE, 0xB5, 0xFF);
-const APE::Color APE::KnownColor::AtomicTangerine = APE::Color(0xFF, 0x99, 0x66, 0xFF);
-const APE::Color APE::KnownColor::Aureolin = APE::Color(0xFD, 0xEE, 0x00, 0xFF);
-const APE::Color APE::KnownColor::Azure = APE::Color(0x00, 0x7F, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::AzureX11WebColor = APE::Color(0xF0, 0xFF, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::BabyBlue = APE::Color(0x89, 0xCF, 0xF0, 0xFF);
-const APE::Color APE::KnownColor::BabyBlueEyes = APE::Color(0xA1, 0xCA, 0xF1, 0xFF);
-const APE::Color APE::KnownColor::BabyPink = APE::Color(0xF4, 0xC2, 0xC2, 0xFF);
-const APE::Color APE::KnownColor::BabyPowder = APE::Color(0xFE, 0xFE, 0xFA, 0xFF);
-const APE::Color APE::KnownColor::BakerMillerPink = APE::Color(0xFF, 0x91, 0xAF, 0xFF);
-const APE::Color APE::KnownColor::BananaMania = APE::Color(0xFA, 0xE7, 0xB5, 0xFF);
-const APE::Color APE::KnownColor::BarbiePink = APE::Color(0xDA, 0x18, 0x84, 0xFF);
-const APE::Color APE::KnownColor::BarnRed = APE::Color(0x7C, 0x0A, 0x02, 0xFF);
-const APE::Color APE::KnownColor::BattleshipGrey = APE::Color(0x84, 0x84, 0x82, 0xFF);
-const APE::Color APE::KnownColor::BeauBlue = APE::Color(0xBC, 0xD4, 0xE6, 0xFF);
-const APE::Color APE::KnownColor::Beaver = APE::Color(0x9F, 0x81, 0x70, 0xFF);
-const APE::Color APE::KnownColor::Beige = APE::Color(0xF5, 0xF5, 0xDC, 0xFF);
-const APE::Color APE::KnownColor::BDazzledBlue = APE::Color(0x2E, 0x58, 0x94, 0xFF);
-const APE::Color APE::KnownColor::BigDipORuby = APE::Color(0x9C, 0x25, 0x42, 0xFF);
-const APE::Color APE::KnownColor::Bisque = APE::Color(0xFF, 0xE4, 0xC4, 0xFF);
-const APE::Color APE::KnownColor::Bistre = APE::Color(0x3D, 0x2B, 0x1F, 0xFF);
-const APE::Color APE::KnownColor::BistreBrown = APE::Color(0x96, 0x71, 0x17, 0xFF);
-const APE::Color APE::KnownColor::BitterLemon = APE::Color(0xCA, 0xE0, 0x0D, 0xFF);
-const APE::Color APE::KnownColor::Black = APE::Color(0x00, 0x00, 0x00, 0xFF);
-const APE::Color APE::KnownColor::BlackBean = APE::Color(0x3D, 0x0C, 0x02, 0xFF);
-const APE::Color APE::KnownColor::BlackCoral = APE::Color(0x54, 0x62, 0x6F, 0xFF);
-const APE::Color APE::KnownColor::BlackOlive = APE::Color(0x3B, 0x3C, 0x36, 0xFF);
-const APE::Color APE::KnownColor::BlackShadows = APE::Color(0xBF, 0xAF, 0xB2, 0xFF);
-const APE::Color APE::KnownColor::BlanchedAlmond = APE::Color(0xFF, 0xEB, 0xCD, 0xFF);
-const APE::Color APE::KnownColor::BlastOffBronze = APE::Color(0xA5, 0x71, 0x64, 0xFF);
-const APE::Color APE::KnownColor::BleuDeFrance = APE::Color(0x31, 0x8C, 0xE7, 0xFF);
-const APE::Color APE::KnownColor::BlizzardBlue = APE::Color(0xAC, 0xE5, 0xEE, 0xFF);
-const APE::Color APE::KnownColor::BloodRed = APE::Color(0x66, 0x00, 0x00, 0xFF);
-const APE::Color APE::KnownColor::Blue = APE::Color(0x00, 0x00, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::BlueCrayola = APE::Color(0x1F, 0x75, 0xFE, 0xFF);
-const APE::Color APE::KnownColor::BlueMunsell = APE::Color(0x00, 0x93, 0xAF, 0xFF);
-const APE::Color APE::KnownColor::BlueNcs = APE::Color(0x00, 0x87, 0xBD, 0xFF);
-const APE::Color APE::KnownColor::BluePantone = APE::Color(0x00, 0x18, 0xA8, 0xFF);
-const APE::Color APE::KnownColor::BluePigment = APE::Color(0x33, 0x33, 0x99, 0xFF);
-const APE::Color APE::KnownColor::BlueBell = APE::Color(0xA2, 0xA2, 0xD0, 0xFF);
-const APE::Color APE::KnownColor::BlueGrayCrayola = APE::Color(0x66, 0x99, 0xCC, 0xFF);
-const APE::Color APE::KnownColor::BlueJeans = APE::Color(0x5D, 0xAD, 0xEC, 0xFF);
-const APE::Color APE::KnownColor::BlueSapphire = APE::Color(0x12, 0x61, 0x80, 0xFF);
-const APE::Color APE::KnownColor::BlueViolet = APE::Color(0x8A, 0x2B, 0xE2, 0xFF);
-const APE::Color APE::KnownColor::BlueYonder = APE::Color(0x50, 0x72, 0xA7, 0xFF);
-const APE::Color APE::KnownColor::Bluetiful = APE::Color(0x3C, 0x69, 0xE7, 0xFF);
-const APE::Color APE::KnownColor::Blush = APE::Color(0xDE, 0x5D, 0x83, 0xFF);
-const APE::Color APE::KnownColor::Bole = APE::Color(0x79, 0x44, 0x3B, 0xFF);
-const APE::Color APE::KnownColor::Bone = APE::Color(0xE3, 0xDA, 0xC9, 0xFF);
-const APE::Color APE::KnownColor::BrickRed = APE::Color(0xCB, 0x41, 0x54, 0xFF);
-const APE::Color APE::KnownColor::BrightLilac = APE::Color(0xD8, 0x91, 0xEF, 0xFF);
-const APE::Color APE::KnownColor::BrightYellowCrayola = APE::Color(0xFF, 0xAA, 0x1D, 0xFF);
-const APE::Color APE::KnownColor::Bronze = APE::Color(0xCD, 0x7F, 0x32, 0xFF);
-const APE::Color APE::KnownColor::Brown = APE::Color(0x88, 0x54, 0x0B, 0xFF);
-const APE::Color APE::KnownColor::BrownSugar = APE::Color(0xAF, 0x6E, 0x4D, 0xFF);
-const APE::Color APE::KnownColor::BudGreen = APE::Color(0x7B, 0xB6, 0x61, 0xFF);
-const APE::Color APE::KnownColor::Buff = APE::Color(0xFF, 0xC6, 0x80, 0xFF);
-const APE::Color APE::KnownColor::Burgundy = APE::Color(0x80, 0x00, 0x20, 0xFF);
-const APE::Color APE::KnownColor::Burlywood = APE::Color(0xDE, 0xB8, 0x87, 0xFF);
-const APE::Color APE::KnownColor::BurnishedBrown = APE::Color(0xA1, 0x7A, 0x74, 0xFF);
-const APE::Color APE::KnownColor::BurntOrange = APE::Color(0xCC, 0x55, 0x00, 0xFF);
-const APE::Color APE::KnownColor::BurntSienna = APE::Color(0xE9, 0x74, 0x51, 0xFF);
-const APE::Color APE::KnownColor::BurntUmber = APE::Color(0x8A, 0x33, 0x24, 0xFF);
-const APE::Color APE::KnownColor::Byzantine = APE::Color(0xBD, 0x33, 0xA4, 0xFF);
-const APE::Color APE::KnownColor::Byzantium = APE::Color(0x70, 0x29, 0x63, 0xFF);
-const APE::Color APE::KnownColor::CadetBlue = APE::Color(0x5F, 0x9E, 0xA0, 0xFF);
-const APE::Color APE::KnownColor::CadetGrey = APE::Color(0x91, 0xA3, 0xB0, 0xFF);
-const APE::Color APE::KnownColor::CadmiumGreen = APE::Color(0x00, 0x6B, 0x3C, 0xFF);
-const APE::Color APE::KnownColor::CadmiumOrange = APE::Color(0xED, 0x87, 0x2D, 0xFF);
-const APE::Color APE::KnownColor::CafeAuLait = APE::Color(0xA6, 0x7B, 0x5B, 0xFF);
-const APE::Color APE::KnownColor::CafeNoir = APE::Color(0x4B, 0x36, 0x21, 0xFF);
-const APE::Color APE::KnownColor::CambridgeBlue = APE::Color(0xA3, 0xC1, 0xAD, 0xFF);
-const APE::Color APE::KnownColor::Camel = APE::Color(0xC1, 0x9A, 0x6B, 0xFF);
-const APE::Color APE::KnownColor::CameoPink = APE::Color(0xEF, 0xBB, 0xCC, 0xFF);
-const APE::Color APE::KnownColor::Canary = APE::Color(0xFF, 0xFF, 0x99, 0xFF);
-const APE::Color APE::KnownColor::CanaryYellow = APE::Color(0xFF, 0xEF, 0x00, 0xFF);
-const APE::Color APE::KnownColor::CandyPink = APE::Color(0xE4, 0x71, 0x7A, 0xFF);
-const APE::Color APE::KnownColor::Cardinal = APE::Color(0xC4, 0x1E, 0x3A, 0xFF);
-const APE::Color APE::KnownColor::CaribbeanGreen = APE::Color(0x00, 0xCC, 0x99, 0xFF);
-const APE::Color APE::KnownColor::Carmine = APE::Color(0x96, 0x00, 0x18, 0xFF);
-const APE::Color APE::KnownColor::CarmineMP = APE::Color(0xD7, 0x00, 0x40, 0xFF);
-const APE::Color APE::KnownColor::CarnationPink = APE::Color(0xFF, 0xA6, 0xC9, 0xFF);
-const APE::Color APE::KnownColor::Carnelian = APE::Color(0xB3, 0x1B, 0x1B, 0xFF);
-const APE::Color APE::KnownColor::CarolinaBlue = APE::Color(0x56, 0xA0, 0xD3, 0xFF);
-const APE::Color APE::KnownColor::CarrotOrange = APE::Color(0xED, 0x91, 0x21, 0xFF);
-const APE::Color APE::KnownColor::Catawba = APE::Color(0x70, 0x36, 0x42, 0xFF);
-const APE::Color APE::KnownColor::CedarChest = APE::Color(0xC9, 0x5A, 0x49, 0xFF);
-const APE::Color APE::KnownColor::Celadon = APE::Color(0xAC, 0xE1, 0xAF, 0xFF);
-const APE::Color APE::KnownColor::Celeste = APE::Color(0xB2, 0xFF, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::Cerise = APE::Color(0xDE, 0x31, 0x63, 0xFF);
-const APE::Color APE::KnownColor::Cerulean = APE::Color(0x00, 0x7B, 0xA7, 0xFF);
-const APE::Color APE::KnownColor::CeruleanBlue = APE::Color(0x2A, 0x52, 0xBE, 0xFF);
-const APE::Color APE::KnownColor::CeruleanFrost = APE::Color(0x6D, 0x9B, 0xC3, 0xFF);
-const APE::Color APE::KnownColor::CeruleanCrayola = APE::Color(0x1D, 0xAC, 0xD6, 0xFF);
-const APE::Color APE::KnownColor::CeruleanRgb = APE::Color(0x00, 0x40, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::Champagne = APE::Color(0xF7, 0xE7, 0xCE, 0xFF);
-const APE::Color APE::KnownColor::ChampagnePink = APE::Color(0xF1, 0xDD, 0xCF, 0xFF);
-const APE::Color APE::KnownColor::Charcoal = APE::Color(0x36, 0x45, 0x4F, 0xFF);
-const APE::Color APE::KnownColor::CharmPink = APE::Color(0xE6, 0x8F, 0xAC, 0xFF);
-const APE::Color APE::KnownColor::ChartreuseWeb = APE::Color(0x80, 0xFF, 0x00, 0xFF);
-const APE::Color APE::KnownColor::CherryBlossomPink = APE::Color(0xFF, 0xB7, 0xC5, 0xFF);
-const APE::Color APE::KnownColor::Chestnut = APE::Color(0x95, 0x45, 0x35, 0xFF);
-const APE::Color APE::KnownColor::ChiliRed = APE::Color(0xE2, 0x3D, 0x28, 0xFF);
-const APE::Color APE::KnownColor::ChinaPink = APE::Color(0xDE, 0x6F, 0xA1, 0xFF);
-const APE::Color APE::KnownColor::ChineseRed = APE::Color(0xAA, 0x38, 0x1E, 0xFF);
-const APE::Color APE::KnownColor::ChineseViolet = APE::Color(0x85, 0x60, 0x88, 0xFF);
-const APE::Color APE::KnownColor::ChineseYellow = APE::Color(0xFF, 0xB2, 0x00, 0xFF);
-const APE::Color APE::KnownColor::ChocolateTraditional = APE::Color(0x7B, 0x3F, 0x00, 0xFF);
-const APE::Color APE::KnownColor::ChocolateWeb = APE::Color(0xD2, 0x69, 0x1E, 0xFF);
-const APE::Color APE::KnownColor::Cinereous = APE::Color(0x98, 0x81, 0x7B, 0xFF);
-const APE::Color APE::KnownColor::Cinnabar = APE::Color(0xE3, 0x42, 0x34, 0xFF);
-const APE::Color APE::KnownColor::CinnamonSatin = APE::Color(0xCD, 0x60, 0x7E, 0xFF);
-const APE::Color APE::KnownColor::Citrine = APE::Color(0xE4, 0xD0, 0x0A, 0xFF);
-const APE::Color APE::KnownColor::Citron = APE::Color(0x9F, 0xA9, 0x1F, 0xFF);
-const APE::Color APE::KnownColor::Claret = APE::Color(0x7F, 0x17, 0x34, 0xFF);
-const APE::Color APE::KnownColor::Coffee = APE::Color(0x6F, 0x4E, 0x37, 0xFF);
-const APE::Color APE::KnownColor::ColumbiaBlue = APE::Color(0xB9, 0xD9, 0xEB, 0xFF);
-const APE::Color APE::KnownColor::CongoPink = APE::Color(0xF8, 0x83, 0x79, 0xFF);
-const APE::Color APE::KnownColor::CoolGrey = APE::Color(0x8C, 0x92, 0xAC, 0xFF);
-const APE::Color APE::KnownColor::Copper = APE::Color(0xB8, 0x73, 0x33, 0xFF);
-const APE::Color APE::KnownColor::CopperCrayola = APE::Color(0xDA, 0x8A, 0x67, 0xFF);
-const APE::Color APE::KnownColor::CopperPenny = APE::Color(0xAD, 0x6F, 0x69, 0xFF);
-const APE::Color APE::KnownColor::CopperRed = APE::Color(0xCB, 0x6D, 0x51, 0xFF);
-const APE::Color APE::KnownColor::CopperRose = APE::Color(0x99, 0x66, 0x66, 0xFF);
-const APE::Color APE::KnownColor::Coquelicot = APE::Color(0xFF, 0x38, 0x00, 0xFF);
-const APE::Color APE::KnownColor::Coral = APE::Color(0xFF, 0x7F, 0x50, 0xFF);
-const APE::Color APE::KnownColor::CoralPink = APE::Color(0xF8, 0x83, 0x79, 0xFF);
-const APE::Color APE::KnownColor::Cordovan = APE::Color(0x89, 0x3F, 0x45, 0xFF);
-const APE::Color APE::KnownColor::Corn = APE::Color(0xFB, 0xEC, 0x5D, 0xFF);
-const APE::Color APE::KnownColor::CornflowerBlue = APE::Color(0x64, 0x95, 0xED, 0xFF);
-const APE::Color APE::KnownColor::Cornsilk = APE::Color(0xFF, 0xF8, 0xDC, 0xFF);
-const APE::Color APE::KnownColor::CosmicCobalt = APE::Color(0x2E, 0x2D, 0x88, 0xFF);
-const APE::Color APE::KnownColor::CosmicLatte = APE::Color(0xFF, 0xF8, 0xE7, 0xFF);
-const APE::Color APE::KnownColor::CoyoteBrown = APE::Color(0x81, 0x61, 0x3C, 0xFF);
-const APE::Color APE::KnownColor::CottonCandy = APE::Color(0xFF, 0xBC, 0xD9, 0xFF);
-const APE::Color APE::KnownColor::Cream = APE::Color(0xFF, 0xFD, 0xD0, 0xFF);
-const APE::Color APE::KnownColor::Crimson = APE::Color(0xDC, 0x14, 0x3C, 0xFF);
-const APE::Color APE::KnownColor::CrimsonUa = APE::Color(0x9E, 0x1B, 0x32, 0xFF);
-const APE::Color APE::KnownColor::CulturedPearl = APE::Color(0xF5, 0xF5, 0xF5, 0xFF);
-const APE::Color APE::KnownColor::Cyan = APE::Color(0x00, 0xFF, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::CyanProcess = APE::Color(0x00, 0xB7, 0xEB, 0xFF);
-const APE::Color APE::KnownColor::CyberGrape = APE::Color(0x58, 0x42, 0x7C, 0xFF);
-const APE::Color APE::KnownColor::CyberYellow = APE::Color(0xFF, 0xD3, 0x00, 0xFF);
-const APE::Color APE::KnownColor::Cyclamen = APE::Color(0xF5, 0x6F, 0xA1, 0xFF);
-const APE::Color APE::KnownColor::Dandelion = APE::Color(0xFE, 0xD8, 0x5D, 0xFF);
-const APE::Color APE::KnownColor::DarkBrown = APE::Color(0x65, 0x43, 0x21, 0xFF);
-const APE::Color APE::KnownColor::DarkByzantium = APE::Color(0x5D, 0x39, 0x54, 0xFF);
-const APE::Color APE::KnownColor::DarkCyan = APE::Color(0x00, 0x8B, 0x8B, 0xFF);
-const APE::Color APE::KnownColor::DarkElectricBlue = APE::Color(0x53, 0x68, 0x78, 0xFF);
-const APE::Color APE::KnownColor::DarkGoldenrod = APE::Color(0xB8, 0x86, 0x0B, 0xFF);
-const APE::Color APE::KnownColor::DarkGreenX11 = APE::Color(0x00, 0x64, 0x00, 0xFF);
-const APE::Color APE::KnownColor::DarkJungleGreen = APE::Color(0x1A, 0x24, 0x21, 0xFF);
-const APE::Color APE::KnownColor::DarkKhaki = APE::Color(0xBD, 0xB7, 0x6B, 0xFF);
-const APE::Color APE::KnownColor::DarkLava = APE::Color(0x48, 0x3C, 0x32, 0xFF);
-const APE::Color APE::KnownColor::DarkLiverHorses = APE::Color(0x54, 0x3D, 0x37, 0xFF);
-const APE::Color APE::KnownColor::DarkMagenta = APE::Color(0x8B, 0x00, 0x8B, 0xFF);
-const APE::Color APE::KnownColor::DarkOliveGreen = APE::Color(0x55, 0x6B, 0x2F, 0xFF);
-const APE::Color APE::KnownColor::DarkOrange = APE::Color(0xFF, 0x8C, 0x00, 0xFF);
-const APE::Color APE::KnownColor::DarkOrchid = APE::Color(0x99, 0x32, 0xCC, 0xFF);
-const APE::Color APE::KnownColor::DarkPurple = APE::Color(0x30, 0x19, 0x34, 0xFF);
-const APE::Color APE::KnownColor::DarkRed = APE::Color(0x8B, 0x00, 0x00, 0xFF);
-const APE::Color APE::KnownColor::DarkSalmon = APE::Color(0xE9, 0x96, 0x7A, 0xFF);
-const APE::Color APE::KnownColor::DarkSeaGreen = APE::Color(0x8F, 0xBC, 0x8F, 0xFF);
-const APE::Color APE::KnownColor::DarkSienna = APE::Color(0x3C, 0x14, 0x14, 0xFF);
-const APE::Color APE::KnownColor::DarkSkyBlue = APE::Color(0x8C, 0xBE, 0xD6, 0xFF);
-const APE::Color APE::KnownColor::DarkSlateBlue = APE::Color(0x48, 0x3D, 0x8B, 0xFF);
-const APE::Color APE::KnownColor::DarkSlateGray = APE::Color(0x2F, 0x4F, 0x4F, 0xFF);
-const APE::Color APE::KnownColor::DarkSpringGreen = APE::Color(0x17, 0x72, 0x45, 0xFF);
-const APE::Color APE::KnownColor::DarkTurquoise = APE::Color(0x00, 0xCE, 0xD1, 0xFF);
-const APE::Color APE::KnownColor::DarkViolet = APE::Color(0x94, 0x00, 0xD3, 0xFF);
-const APE::Color APE::KnownColor::DavySGrey = APE::Color(0x55, 0x55, 0x55, 0xFF);
-const APE::Color APE::KnownColor::DeepCerise = APE::Color(0xDA, 0x32, 0x87, 0xFF);
-const APE::Color APE::KnownColor::DeepChampagne = APE::Color(0xFA, 0xD6, 0xA5, 0xFF);
-const APE::Color APE::KnownColor::DeepChestnut = APE::Color(0xB9, 0x4E, 0x48, 0xFF);
-const APE::Color APE::KnownColor::DeepJungleGreen = APE::Color(0x00, 0x4B, 0x49, 0xFF);
-const APE::Color APE::KnownColor::DeepPink = APE::Color(0xFF, 0x14, 0x93, 0xFF);
-const APE::Color APE::KnownColor::DeepSaffron = APE::Color(0xFF, 0x99, 0x33, 0xFF);
-const APE::Color APE::KnownColor::DeepSkyBlue = APE::Color(0x00, 0xBF, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::DeepSpaceSparkle = APE::Color(0x4A, 0x64, 0x6C, 0xFF);
-const APE::Color APE::KnownColor::DeepTaupe = APE::Color(0x7E, 0x5E, 0x60, 0xFF);
-const APE::Color APE::KnownColor::Denim = APE::Color(0x15, 0x60, 0xBD, 0xFF);
-const APE::Color APE::KnownColor::DenimBlue = APE::Color(0x22, 0x43, 0xB6, 0xFF);
-const APE::Color APE::KnownColor::Desert = APE::Color(0xC1, 0x9A, 0x6B, 0xFF);
-const APE::Color APE::KnownColor::DesertSand = APE::Color(0xED, 0xC9, 0xAF, 0xFF);
-const APE::Color APE::KnownColor::DimGray = APE::Color(0x69, 0x69, 0x69, 0xFF);
-const APE::Color APE::KnownColor::DodgerBlue = APE::Color(0x1E, 0x90, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::DrabDarkBrown = APE::Color(0x4A, 0x41, 0x2A, 0xFF);
-const APE::Color APE::KnownColor::DukeBlue = APE::Color(0x00, 0x00, 0x9C, 0xFF);
-const APE::Color APE::KnownColor::DutchWhite = APE::Color(0xEF, 0xDF, 0xBB, 0xFF);
-const APE::Color APE::KnownColor::Ebony = APE::Color(0x55, 0x5D, 0x50, 0xFF);
-const APE::Color APE::KnownColor::Ecru = APE::Color(0xC2, 0xB2, 0x80, 0xFF);
-const APE::Color APE::KnownColor::EerieBlack = APE::Color(0x1B, 0x1B, 0x1B, 0xFF);
-const APE::Color APE::KnownColor::Eggplant = APE::Color(0x61, 0x40, 0x51, 0xFF);
-const APE::Color APE::KnownColor::Eggshell = APE::Color(0xF0, 0xEA, 0xD6, 0xFF);
-const APE::Color APE::KnownColor::ElectricLime = APE::Color(0xCC, 0xFF, 0x00, 0xFF);
-const APE::Color APE::KnownColor::ElectricPurple = APE::Color(0xBF, 0x00, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::ElectricViolet = APE::Color(0x8F, 0x00, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::Emerald = APE::Color(0x50, 0xC8, 0x78, 0xFF);
-const APE::Color APE::KnownColor::Eminence = APE::Color(0x6C, 0x30, 0x82, 0xFF);
-const APE::Color APE::KnownColor::EnglishLavender = APE::Color(0xB4, 0x83, 0x95, 0xFF);
-const APE::Color APE::KnownColor::EnglishRed = APE::Color(0xAB, 0x4B, 0x52, 0xFF);
-const APE::Color APE::KnownColor::EnglishVermillion = APE::Color(0xCC, 0x47, 0x4B, 0xFF);
-const APE::Color APE::KnownColor::EnglishViolet = APE::Color(0x56, 0x3C, 0x5C, 0xFF);
-const APE::Color APE::KnownColor::Erin = APE::Color(0x00, 0xFF, 0x40, 0xFF);
-const APE::Color APE::KnownColor::EtonBlue = APE::Color(0x96, 0xC8, 0xA2, 0xFF);
-const APE::Color APE::KnownColor::Fallow = APE::Color(0xC1, 0x9A, 0x6B, 0xFF);
-const APE::Color APE::KnownColor::FaluRed = APE::Color(0x80, 0x18, 0x18, 0xFF);
-const APE::Color APE::KnownColor::Fandango = APE::Color(0xB5, 0x33, 0x89, 0xFF);
-const APE::Color APE::KnownColor::FandangoPink = APE::Color(0xDE, 0x52, 0x85, 0xFF);
-const APE::Color APE::KnownColor::Fawn = APE::Color(0xE5, 0xAA, 0x70, 0xFF);
-const APE::Color APE::KnownColor::FernGreen = APE::Color(0x4F, 0x79, 0x42, 0xFF);
-const APE::Color APE::KnownColor::FieldDrab = APE::Color(0x6C, 0x54, 0x1E, 0xFF);
-const APE::Color APE::KnownColor::FieryRose = APE::Color(0xFF, 0x54, 0x70, 0xFF);
-const APE::Color APE::KnownColor::Finn = APE::Color(0x68, 0x30, 0x68, 0xFF);
-const APE::Color APE::KnownColor::Firebrick = APE::Color(0xB2, 0x22, 0x22, 0xFF);
-const APE::Color APE::KnownColor::FireEngineRed = APE::Color(0xCE, 0x20, 0x29, 0xFF);
-const APE::Color APE::KnownColor::Flame = APE::Color(0xE2, 0x58, 0x22, 0xFF);
-const APE::Color APE::KnownColor::Flax = APE::Color(0xEE, 0xDC, 0x82, 0xFF);
-const APE::Color APE::KnownColor::Flirt = APE::Color(0xA2, 0x00, 0x6D, 0xFF);
-const APE::Color APE::KnownColor::FloralWhite = APE::Color(0xFF, 0xFA, 0xF0, 0xFF);
-const APE::Color APE::KnownColor::ForestGreenWeb = APE::Color(0x22, 0x8B, 0x22, 0xFF);
-const APE::Color APE::KnownColor::FrenchBeige = APE::Color(0xA6, 0x7B, 0x5B, 0xFF);
-const APE::Color APE::KnownColor::FrenchBistre = APE::Color(0x85, 0x6D, 0x4D, 0xFF);
-const APE::Color APE::KnownColor::FrenchBlue = APE::Color(0x00, 0x72, 0xBB, 0xFF);
-const APE::Color APE::KnownColor::FrenchFuchsia = APE::Color(0xFD, 0x3F, 0x92, 0xFF);
-const APE::Color APE::KnownColor::FrenchLilac = APE::Color(0x86, 0x60, 0x8E, 0xFF);
-const APE::Color APE::KnownColor::FrenchLime = APE::Color(0x9E, 0xFD, 0x38, 0xFF);
-const APE::Color APE::KnownColor::FrenchMauve = APE::Color(0xD4, 0x73, 0xD4, 0xFF);
-const APE::Color APE::KnownColor::FrenchPink = APE::Color(0xFD, 0x6C, 0x9E, 0xFF);
-const APE::Color APE::KnownColor::FrenchRaspberry = APE::Color(0xC7, 0x2C, 0x48, 0xFF);
-const APE::Color APE::KnownColor::FrenchSkyBlue = APE::Color(0x77, 0xB5, 0xFE, 0xFF);
-const APE::Color APE::KnownColor::FrenchViolet = APE::Color(0x88, 0x06, 0xCE, 0xFF);
-const APE::Color APE::KnownColor::Frostbite = APE::Color(0xE9, 0x36, 0xA7, 0xFF);
-const APE::Color APE::KnownColor::Fuchsia = APE::Color(0xFF, 0x00, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::FuchsiaCrayola = APE::Color(0xC1, 0x54, 0xC1, 0xFF);
-const APE::Color APE::KnownColor::Fulvous = APE::Color(0xE4, 0x84, 0x00, 0xFF);
-const APE::Color APE::KnownColor::FuzzyWuzzy = APE::Color(0x87, 0x42, 0x1F, 0xFF);
-const APE::Color APE::KnownColor::Gainsboro = APE::Color(0xDC, 0xDC, 0xDC, 0xFF);
-const APE::Color APE::KnownColor::Gamboge = APE::Color(0xE4, 0x9B, 0x0F, 0xFF);
-const APE::Color APE::KnownColor::GenericViridian = APE::Color(0x00, 0x7F, 0x66, 0xFF);
-const APE::Color APE::KnownColor::GhostWhite = APE::Color(0xF8, 0xF8, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::Glaucous = APE::Color(0x60, 0x82, 0xB6, 0xFF);
-const APE::Color APE::KnownColor::GlossyGrape = APE::Color(0xAB, 0x92, 0xB3, 0xFF);
-const APE::Color APE::KnownColor::GoGreen = APE::Color(0x00, 0xAB, 0x66, 0xFF);
-const APE::Color APE::KnownColor::GoldMetallic = APE::Color(0xD4, 0xAF, 0x37, 0xFF);
-const APE::Color APE::KnownColor::GoldWebGolden = APE::Color(0xFF, 0xD7, 0x00, 0xFF);
-const APE::Color APE::KnownColor::GoldCrayola = APE::Color(0xE6, 0xBE, 0x8A, 0xFF);
-const APE::Color APE::KnownColor::GoldFusion = APE::Color(0x85, 0x75, 0x4E, 0xFF);
-const APE::Color APE::KnownColor::GoldenBrown = APE::Color(0x99, 0x65, 0x15, 0xFF);
-const APE::Color APE::KnownColor::GoldenPoppy = APE::Color(0xFC, 0xC2, 0x00, 0xFF);
-const APE::Color APE::KnownColor::GoldenYellow = APE::Color(0xFF, 0xDF, 0x00, 0xFF);
-const APE::Color APE::KnownColor::Goldenrod = APE::Color(0xDA, 0xA5, 0x20, 0xFF);
-const APE::Color APE::KnownColor::GothamGreen = APE::Color(0x00, 0x57, 0x3F, 0xFF);
-const APE::Color APE::KnownColor::GraniteGray = APE::Color(0x67, 0x67, 0x67, 0xFF);
-const APE::Color APE::KnownColor::GrannySmithApple = APE::Color(0xA8, 0xE4, 0xA0, 0xFF);
-const APE::Color APE::KnownColor::GrayWeb = APE::Color(0x80, 0x80, 0x80, 0xFF);
-const APE::Color APE::KnownColor::GrayX11Gray = APE::Color(0xBE, 0xBE, 0xBE, 0xFF);
-const APE::Color APE::KnownColor::Green = APE::Color(0x00, 0xFF, 0x00, 0xFF);
-const APE::Color APE::KnownColor::GreenCrayola = APE::Color(0x1C, 0xAC, 0x78, 0xFF);
-const APE::Color APE::KnownColor::GreenWeb = APE::Color(0x00, 0x80, 0x00, 0xFF);
-const APE::Color APE::KnownColor::GreenMunsell = APE::Color(0x00, 0xA8, 0x77, 0xFF);
-const APE::Color APE::KnownColor::GreenNcs = APE::Color(0x00, 0x9F, 0x6B, 0xFF);
-const APE::Color APE::KnownColor::GreenPantone = APE::Color(0x00, 0xAD, 0x43, 0xFF);
-const APE::Color APE::KnownColor::GreenPigment = APE::Color(0x00, 0xA5, 0x50, 0xFF);
-const APE::Color APE::KnownColor::GreenBlue = APE::Color(0x11, 0x64, 0xB4, 0xFF);
-const APE::Color APE::KnownColor::GreenLizard = APE::Color(0xA7, 0xF4, 0x32, 0xFF);
-const APE::Color APE::KnownColor::GreenSheen = APE::Color(0x6E, 0xAE, 0xA1, 0xFF);
-const APE::Color APE::KnownColor::Gunmetal = APE::Color(0x2a, 0x34, 0x39, 0xFF);
-const APE::Color APE::KnownColor::HansaYellow = APE::Color(0xE9, 0xD6, 0x6B, 0xFF);
-const APE::Color APE::KnownColor::Harlequin = APE::Color(0x3F, 0xFF, 0x00, 0xFF);
-const APE::Color APE::KnownColor::HarvestGold = APE::Color(0xDA, 0x91, 0x00, 0xFF);
-const APE::Color APE::KnownColor::HeatWave = APE::Color(0xFF, 0x7A, 0x00, 0xFF);
-const APE::Color APE::KnownColor::Heliotrope = APE::Color(0xDF, 0x73, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::HeliotropeGray = APE::Color(0xAA, 0x98, 0xA9, 0xFF);
-const APE::Color APE::KnownColor::HollywoodCerise = APE::Color(0xF4, 0x00, 0xA1, 0xFF);
-const APE::Color APE::KnownColor::HonoluluBlue = APE::Color(0x00, 0x6D, 0xB0, 0xFF);
-const APE::Color APE::KnownColor::HookerSGreen = APE::Color(0x49, 0x79, 0x6B, 0xFF);
-const APE::Color APE::KnownColor::HotMagenta = APE::Color(0xFF, 0x1D, 0xCE, 0xFF);
-const APE::Color APE::KnownColor::HotPink = APE::Color(0xFF, 0x69, 0xB4, 0xFF);
-const APE::Color APE::KnownColor::HunterGreen = APE::Color(0x35, 0x5E, 0x3B, 0xFF);
-const APE::Color APE::KnownColor::Iceberg = APE::Color(0x71, 0xA6, 0xD2, 0xFF);
-const APE::Color APE::KnownColor::IlluminatingEmerald = APE::Color(0x31, 0x91, 0x77, 0xFF);
-const APE::Color APE::KnownColor::ImperialRed = APE::Color(0xED, 0x29, 0x39, 0xFF);
-const APE::Color APE::KnownColor::Inchworm = APE::Color(0xB2, 0xEC, 0x5D, 0xFF);
-const APE::Color APE::KnownColor::Independence = APE::Color(0x4C, 0x51, 0x6D, 0xFF);
-const APE::Color APE::KnownColor::IndiaGreen = APE::Color(0x13, 0x88, 0x08, 0xFF);
-const APE::Color APE::KnownColor::IndianRed = APE::Color(0xCD, 0x5C, 0x5C, 0xFF);
-const APE::Color APE::KnownColor::IndianYellow = APE::Color(0xE3, 0xA8, 0x57, 0xFF);
-const APE::Color APE::KnownColor::Indigo = APE::Color(0x4B, 0x00, 0x82, 0xFF);
-const APE::Color APE::KnownColor::IndigoDye = APE::Color(0x00, 0x41, 0x6A, 0xFF);
-const APE::Color APE::KnownColor::InternationalKleinBlue = APE::Color(0x13, 0x0a, 0x8f, 0xFF);
-const APE::Color APE::KnownColor::InternationalOrangeEngineering = APE::Color(0xBA, 0x16, 0x0C, 0xFF);
-const APE::Color APE::KnownColor::InternationalOrangeGoldenGateBridge = APE::Color(0xC0, 0x36, 0x2C, 0xFF);
-const APE::Color APE::KnownColor::Irresistible = APE::Color(0xB3, 0x44, 0x6C, 0xFF);
-const APE::Color APE::KnownColor::Isabelline = APE::Color(0xF4, 0xF0, 0xEC, 0xFF);
-const APE::Color APE::KnownColor::ItalianSkyBlue = APE::Color(0xB2, 0xFF, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::Ivory = APE::Color(0xFF, 0xFF, 0xF0, 0xFF);
-const APE::Color APE::KnownColor::JapaneseCarmine = APE::Color(0x9D, 0x29, 0x33, 0xFF);
-const APE::Color APE::KnownColor::JapaneseViolet = APE::Color(0x5B, 0x32, 0x56, 0xFF);
-const APE::Color APE::KnownColor::Jasmine = APE::Color(0xF8, 0xDE, 0x7E, 0xFF);
-const APE::Color APE::KnownColor::JazzberryJam = APE::Color(0xA5, 0x0B, 0x5E, 0xFF);
-const APE::Color APE::KnownColor::Jet = APE::Color(0x34, 0x34, 0x34, 0xFF);
-const APE::Color APE::KnownColor::Jonquil = APE::Color(0xF4, 0xCA, 0x16, 0xFF);
-const APE::Color APE::KnownColor::JuneBud = APE::Color(0xBD, 0xDA, 0x57, 0xFF);
-const APE::Color APE::KnownColor::JungleGreen = APE::Color(0x29, 0xAB, 0x87, 0xFF);
-const APE::Color APE::KnownColor::KellyGreen = APE::Color(0x4C, 0xBB, 0x17, 0xFF);
-const APE::Color APE::KnownColor::Keppel = APE::Color(0x3A, 0xB0, 0x9E, 0xFF);
-const APE::Color APE::KnownColor::KeyLime = APE::Color(0xE8, 0xF4, 0x8C, 0xFF);
-const APE::Color APE::KnownColor::KhakiWeb = APE::Color(0xC3, 0xB0, 0x91, 0xFF);
-const APE::Color APE::KnownColor::KhakiX11LightKhaki = APE::Color(0xF0, 0xE6, 0x8C, 0xFF);
-const APE::Color APE::KnownColor::Kobe = APE::Color(0x88, 0x2D, 0x17, 0xFF);
-const APE::Color APE::KnownColor::Kobi = APE::Color(0xE7, 0x9F, 0xC4, 0xFF);
-const APE::Color APE::KnownColor::Kobicha = APE::Color(0x6B, 0x44, 0x23, 0xFF);
-const APE::Color APE::KnownColor::KsuPurple = APE::Color(0x51, 0x28, 0x88, 0xFF);
-const APE::Color APE::KnownColor::LanguidLavender = APE::Color(0xD6, 0xCA, 0xDD, 0xFF);
-const APE::Color APE::KnownColor::LapisLazuli = APE::Color(0x26, 0x61, 0x9C, 0xFF);
-const APE::Color APE::KnownColor::LaserLemon = APE::Color(0xFF, 0xFF, 0x66, 0xFF);
-const APE::Color APE::KnownColor::LaurelGreen = APE::Color(0xA9, 0xBA, 0x9D, 0xFF);
-const APE::Color APE::KnownColor::Lava = APE::Color(0xCF, 0x10, 0x20, 0xFF);
-const APE::Color APE::KnownColor::LavenderFloral = APE::Color(0xB5, 0x7E, 0xDC, 0xFF);
-const APE::Color APE::KnownColor::LavenderWeb = APE::Color(0xE6, 0xE6, 0xFA, 0xFF);
-const APE::Color APE::KnownColor::LavenderBlue = APE::Color(0xCC, 0xCC, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::LavenderBlush = APE::Color(0xFF, 0xF0, 0xF5, 0xFF);
-const APE::Color APE::KnownColor::LavenderGray = APE::Color(0xC4, 0xC3, 0xD0, 0xFF);
-const APE::Color APE::KnownColor::LawnGreen = APE::Color(0x7C, 0xFC, 0x00, 0xFF);
-const APE::Color APE::KnownColor::Lemon = APE::Color(0xFF, 0xF7, 0x00, 0xFF);
-const APE::Color APE::KnownColor::LemonChiffon = APE::Color(0xFF, 0xFA, 0xCD, 0xFF);
-const APE::Color APE::KnownColor::LemonCurry = APE::Color(0xCC, 0xA0, 0x1D, 0xFF);
-const APE::Color APE::KnownColor::LemonGlacier = APE::Color(0xFD, 0xFF, 0x00, 0xFF);
-const APE::Color APE::KnownColor::LemonMeringue = APE::Color(0xF6, 0xEA, 0xBE, 0xFF);
-const APE::Color APE::KnownColor::LemonYellow = APE::Color(0xFF, 0xF4, 0x4F, 0xFF);
-const APE::Color APE::KnownColor::LemonYellowCrayola = APE::Color(0xFF, 0xFF, 0x9F, 0xFF);
-const APE::Color APE::KnownColor::Liberty = APE::Color(0x54, 0x5A, 0xA7, 0xFF);
-const APE::Color APE::KnownColor::LightBlue = APE::Color(0xAD, 0xD8, 0xE6, 0xFF);
-const APE::Color APE::KnownColor::LightCoral = APE::Color(0xF0, 0x80, 0x80, 0xFF);
-const APE::Color APE::KnownColor::LightCornflowerBlue = APE::Color(0x93, 0xCC, 0xEA, 0xFF);
-const APE::Color APE::KnownColor::LightCyan = APE::Color(0xE0, 0xFF, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::LightFrenchBeige = APE::Color(0xC8, 0xAD, 0x7F, 0xFF);
-const APE::Color APE::KnownColor::LightGoldenrodYellow = APE::Color(0xFA, 0xFA, 0xD2, 0xFF);
-const APE::Color APE::KnownColor::LightGray = APE::Color(0xD3, 0xD3, 0xD3, 0xFF);
-const APE::Color APE::KnownColor::LightGreen = APE::Color(0x90, 0xEE, 0x90, 0xFF);
-const APE::Color APE::KnownColor::LightOrange = APE::Color(0xFE, 0xD8, 0xB1, 0xFF);
-const APE::Color APE::KnownColor::LightPeriwinkle = APE::Color(0xC5, 0xCB, 0xE1, 0xFF);
-const APE::Color APE::KnownColor::LightPink = APE::Color(0xFF, 0xB6, 0xC1, 0xFF);
-const APE::Color APE::KnownColor::LightSalmon = APE::Color(0xFF, 0xA0, 0x7A, 0xFF);
-const APE::Color APE::KnownColor::LightSeaGreen = APE::Color(0x20, 0xB2, 0xAA, 0xFF);
-const APE::Color APE::KnownColor::LightSkyBlue = APE::Color(0x87, 0xCE, 0xFA, 0xFF);
-const APE::Color APE::KnownColor::LightSlateGray = APE::Color(0x77, 0x88, 0x99, 0xFF);
-const APE::Color APE::KnownColor::LightSteelBlue = APE::Color(0xB0, 0xC4, 0xDE, 0xFF);
-const APE::Color APE::KnownColor::LightYellow = APE::Color(0xFF, 0xFF, 0xE0, 0xFF);
-const APE::Color APE::KnownColor::Lilac = APE::Color(0xC8, 0xA2, 0xC8, 0xFF);
-const APE::Color APE::KnownColor::LilacLuster = APE::Color(0xAE, 0x98, 0xAA, 0xFF);
-const APE::Color APE::KnownColor::LimeColorWheel = APE::Color(0xBF, 0xFF, 0x00, 0xFF);
-const APE::Color APE::KnownColor::LimeWebX11Green = APE::Color(0x00, 0xFF, 0x00, 0xFF);
-const APE::Color APE::KnownColor::LimeGreen = APE::Color(0x32, 0xCD, 0x32, 0xFF);
-const APE::Color APE::KnownColor::LincolnGreen = APE::Color(0x19, 0x59, 0x05, 0xFF);
-const APE::Color APE::KnownColor::Linen = APE::Color(0xFA, 0xF0, 0xE6, 0xFF);
-const APE::Color APE::KnownColor::Lion = APE::Color(0xDE, 0xCC, 0x9C, 0xFF);
-const APE::Color APE::KnownColor::LiseranPurple = APE::Color(0xDE, 0x6F, 0xA1, 0xFF);
-const APE::Color APE::KnownColor::LittleBoyBlue = APE::Color(0x6C, 0xA0, 0xDC, 0xFF);
-const APE::Color APE::KnownColor::Liver = APE::Color(0x67, 0x4C, 0x47, 0xFF);
-const APE::Color APE::KnownColor::LiverDogs = APE::Color(0xB8, 0x6D, 0x29, 0xFF);
-const APE::Color APE::KnownColor::LiverOrgan = APE::Color(0x6C, 0x2E, 0x1F, 0xFF);
-const APE::Color APE::KnownColor::LiverChestnut = APE::Color(0x98, 0x74, 0x56, 0xFF);
-const APE::Color APE::KnownColor::Livid = APE::Color(0x66, 0x99, 0xCC, 0xFF);
-const APE::Color APE::KnownColor::MacaroniAndCheese = APE::Color(0xFF, 0xBD, 0x88, 0xFF);
-const APE::Color APE::KnownColor::MadderLake = APE::Color(0xCC, 0x33, 0x36, 0xFF);
-const APE::Color APE::KnownColor::Magenta = APE::Color(0xFF, 0x00, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::MagentaCrayola = APE::Color(0xF6, 0x53, 0xA6, 0xFF);
-const APE::Color APE::KnownColor::MagentaDye = APE::Color(0xCA, 0x1F, 0x7B, 0xFF);
-const APE::Color APE::KnownColor::MagentaPantone = APE::Color(0xD0, 0x41, 0x7E, 0xFF);
-const APE::Color APE::KnownColor::MagentaProcess = APE::Color(0xFF, 0x00, 0x90, 0xFF);
-const APE::Color APE::KnownColor::MagentaHaze = APE::Color(0x9F, 0x45, 0x76, 0xFF);
-const APE::Color APE::KnownColor::MagicMint = APE::Color(0xAA, 0xF0, 0xD1, 0xFF);
-const APE::Color APE::KnownColor::Magnolia = APE::Color(0xF2, 0xE8, 0xD7, 0xFF);
-const APE::Color APE::KnownColor::Mahogany = APE::Color(0xC0, 0x40, 0x00, 0xFF);
-const APE::Color APE::KnownColor::Maize = APE::Color(0xFB, 0xEC, 0x5D, 0xFF);
-const APE::Color APE::KnownColor::MaizeCrayola = APE::Color(0xF2, 0xC6, 0x49, 0xFF);
-const APE::Color APE::KnownColor::MajorelleBlue = APE::Color(0x60, 0x50, 0xDC, 0xFF);
-const APE::Color APE::KnownColor::Malachite = APE::Color(0x0B, 0xDA, 0x51, 0xFF);
-const APE::Color APE::KnownColor::Manatee = APE::Color(0x97, 0x9A, 0xAA, 0xFF);
-const APE::Color APE::KnownColor::Mandarin = APE::Color(0xF3, 0x7A, 0x48, 0xFF);
-const APE::Color APE::KnownColor::Mango = APE::Color(0xFD, 0xBE, 0x02, 0xFF);
-const APE::Color APE::KnownColor::MangoTango = APE::Color(0xFF, 0x82, 0x43, 0xFF);
-const APE::Color APE::KnownColor::Mantis = APE::Color(0x74, 0xC3, 0x65, 0xFF);
-const APE::Color APE::KnownColor::MardiGras = APE::Color(0x88, 0x00, 0x85, 0xFF);
-const APE::Color APE::KnownColor::Marigold = APE::Color(0xEA, 0xA2, 0x21, 0xFF);
-const APE::Color APE::KnownColor::MaroonCrayola = APE::Color(0xC3, 0x21, 0x48, 0xFF);
-const APE::Color APE::KnownColor::MaroonWeb = APE::Color(0x80, 0x00, 0x00, 0xFF);
-const APE::Color APE::KnownColor::MaroonX11 = APE::Color(0xB0, 0x30, 0x60, 0xFF);
-const APE::Color APE::KnownColor::Mauve = APE::Color(0xE0, 0xB0, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::MauveTaupe = APE::Color(0x91, 0x5F, 0x6D, 0xFF);
-const APE::Color APE::KnownColor::Mauvelous = APE::Color(0xEF, 0x98, 0xAA, 0xFF);
-const APE::Color APE::KnownColor::MaximumBlue = APE::Color(0x47, 0xAB, 0xCC, 0xFF);
-const APE::Color APE::KnownColor::MaximumBlueGreen = APE::Color(0x30, 0xBF, 0xBF, 0xFF);
-const APE::Color APE::KnownColor::MaximumBluePurple = APE::Color(0xAC, 0xAC, 0xE6, 0xFF);
-const APE::Color APE::KnownColor::MaximumGreen = APE::Color(0x5E, 0x8C, 0x31, 0xFF);
-const APE::Color APE::KnownColor::MaximumGreenYellow = APE::Color(0xD9, 0xE6, 0x50, 0xFF);
-const APE::Color APE::KnownColor::MaximumPurple = APE::Color(0x73, 0x33, 0x80, 0xFF);
-const APE::Color APE::KnownColor::MaximumRed = APE::Color(0xD9, 0x21, 0x21, 0xFF);
-const APE::Color APE::KnownColor::MaximumRedPurple = APE::Color(0xA6, 0x3A, 0x79, 0xFF);
-const APE::Color APE::KnownColor::MaximumYellow = APE::Color(0xFA, 0xFA, 0x37, 0xFF);
-const APE::Color APE::KnownColor::MaximumYellowRed = APE::Color(0xF2, 0xBA, 0x49, 0xFF);
-const APE::Color APE::KnownColor::MayGreen = APE::Color(0x4C, 0x91, 0x41, 0xFF);
-const APE::Color APE::KnownColor::MayaBlue = APE::Color(0x73, 0xC2, 0xFB, 0xFF);
-const APE::Color APE::KnownColor::MediumAquamarine = APE::Color(0x66, 0xDD, 0xAA, 0xFF);
-const APE::Color APE::KnownColor::MediumBlue = APE::Color(0x00, 0x00, 0xCD, 0xFF);
-const APE::Color APE::KnownColor::MediumCandyAppleRed = APE::Color(0xE2, 0x06, 0x2C, 0xFF);
-const APE::Color APE::KnownColor::MediumCarmine = APE::Color(0xAF, 0x40, 0x35, 0xFF);
-const APE::Color APE::KnownColor::MediumChampagne = APE::Color(0xF3, 0xE5, 0xAB, 0xFF);
-const APE::Color APE::KnownColor::MediumOrchid = APE::Color(0xBA, 0x55, 0xD3, 0xFF);
-const APE::Color APE::KnownColor::MediumPurple = APE::Color(0x93, 0x70, 0xDB, 0xFF);
-const APE::Color APE::KnownColor::MediumSeaGreen = APE::Color(0x3C, 0xB3, 0x71, 0xFF);
-const APE::Color APE::KnownColor::MediumSlateBlue = APE::Color(0x7B, 0x68, 0xEE, 0xFF);
-const APE::Color APE::KnownColor::MediumSpringGreen = APE::Color(0x00, 0xFA, 0x9A, 0xFF);
-const APE::Color APE::KnownColor::MediumTurquoise = APE::Color(0x48, 0xD1, 0xCC, 0xFF);
-const APE::Color APE::KnownColor::MediumVioletRed = APE::Color(0xC7, 0x15, 0x85, 0xFF);
-const APE::Color APE::KnownColor::MellowApricot = APE::Color(0xF8, 0xB8, 0x78, 0xFF);
-const APE::Color APE::KnownColor::MellowYellow = APE::Color(0xF8, 0xDE, 0x7E, 0xFF);
-const APE::Color APE::KnownColor::Melon = APE::Color(0xFE, 0xBA, 0xAD, 0xFF);
-const APE::Color APE::KnownColor::MetallicGold = APE::Color(0xD3, 0xAF, 0x37, 0xFF);
-const APE::Color APE::KnownColor::MetallicSeaweed = APE::Color(0x0A, 0x7E, 0x8C, 0xFF);
-const APE::Color APE::KnownColor::MetallicSunburst = APE::Color(0x9C, 0x7C, 0x38, 0xFF);
-const APE::Color APE::KnownColor::MexicanPink = APE::Color(0xE4, 0x00, 0x7C, 0xFF);
-const APE::Color APE::KnownColor::MiddleBlue = APE::Color(0x7E, 0xD4, 0xE6, 0xFF);
-const APE::Color APE::KnownColor::MiddleBlueGreen = APE::Color(0x8D, 0xD9, 0xCC, 0xFF);
-const APE::Color APE::KnownColor::MiddleBluePurple = APE::Color(0x8B, 0x72, 0xBE, 0xFF);
-const APE::Color APE::KnownColor::MiddleGrey = APE::Color(0x8B, 0x86, 0x80, 0xFF);
-const APE::Color APE::KnownColor::MiddleGreen = APE::Color(0x4D, 0x8C, 0x57, 0xFF);
-const APE::Color APE::KnownColor::MiddleGreenYellow = APE::Color(0xAC, 0xBF, 0x60, 0xFF);
-const APE::Color APE::KnownColor::MiddlePurple = APE::Color(0xD9, 0x82, 0xB5, 0xFF);
-const APE::Color APE::KnownColor::MiddleRed = APE::Color(0xE5, 0x8E, 0x73, 0xFF);
-const APE::Color APE::KnownColor::MiddleRedPurple = APE::Color(0xA5, 0x53, 0x53, 0xFF);
-const APE::Color APE::KnownColor::MiddleYellow = APE::Color(0xFF, 0xEB, 0x00, 0xFF);
-const APE::Color APE::KnownColor::MiddleYellowRed = APE::Color(0xEC, 0xB1, 0x76, 0xFF);
-const APE::Color APE::KnownColor::Midnight = APE::Color(0x70, 0x26, 0x70, 0xFF);
-const APE::Color APE::KnownColor::MidnightBlue = APE::Color(0x19, 0x19, 0x70, 0xFF);
-const APE::Color APE::KnownColor::MidnightGreenEagleGreen = APE::Color(0x00, 0x49, 0x53, 0xFF);
-const APE::Color APE::KnownColor::MikadoYellow = APE::Color(0xFF, 0xC4, 0x0C, 0xFF);
-const APE::Color APE::KnownColor::MimiPink = APE::Color(0xFF, 0xDA, 0xE9, 0xFF);
-const APE::Color APE::KnownColor::Mindaro = APE::Color(0xE3, 0xF9, 0x88, 0xFF);
-const APE::Color APE::KnownColor::Ming = APE::Color(0x36, 0x74, 0x7D, 0xFF);
-const APE::Color APE::KnownColor::MinionYellow = APE::Color(0xF5, 0xE0, 0x50, 0xFF);
-const APE::Color APE::KnownColor::Mint = APE::Color(0x3E, 0xB4, 0x89, 0xFF);
-const APE::Color APE::KnownColor::MintCream = APE::Color(0xF5, 0xFF, 0xFA, 0xFF);
-const APE::Color APE::KnownColor::MintGreen = APE::Color(0x98, 0xFF, 0x98, 0xFF);
-const APE::Color APE::KnownColor::MistyMoss = APE::Color(0xBB, 0xB4, 0x77, 0xFF);
-const APE::Color APE::KnownColor::MistyRose = APE::Color(0xFF, 0xE4, 0xE1, 0xFF);
-const APE::Color APE::KnownColor::ModeBeige = APE::Color(0x96, 0x71, 0x17, 0xFF);
-const APE::Color APE::KnownColor::MonaLisa = APE::Color(0xFF, 0x94, 0x8E, 0xFF);
-const APE::Color APE::KnownColor::MorningBlue = APE::Color(0x8D, 0xA3, 0x99, 0xFF);
-const APE::Color APE::KnownColor::MossGreen = APE::Color(0x8A, 0x9A, 0x5B, 0xFF);
-const APE::Color APE::KnownColor::MountainMeadow = APE::Color(0x30, 0xBA, 0x8F, 0xFF);
-const APE::Color APE::KnownColor::MountbattenPink = APE::Color(0x99, 0x7A, 0x8D, 0xFF);
-const APE::Color APE::KnownColor::MsuGreen = APE::Color(0x18, 0x45, 0x3B, 0xFF);
-const APE::Color APE::KnownColor::Mulberry = APE::Color(0xC5, 0x4B, 0x8C, 0xFF);
-const APE::Color APE::KnownColor::MulberryCrayola = APE::Color(0xC8, 0x50, 0x9B, 0xFF);
-const APE::Color APE::KnownColor::Mustard = APE::Color(0xFF, 0xDB, 0x58, 0xFF);
-const APE::Color APE::KnownColor::MyrtleGreen = APE::Color(0x31, 0x78, 0x73, 0xFF);
-const APE::Color APE::KnownColor::Mystic = APE::Color(0xD6, 0x52, 0x82, 0xFF);
-const APE::Color APE::KnownColor::MysticMaroon = APE::Color(0xAD, 0x43, 0x79, 0xFF);
-const APE::Color APE::KnownColor::NadeshikoPink = APE::Color(0xF6, 0xAD, 0xC6, 0xFF);
-const APE::Color APE::KnownColor::NaplesYellow = APE::Color(0xFA, 0xDA, 0x5E, 0xFF);
-const APE::Color APE::KnownColor::NavajoWhite = APE::Color(0xFF, 0xDE, 0xAD, 0xFF);
-const APE::Color APE::KnownColor::NavyBlue = APE::Color(0x00, 0x00, 0x80, 0xFF);
-const APE::Color APE::KnownColor::NavyBlueCrayola = APE::Color(0x19, 0x74, 0xD2, 0xFF);
-const APE::Color APE::KnownColor::NeonBlue = APE::Color(0x46, 0x66, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::NeonGreen = APE::Color(0x39, 0xFF, 0x14, 0xFF);
-const APE::Color APE::KnownColor::NeonFuchsia = APE::Color(0xFE, 0x41, 0x64, 0xFF);
-const APE::Color APE::KnownColor::NewCar = APE::Color(0x21, 0x4F, 0xC6, 0xFF);
-const APE::Color APE::KnownColor::NewYorkPink = APE::Color(0xD7, 0x83, 0x7F, 0xFF);
-const APE::Color APE::KnownColor::Nickel = APE::Color(0x72, 0x74, 0x72, 0xFF);
-const APE::Color APE::KnownColor::NonPhotoBlue = APE::Color(0xA4, 0xDD, 0xED, 0xFF);
-const APE::Color APE::KnownColor::Nyanza = APE::Color(0xE9, 0xFF, 0xDB, 0xFF);
-const APE::Color APE::KnownColor::Ochre = APE::Color(0xCC, 0x77, 0x22, 0xFF);
-const APE::Color APE::KnownColor::OldBurgundy = APE::Color(0x43, 0x30, 0x2E, 0xFF);
-const APE::Color APE::KnownColor::OldGold = APE::Color(0xCF, 0xB5, 0x3B, 0xFF);
-const APE::Color APE::KnownColor::OldLace = APE::Color(0xFD, 0xF5, 0xE6, 0xFF);
-const APE::Color APE::KnownColor::OldLavender = APE::Color(0x79, 0x68, 0x78, 0xFF);
-const APE::Color APE::KnownColor::OldMauve = APE::Color(0x67, 0x31, 0x47, 0xFF);
-const APE::Color APE::KnownColor::OldRose = APE::Color(0xC0, 0x80, 0x81, 0xFF);
-const APE::Color APE::KnownColor::OldSilver = APE::Color(0x84, 0x84, 0x82, 0xFF);
-const APE::Color APE::KnownColor::Olive = APE::Color(0x80, 0x80, 0x00, 0xFF);
-const APE::Color APE::KnownColor::OliveDrab3 = APE::Color(0x6B, 0x8E, 0x23, 0xFF);
-const APE::Color APE::KnownColor::OliveDrab7 = APE::Color(0x3C, 0x34, 0x1F, 0xFF);
-const APE::Color APE::KnownColor::OliveGreen = APE::Color(0xB5, 0xB3, 0x5C, 0xFF);
-const APE::Color APE::KnownColor::Olivine = APE::Color(0x9A, 0xB9, 0x73, 0xFF);
-const APE::Color APE::KnownColor::Onyx = APE::Color(0x35, 0x38, 0x39, 0xFF);
-const APE::Color APE::KnownColor::Opal = APE::Color(0xA8, 0xC3, 0xBC, 0xFF);
-const APE::Color APE::KnownColor::OperaMauve = APE::Color(0xB7, 0x84, 0xA7, 0xFF);
-const APE::Color APE::KnownColor::Orange = APE::Color(0xFF, 0x7F, 0x00, 0xFF);
-const APE::Color APE::KnownColor::OrangeCrayola = APE::Color(0xFF, 0x75, 0x38, 0xFF);
-const APE::Color APE::KnownColor::OrangePantone = APE::Color(0xFF, 0x58, 0x00, 0xFF);
-const APE::Color APE::KnownColor::OrangeWeb = APE::Color(0xFF, 0xA5, 0x00, 0xFF);
-const APE::Color APE::KnownColor::OrangePeel = APE::Color(0xFF, 0x9F, 0x00, 0xFF);
-const APE::Color APE::KnownColor::OrangeRed = APE::Color(0xFF, 0x68, 0x1F, 0xFF);
-const APE::Color APE::KnownColor::OrangeRedCrayola = APE::Color(0xFF, 0x53, 0x49, 0xFF);
-const APE::Color APE::KnownColor::OrangeSoda = APE::Color(0xFA, 0x5B, 0x3D, 0xFF);
-const APE::Color APE::KnownColor::OrangeYellow = APE::Color(0xF5, 0xBD, 0x1F, 0xFF);
-const APE::Color APE::KnownColor::OrangeYellowCrayola = APE::Color(0xF8, 0xD5, 0x68, 0xFF);
-const APE::Color APE::KnownColor::Orchid = APE::Color(0xDA, 0x70, 0xD6, 0xFF);
-const APE::Color APE::KnownColor::OrchidPink = APE::Color(0xF2, 0xBD, 0xCD, 0xFF);
-const APE::Color APE::KnownColor::OrchidCrayola = APE::Color(0xE2, 0x9C, 0xD2, 0xFF);
-const APE::Color APE::KnownColor::OuterSpaceCrayola = APE::Color(0x2D, 0x38, 0x3A, 0xFF);
-const APE::Color APE::KnownColor::OutrageousOrange = APE::Color(0xFF, 0x6E, 0x4A, 0xFF);
-const APE::Color APE::KnownColor::Oxblood = APE::Color(0x4A, 0x00, 0x00, 0xFF);
-const APE::Color APE::KnownColor::OxfordBlue = APE::Color(0x00, 0x21, 0x47, 0xFF);
-const APE::Color APE::KnownColor::OuCrimsonRed = APE::Color(0x84, 0x16, 0x17, 0xFF);
-const APE::Color APE::KnownColor::PacificBlue = APE::Color(0x1C, 0xA9, 0xC9, 0xFF);
-const APE::Color APE::KnownColor::PakistanGreen = APE::Color(0x00, 0x66, 0x00, 0xFF);
-const APE::Color APE::KnownColor::PalatinatePurple = APE::Color(0x68, 0x28, 0x60, 0xFF);
-const APE::Color APE::KnownColor::PaleAqua = APE::Color(0xBE, 0xD3, 0xE5, 0xFF);
-const APE::Color APE::KnownColor::PaleCerulean = APE::Color(0x9B, 0xC4, 0xE2, 0xFF);
-const APE::Color APE::KnownColor::PaleDogwood = APE::Color(0xED, 0x7A, 0x9B, 0xFF);
-const APE::Color APE::KnownColor::PalePink = APE::Color(0xFA, 0xDA, 0xDD, 0xFF);
-const APE::Color APE::KnownColor::PalePurplePantone = APE::Color(0xFA, 0xE6, 0xFA, 0xFF);
-const APE::Color APE::KnownColor::PaleSpringBud = APE::Color(0xEC, 0xEB, 0xBD, 0xFF);
-const APE::Color APE::KnownColor::PansyPurple = APE::Color(0x78, 0x18, 0x4A, 0xFF);
-const APE::Color APE::KnownColor::PaoloVeroneseGreen = APE::Color(0x00, 0x9B, 0x7D, 0xFF);
-const APE::Color APE::KnownColor::PapayaWhip = APE::Color(0xFF, 0xEF, 0xD5, 0xFF);
-const APE::Color APE::KnownColor::ParadisePink = APE::Color(0xE6, 0x3E, 0x62, 0xFF);
-const APE::Color APE::KnownColor::Parchment = APE::Color(0xF1, 0xE9, 0xD2, 0xFF);
-const APE::Color APE::KnownColor::ParisGreen = APE::Color(0x50, 0xC8, 0x78, 0xFF);
-const APE::Color APE::KnownColor::PastelPink = APE::Color(0xDE, 0xA5, 0xA4, 0xFF);
-const APE::Color APE::KnownColor::Patriarch = APE::Color(0x80, 0x00, 0x80, 0xFF);
-const APE::Color APE::KnownColor::Paua = APE::Color(0x1F, 0x00, 0x5E, 0xFF);
-const APE::Color APE::KnownColor::PayneSGrey = APE::Color(0x53, 0x68, 0x78, 0xFF);
-const APE::Color APE::KnownColor::Peach = APE::Color(0xFF, 0xE5, 0xB4, 0xFF);
-const APE::Color APE::KnownColor::PeachCrayola = APE::Color(0xFF, 0xCB, 0xA4, 0xFF);
-const APE::Color APE::KnownColor::PeachPuff = APE::Color(0xFF, 0xDA, 0xB9, 0xFF);
-const APE::Color APE::KnownColor::Pear = APE::Color(0xD1, 0xE2, 0x31, 0xFF);
-const APE::Color APE::KnownColor::PearlyPurple = APE::Color(0xB7, 0x68, 0xA2, 0xFF);
-const APE::Color APE::KnownColor::Periwinkle = APE::Color(0xCC, 0xCC, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::PeriwinkleCrayola = APE::Color(0xC3, 0xCD, 0xE6, 0xFF);
-const APE::Color APE::KnownColor::PermanentGeraniumLake = APE::Color(0xE1, 0x2C, 0x2C, 0xFF);
-const APE::Color APE::KnownColor::PersianBlue = APE::Color(0x1C, 0x39, 0xBB, 0xFF);
-const APE::Color APE::KnownColor::PersianGreen = APE::Color(0x00, 0xA6, 0x93, 0xFF);
-const APE::Color APE::KnownColor::PersianIndigo = APE::Color(0x32, 0x12, 0x7A, 0xFF);
-const APE::Color APE::KnownColor::PersianOrange = APE::Color(0xD9, 0x90, 0x58, 0xFF);
-const APE::Color APE::KnownColor::PersianPink = APE::Color(0xF7, 0x7F, 0xBE, 0xFF);
-const APE::Color APE::KnownColor::PersianPlum = APE::Color(0x70, 0x1C, 0x1C, 0xFF);
-const APE::Color APE::KnownColor::PersianRed = APE::Color(0xCC, 0x33, 0x33, 0xFF);
-const APE::Color APE::KnownColor::PersianRose = APE::Color(0xFE, 0x28, 0xA2, 0xFF);
-const APE::Color APE::KnownColor::Persimmon = APE::Color(0xEC, 0x58, 0x00, 0xFF);
-const APE::Color APE::KnownColor::PewterBlue = APE::Color(0x8B, 0xA8, 0xB7, 0xFF);
-const APE::Color APE::KnownColor::Phlox = APE::Color(0xDF, 0x00, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::PhthaloBlue = APE::Color(0x00, 0x0F, 0x89, 0xFF);
-const APE::Color APE::KnownColor::PhthaloGreen = APE::Color(0x12, 0x35, 0x24, 0xFF);
-const APE::Color APE::KnownColor::PicoteeBlue = APE::Color(0x2E, 0x27, 0x87, 0xFF);
-const APE::Color APE::KnownColor::PictorialCarmine = APE::Color(0xC3, 0x0B, 0x4E, 0xFF);
-const APE::Color APE::KnownColor::PiggyPink = APE::Color(0xFD, 0xDD, 0xE6, 0xFF);
-const APE::Color APE::KnownColor::PineGreen = APE::Color(0x01, 0x79, 0x6F, 0xFF);
-const APE::Color APE::KnownColor::PineTree = APE::Color(0x2A, 0x2F, 0x23, 0xFF);
-const APE::Color APE::KnownColor::Pink = APE::Color(0xFF, 0xC0, 0xCB, 0xFF);
-const APE::Color APE::KnownColor::PinkPantone = APE::Color(0xD7, 0x48, 0x94, 0xFF);
-const APE::Color APE::KnownColor::PinkLace = APE::Color(0xFF, 0xDD, 0xF4, 0xFF);
-const APE::Color APE::KnownColor::PinkLavender = APE::Color(0xD8, 0xB2, 0xD1, 0xFF);
-const APE::Color APE::KnownColor::PinkSherbet = APE::Color(0xF7, 0x8F, 0xA7, 0xFF);
-const APE::Color APE::KnownColor::Pistachio = APE::Color(0x93, 0xC5, 0x72, 0xFF);
-const APE::Color APE::KnownColor::Platinum = APE::Color(0xE5, 0xE4, 0xE2, 0xFF);
-const APE::Color APE::KnownColor::Plum = APE::Color(0x8E, 0x45, 0x85, 0xFF);
-const APE::Color APE::KnownColor::PlumWeb = APE::Color(0xDD, 0xA0, 0xDD, 0xFF);
-const APE::Color APE::KnownColor::PlumpPurple = APE::Color(0x59, 0x46, 0xB2, 0xFF);
-const APE::Color APE::KnownColor::PolishedPine = APE::Color(0x5D, 0xA4, 0x93, 0xFF);
-const APE::Color APE::KnownColor::PompAndPower = APE::Color(0x86, 0x60, 0x8E, 0xFF);
-const APE::Color APE::KnownColor::Popstar = APE::Color(0xBE, 0x4F, 0x62, 0xFF);
-const APE::Color APE::KnownColor::PortlandOrange = APE::Color(0xFF, 0x5A, 0x36, 0xFF);
-const APE::Color APE::KnownColor::PowderBlue = APE::Color(0xB0, 0xE0, 0xE6, 0xFF);
-const APE::Color APE::KnownColor::PrairieGold = APE::Color(0xE1, 0xCA, 0x7A, 0xFF);
-const APE::Color APE::KnownColor::PrincetonOrange = APE::Color(0xF5, 0x80, 0x25, 0xFF);
-const APE::Color APE::KnownColor::ProcessYellow = APE::Color(0xFF, 0xEF, 0x00, 0xFF);
-const APE::Color APE::KnownColor::Prune = APE::Color(0x70, 0x1C, 0x1C, 0xFF);
-const APE::Color APE::KnownColor::PrussianBlue = APE::Color(0x00, 0x31, 0x53, 0xFF);
-const APE::Color APE::KnownColor::PsychedelicPurple = APE::Color(0xDF, 0x00, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::Puce = APE::Color(0xCC, 0x88, 0x99, 0xFF);
-const APE::Color APE::KnownColor::PullmanBrownUpsBrown = APE::Color(0x64, 0x41, 0x17, 0xFF);
-const APE::Color APE::KnownColor::Pumpkin = APE::Color(0xFF, 0x75, 0x18, 0xFF);
-const APE::Color APE::KnownColor::Purple = APE::Color(0x6A, 0x0D, 0xAD, 0xFF);
-const APE::Color APE::KnownColor::PurpleWeb = APE::Color(0x80, 0x00, 0x80, 0xFF);
-const APE::Color APE::KnownColor::PurpleMunsell = APE::Color(0x9F, 0x00, 0xC5, 0xFF);
-const APE::Color APE::KnownColor::PurpleX11 = APE::Color(0xA0, 0x20, 0xF0, 0xFF);
-const APE::Color APE::KnownColor::PurpleMountainMajesty = APE::Color(0x96, 0x78, 0xB6, 0xFF);
-const APE::Color APE::KnownColor::PurpleNavy = APE::Color(0x4E, 0x51, 0x80, 0xFF);
-const APE::Color APE::KnownColor::PurplePizzazz = APE::Color(0xFE, 0x4E, 0xDA, 0xFF);
-const APE::Color APE::KnownColor::PurplePlum = APE::Color(0x9C, 0x51, 0xB6, 0xFF);
-const APE::Color APE::KnownColor::Purpureus = APE::Color(0x9A, 0x4E, 0xAE, 0xFF);
-const APE::Color APE::KnownColor::QueenBlue = APE::Color(0x43, 0x6B, 0x95, 0xFF);
-const APE::Color APE::KnownColor::QueenPink = APE::Color(0xE8, 0xCC, 0xD7, 0xFF);
-const APE::Color APE::KnownColor::QuickSilver = APE::Color(0xA6, 0xA6, 0xA6, 0xFF);
-const APE::Color APE::KnownColor::QuinacridoneMagenta = APE::Color(0x8E, 0x3A, 0x59, 0xFF);
-const APE::Color APE::KnownColor::RadicalRed = APE::Color(0xFF, 0x35, 0x5E, 0xFF);
-const APE::Color APE::KnownColor::RaisinBlack = APE::Color(0x24, 0x21, 0x24, 0xFF);
-const APE::Color APE::KnownColor::Rajah = APE::Color(0xFB, 0xAB, 0x60, 0xFF);
-const APE::Color APE::KnownColor::Raspberry = APE::Color(0xE3, 0x0B, 0x5D, 0xFF);
-const APE::Color APE::KnownColor::RaspberryGlace = APE::Color(0x91, 0x5F, 0x6D, 0xFF);
-const APE::Color APE::KnownColor::RaspberryRose = APE::Color(0xB3, 0x44, 0x6C, 0xFF);
-const APE::Color APE::KnownColor::RawSienna = APE::Color(0xD6, 0x8A, 0x59, 0xFF);
-const APE::Color APE::KnownColor::RawUmber = APE::Color(0x82, 0x66, 0x44, 0xFF);
-const APE::Color APE::KnownColor::RazzleDazzleRose = APE::Color(0xFF, 0x33, 0xCC, 0xFF);
-const APE::Color APE::KnownColor::Razzmatazz = APE::Color(0xE3, 0x25, 0x6B, 0xFF);
-const APE::Color APE::KnownColor::RazzmicBerry = APE::Color(0x8D, 0x4E, 0x85, 0xFF);
-const APE::Color APE::KnownColor::RebeccaPurple = APE::Color(0x66, 0x33, 0x99, 0xFF);
-const APE::Color APE::KnownColor::Red = APE::Color(0xFF, 0x00, 0x00, 0xFF);
-const APE::Color APE::KnownColor::RedCrayola = APE::Color(0xEE, 0x20, 0x4D, 0xFF);
-const APE::Color APE::KnownColor::RedMunsell = APE::Color(0xF2, 0x00, 0x3C, 0xFF);
-const APE::Color APE::KnownColor::RedNcs = APE::Color(0xC4, 0x02, 0x33, 0xFF);
-const APE::Color APE::KnownColor::RedPantone = APE::Color(0xED, 0x29, 0x39, 0xFF);
-const APE::Color APE::KnownColor::RedPigment = APE::Color(0xED, 0x1C, 0x24, 0xFF);
-const APE::Color APE::KnownColor::RedRyb = APE::Color(0xFE, 0x27, 0x12, 0xFF);
-const APE::Color APE::KnownColor::RedOrange = APE::Color(0xFF, 0x53, 0x49, 0xFF);
-const APE::Color APE::KnownColor::RedOrangeCrayola = APE::Color(0xFF, 0x68, 0x1F, 0xFF);
-const APE::Color APE::KnownColor::RedOrangeColorWheel = APE::Color(0xFF, 0x45, 0x00, 0xFF);
-const APE::Color APE::KnownColor::RedPurple = APE::Color(0xE4, 0x00, 0x78, 0xFF);
-const APE::Color APE::KnownColor::RedSalsa = APE::Color(0xFD, 0x3A, 0x4A, 0xFF);
-const APE::Color APE::KnownColor::RedViolet = APE::Color(0xC7, 0x15, 0x85, 0xFF);
-const APE::Color APE::KnownColor::RedVioletCrayola = APE::Color(0xC0, 0x44, 0x8F, 0xFF);
-const APE::Color APE::KnownColor::RedVioletColorWheel = APE::Color(0x92, 0x2B, 0x3E, 0xFF);
-const APE::Color APE::KnownColor::Redwood = APE::Color(0xA4, 0x5A, 0x52, 0xFF);
-const APE::Color APE::KnownColor::ResolutionBlue = APE::Color(0x00, 0x23, 0x87, 0xFF);
-const APE::Color APE::KnownColor::Rhythm = APE::Color(0x77, 0x76, 0x96, 0xFF);
-const APE::Color APE::KnownColor::RichBlack = APE::Color(0x00, 0x40, 0x40, 0xFF);
-const APE::Color APE::KnownColor::RichBlackFogra29 = APE::Color(0x01, 0x0B, 0x13, 0xFF);
-const APE::Color APE::KnownColor::RichBlackFogra39 = APE::Color(0x01, 0x02, 0x03, 0xFF);
-const APE::Color APE::KnownColor::RifleGreen = APE::Color(0x44, 0x4C, 0x38, 0xFF);
-const APE::Color APE::KnownColor::RobinEggBlue = APE::Color(0x00, 0xCC, 0xCC, 0xFF);
-const APE::Color APE::KnownColor::RocketMetallic = APE::Color(0x8A, 0x7F, 0x80, 0xFF);
-const APE::Color APE::KnownColor::RojoSpanishRed = APE::Color(0xA9, 0x11, 0x01, 0xFF);
-const APE::Color APE::KnownColor::RomanSilver = APE::Color(0x83, 0x89, 0x96, 0xFF);
-const APE::Color APE::KnownColor::Rose = APE::Color(0xFF, 0x00, 0x7F, 0xFF);
-const APE::Color APE::KnownColor::RoseBonbon = APE::Color(0xF9, 0x42, 0x9E, 0xFF);
-const APE::Color APE::KnownColor::RoseDust = APE::Color(0x9E, 0x5E, 0x6F, 0xFF);
-const APE::Color APE::KnownColor::RoseEbony = APE::Color(0x67, 0x48, 0x46, 0xFF);
-const APE::Color APE::KnownColor::RoseMadder = APE::Color(0xE3, 0x26, 0x36, 0xFF);
-const APE::Color APE::KnownColor::RosePink = APE::Color(0xFF, 0x66, 0xCC, 0xFF);
-const APE::Color APE::KnownColor::RosePompadour = APE::Color(0xED, 0x7A, 0x9B, 0xFF);
-const APE::Color APE::KnownColor::RoseRed = APE::Color(0xC2, 0x1E, 0x56, 0xFF);
-const APE::Color APE::KnownColor::RoseTaupe = APE::Color(0x90, 0x5D, 0x5D, 0xFF);
-const APE::Color APE::KnownColor::RoseVale = APE::Color(0xAB, 0x4E, 0x52, 0xFF);
-const APE::Color APE::KnownColor::Rosewood = APE::Color(0x65, 0x00, 0x0B, 0xFF);
-const APE::Color APE::KnownColor::RossoCorsa = APE::Color(0xD4, 0x00, 0x00, 0xFF);
-const APE::Color APE::KnownColor::RosyBrown = APE::Color(0xBC, 0x8F, 0x8F, 0xFF);
-const APE::Color APE::KnownColor::RoyalBlueDark = APE::Color(0x00, 0x23, 0x66, 0xFF);
-const APE::Color APE::KnownColor::RoyalBlueLight = APE::Color(0x41, 0x69, 0xE1, 0xFF);
-const APE::Color APE::KnownColor::RoyalPurple = APE::Color(0x78, 0x51, 0xA9, 0xFF);
-const APE::Color APE::KnownColor::RoyalYellow = APE::Color(0xFA, 0xDA, 0x5E, 0xFF);
-const APE::Color APE::KnownColor::Ruber = APE::Color(0xCE, 0x46, 0x76, 0xFF);
-const APE::Color APE::KnownColor::RubineRed = APE::Color(0xD1, 0x00, 0x56, 0xFF);
-const APE::Color APE::KnownColor::Ruby = APE::Color(0xE0, 0x11, 0x5F, 0xFF);
-const APE::Color APE::KnownColor::RubyRed = APE::Color(0x9B, 0x11, 0x1E, 0xFF);
-const APE::Color APE::KnownColor::Rufous = APE::Color(0xA8, 0x1C, 0x07, 0xFF);
-const APE::Color APE::KnownColor::Russet = APE::Color(0x80, 0x46, 0x1B, 0xFF);
-const APE::Color APE::KnownColor::RussianGreen = APE::Color(0x67, 0x92, 0x67, 0xFF);
-const APE::Color APE::KnownColor::RussianViolet = APE::Color(0x32, 0x17, 0x4D, 0xFF);
-const APE::Color APE::KnownColor::Rust = APE::Color(0xB7, 0x41, 0x0E, 0xFF);
-const APE::Color APE::KnownColor::RustyRed = APE::Color(0xDA, 0x2C, 0x43, 0xFF);
-const APE::Color APE::KnownColor::SacramentoStateGreen = APE::Color(0x04, 0x39, 0x27, 0xFF);
-const APE::Color APE::KnownColor::SaddleBrown = APE::Color(0x8B, 0x45, 0x13, 0xFF);
-const APE::Color APE::KnownColor::SafetyOrange = APE::Color(0xFF, 0x78, 0x00, 0xFF);
-const APE::Color APE::KnownColor::SafetyOrangeBlazeOrange = APE::Color(0xFF, 0x67, 0x00, 0xFF);
-const APE::Color APE::KnownColor::SafetyYellow = APE::Color(0xEE, 0xD2, 0x02, 0xFF);
-const APE::Color APE::KnownColor::Saffron = APE::Color(0xF4, 0xC4, 0x30, 0xFF);
-const APE::Color APE::KnownColor::Sage = APE::Color(0xBC, 0xB8, 0x8A, 0xFF);
-const APE::Color APE::KnownColor::StPatrickSBlue = APE::Color(0x23, 0x29, 0x7A, 0xFF);
-const APE::Color APE::KnownColor::Salmon = APE::Color(0xFA, 0x80, 0x72, 0xFF);
-const APE::Color APE::KnownColor::SalmonPink = APE::Color(0xFF, 0x91, 0xA4, 0xFF);
-const APE::Color APE::KnownColor::Sand = APE::Color(0xC2, 0xB2, 0x80, 0xFF);
-const APE::Color APE::KnownColor::SandDune = APE::Color(0x96, 0x71, 0x17, 0xFF);
-const APE::Color APE::KnownColor::SandyBrown = APE::Color(0xF4, 0xA4, 0x60, 0xFF);
-const APE::Color APE::KnownColor::SapGreen = APE::Color(0x50, 0x7D, 0x2A, 0xFF);
-const APE::Color APE::KnownColor::Sapphire = APE::Color(0x0F, 0x52, 0xBA, 0xFF);
-const APE::Color APE::KnownColor::SapphireBlue = APE::Color(0x00, 0x67, 0xA5, 0xFF);
-const APE::Color APE::KnownColor::SapphireCrayola = APE::Color(0x2D, 0x5D, 0xA1, 0xFF);
-const APE::Color APE::KnownColor::SatinSheenGold = APE::Color(0xCB, 0xA1, 0x35, 0xFF);
-const APE::Color APE::KnownColor::Scarlet = APE::Color(0xFF, 0x24, 0x00, 0xFF);
-const APE::Color APE::KnownColor::SchaussPink = APE::Color(0xFF, 0x91, 0xAF, 0xFF);
-const APE::Color APE::KnownColor::SchoolBusYellow = APE::Color(0xFF, 0xD8, 0x00, 0xFF);
-const APE::Color APE::KnownColor::ScreaminGreen = APE::Color(0x66, 0xFF, 0x66, 0xFF);
-const APE::Color APE::KnownColor::SeaGreen = APE::Color(0x2E, 0x8B, 0x57, 0xFF);
-const APE::Color APE::KnownColor::SeaGreenCrayola = APE::Color(0x00, 0xFF, 0xCD, 0xFF);
-const APE::Color APE::KnownColor::Seance = APE::Color(0x61, 0x20, 0x86, 0xFF);
-const APE::Color APE::KnownColor::SealBrown = APE::Color(0x59, 0x26, 0x0B, 0xFF);
-const APE::Color APE::KnownColor::Seashell = APE::Color(0xFF, 0xF5, 0xEE, 0xFF);
-const APE::Color APE::KnownColor::Secret = APE::Color(0x76, 0x43, 0x74, 0xFF);
-const APE::Color APE::KnownColor::SelectiveYellow = APE::Color(0xFF, 0xBA, 0x00, 0xFF);
-const APE::Color APE::KnownColor::Sepia = APE::Color(0x70, 0x42, 0x14, 0xFF);
-const APE::Color APE::KnownColor::Shadow = APE::Color(0x8A, 0x79, 0x5D, 0xFF);
-const APE::Color APE::KnownColor::ShadowBlue = APE::Color(0x77, 0x8B, 0xA5, 0xFF);
-const APE::Color APE::KnownColor::ShamrockGreen = APE::Color(0x00, 0x9E, 0x60, 0xFF);
-const APE::Color APE::KnownColor::SheenGreen = APE::Color(0x8F, 0xD4, 0x00, 0xFF);
-const APE::Color APE::KnownColor::ShimmeringBlush = APE::Color(0xD9, 0x86, 0x95, 0xFF);
-const APE::Color APE::KnownColor::ShinyShamrock = APE::Color(0x5F, 0xA7, 0x78, 0xFF);
-const APE::Color APE::KnownColor::ShockingPink = APE::Color(0xFC, 0x0F, 0xC0, 0xFF);
-const APE::Color APE::KnownColor::ShockingPinkCrayola = APE::Color(0xFF, 0x6F, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::Sienna = APE::Color(0x88, 0x2D, 0x17, 0xFF);
-const APE::Color APE::KnownColor::Silver = APE::Color(0xC0, 0xC0, 0xC0, 0xFF);
-const APE::Color APE::KnownColor::SilverCrayola = APE::Color(0xC9, 0xC0, 0xBB, 0xFF);
-const APE::Color APE::KnownColor::SilverMetallic = APE::Color(0xAA, 0xA9, 0xAD, 0xFF);
-const APE::Color APE::KnownColor::SilverChalice = APE::Color(0xAC, 0xAC, 0xAC, 0xFF);
-const APE::Color APE::KnownColor::SilverPink = APE::Color(0xC4, 0xAE, 0xAD, 0xFF);
-const APE::Color APE::KnownColor::SilverSand = APE::Color(0xBF, 0xC1, 0xC2, 0xFF);
-const APE::Color APE::KnownColor::Sinopia = APE::Color(0xCB, 0x41, 0x0B, 0xFF);
-const APE::Color APE::KnownColor::SizzlingRed = APE::Color(0xFF, 0x38, 0x55, 0xFF);
-const APE::Color APE::KnownColor::SizzlingSunrise = APE::Color(0xFF, 0xDB, 0x00, 0xFF);
-const APE::Color APE::KnownColor::Skobeloff = APE::Color(0x00, 0x74, 0x74, 0xFF);
-const APE::Color APE::KnownColor::SkyBlue = APE::Color(0x87, 0xCE, 0xEB, 0xFF);
-const APE::Color APE::KnownColor::SkyBlueCrayola = APE::Color(0x76, 0xD7, 0xEA, 0xFF);
-const APE::Color APE::KnownColor::SkyMagenta = APE::Color(0xCF, 0x71, 0xAF, 0xFF);
-const APE::Color APE::KnownColor::SlateBlue = APE::Color(0x6A, 0x5A, 0xCD, 0xFF);
-const APE::Color APE::KnownColor::SlateGray = APE::Color(0x70, 0x80, 0x90, 0xFF);
-const APE::Color APE::KnownColor::SlimyGreen = APE::Color(0x29, 0x96, 0x17, 0xFF);
-const APE::Color APE::KnownColor::Smitten = APE::Color(0xC8, 0x41, 0x86, 0xFF);
-const APE::Color APE::KnownColor::SmokyBlack = APE::Color(0x10, 0x0C, 0x08, 0xFF);
-const APE::Color APE::KnownColor::Snow = APE::Color(0xFF, 0xFA, 0xFA, 0xFF);
-const APE::Color APE::KnownColor::SolidPink = APE::Color(0x89, 0x38, 0x43, 0xFF);
-const APE::Color APE::KnownColor::SonicSilver = APE::Color(0x75, 0x75, 0x75, 0xFF);
-const APE::Color APE::KnownColor::SpaceCadet = APE::Color(0x1D, 0x29, 0x51, 0xFF);
-const APE::Color APE::KnownColor::SpanishBistre = APE::Color(0x80, 0x75, 0x32, 0xFF);
-const APE::Color APE::KnownColor::SpanishBlue = APE::Color(0x00, 0x70, 0xB8, 0xFF);
-const APE::Color APE::KnownColor::SpanishCarmine = APE::Color(0xD1, 0x00, 0x47, 0xFF);
-const APE::Color APE::KnownColor::SpanishGray = APE::Color(0x98, 0x98, 0x98, 0xFF);
-const APE::Color APE::KnownColor::SpanishGreen = APE::Color(0x00, 0x91, 0x50, 0xFF);
-const APE::Color APE::KnownColor::SpanishOrange = APE::Color(0xE8, 0x61, 0x00, 0xFF);
-const APE::Color APE::KnownColor::SpanishPink = APE::Color(0xF7, 0xBF, 0xBE, 0xFF);
-const APE::Color APE::KnownColor::SpanishRed = APE::Color(0xE6, 0x00, 0x26, 0xFF);
-const APE::Color APE::KnownColor::SpanishSkyBlue = APE::Color(0x00, 0xFF, 0xFE, 0xFF);
-const APE::Color APE::KnownColor::SpanishViolet = APE::Color(0x4C, 0x28, 0x82, 0xFF);
-const APE::Color APE::KnownColor::SpanishViridian = APE::Color(0x00, 0x7F, 0x5C, 0xFF);
-const APE::Color APE::KnownColor::SpringBud = APE::Color(0xA7, 0xFC, 0x00, 0xFF);
-const APE::Color APE::KnownColor::SpringFrost = APE::Color(0x87, 0xFF, 0x2A, 0xFF);
-const APE::Color APE::KnownColor::SpringGreen = APE::Color(0x00, 0xFF, 0x7F, 0xFF);
-const APE::Color APE::KnownColor::SpringGreenCrayola = APE::Color(0xEC, 0xEB, 0xBD, 0xFF);
-const APE::Color APE::KnownColor::StarCommandBlue = APE::Color(0x00, 0x7B, 0xB8, 0xFF);
-const APE::Color APE::KnownColor::SteelBlue = APE::Color(0x46, 0x82, 0xB4, 0xFF);
-const APE::Color APE::KnownColor::SteelPink = APE::Color(0xCC, 0x33, 0xCC, 0xFF);
-const APE::Color APE::KnownColor::StilDeGrainYellow = APE::Color(0xFA, 0xDA, 0x5E, 0xFF);
-const APE::Color APE::KnownColor::Straw = APE::Color(0xE4, 0xD9, 0x6F, 0xFF);
-const APE::Color APE::KnownColor::Strawberry = APE::Color(0xFA, 0x50, 0x53, 0xFF);
-const APE::Color APE::KnownColor::StrawberryBlonde = APE::Color(0xFF, 0x93, 0x61, 0xFF);
-const APE::Color APE::KnownColor::StrongLimeGreen = APE::Color(0x33, 0xCC, 0x33, 0xFF);
-const APE::Color APE::KnownColor::SugarPlum = APE::Color(0x91, 0x4E, 0x75, 0xFF);
-const APE::Color APE::KnownColor::Sunglow = APE::Color(0xFF, 0xCC, 0x33, 0xFF);
-const APE::Color APE::KnownColor::Sunray = APE::Color(0xE3, 0xAB, 0x57, 0xFF);
-const APE::Color APE::KnownColor::Sunset = APE::Color(0xFA, 0xD6, 0xA5, 0xFF);
-const APE::Color APE::KnownColor::SuperPink = APE::Color(0xCF, 0x6B, 0xA9, 0xFF);
-const APE::Color APE::KnownColor::SweetBrown = APE::Color(0xA8, 0x37, 0x31, 0xFF);
-const APE::Color APE::KnownColor::SyracuseOrange = APE::Color(0xD4, 0x45, 0x00, 0xFF);
-const APE::Color APE::KnownColor::Tan = APE::Color(0xD2, 0xB4, 0x8C, 0xFF);
-const APE::Color APE::KnownColor::TanCrayola = APE::Color(0xD9, 0x9A, 0x6C, 0xFF);
-const APE::Color APE::KnownColor::Tangerine = APE::Color(0xF2, 0x85, 0x00, 0xFF);
-const APE::Color APE::KnownColor::TangoPink = APE::Color(0xE4, 0x71, 0x7A, 0xFF);
-const APE::Color APE::KnownColor::TartOrange = APE::Color(0xFB, 0x4D, 0x46, 0xFF);
-const APE::Color APE::KnownColor::Taupe = APE::Color(0x48, 0x3C, 0x32, 0xFF);
-const APE::Color APE::KnownColor::TaupeGray = APE::Color(0x8B, 0x85, 0x89, 0xFF);
-const APE::Color APE::KnownColor::TeaGreen = APE::Color(0xD0, 0xF0, 0xC0, 0xFF);
-const APE::Color APE::KnownColor::TeaRose = APE::Color(0xF4, 0xC2, 0xC2, 0xFF);
-const APE::Color APE::KnownColor::Teal = APE::Color(0x00, 0x80, 0x80, 0xFF);
-const APE::Color APE::KnownColor::TealBlue = APE::Color(0x36, 0x75, 0x88, 0xFF);
-const APE::Color APE::KnownColor::Technobotanica = APE::Color(0x00, 0xFF, 0xBF, 0xFF);
-const APE::Color APE::KnownColor::Telemagenta = APE::Color(0xCF, 0x34, 0x76, 0xFF);
-const APE::Color APE::KnownColor::Tawny = APE::Color(0xCD, 0x57, 0x00, 0xFF);
-const APE::Color APE::KnownColor::TerraCotta = APE::Color(0xE2, 0x72, 0x5B, 0xFF);
-const APE::Color APE::KnownColor::Thistle = APE::Color(0xD8, 0xBF, 0xD8, 0xFF);
-const APE::Color APE::KnownColor::ThulianPink = APE::Color(0xDE, 0x6F, 0xA1, 0xFF);
-const APE::Color APE::KnownColor::TickleMePink = APE::Color(0xFC, 0x89, 0xAC, 0xFF);
-const APE::Color APE::KnownColor::TiffanyBlue = APE::Color(0x0A, 0xBA, 0xB5, 0xFF);
-const APE::Color APE::KnownColor::Timberwolf = APE::Color(0xDB, 0xD7, 0xD2, 0xFF);
-const APE::Color APE::KnownColor::TitaniumYellow = APE::Color(0xEE, 0xE6, 0x00, 0xFF);
-const APE::Color APE::KnownColor::Tomato = APE::Color(0xFF, 0x63, 0x47, 0xFF);
-const APE::Color APE::KnownColor::Tourmaline = APE::Color(0x86, 0xA1, 0xA9, 0xFF);
-const APE::Color APE::KnownColor::TropicalRainforest = APE::Color(0x00, 0x75, 0x5E, 0xFF);
-const APE::Color APE::KnownColor::TrueBlue = APE::Color(0x2D, 0x68, 0xC4, 0xFF);
-const APE::Color APE::KnownColor::TrypanBlue = APE::Color(0x1C, 0x05, 0xB3, 0xFF);
-const APE::Color APE::KnownColor::TuftsBlue = APE::Color(0x3E, 0x8E, 0xDE, 0xFF);
-const APE::Color APE::KnownColor::Tumbleweed = APE::Color(0xDE, 0xAA, 0x88, 0xFF);
-const APE::Color APE::KnownColor::Turquoise = APE::Color(0x40, 0xE0, 0xD0, 0xFF);
-const APE::Color APE::KnownColor::TurquoiseBlue = APE::Color(0x00, 0xFF, 0xEF, 0xFF);
-const APE::Color APE::KnownColor::TurquoiseGreen = APE::Color(0xA0, 0xD6, 0xB4, 0xFF);
-const APE::Color APE::KnownColor::TurtleGreen = APE::Color(0x8A, 0x9A, 0x5B, 0xFF);
-const APE::Color APE::KnownColor::Tuscan = APE::Color(0xFA, 0xD6, 0xA5, 0xFF);
-const APE::Color APE::KnownColor::TuscanBrown = APE::Color(0x6F, 0x4E, 0x37, 0xFF);
-const APE::Color APE::KnownColor::TuscanRed = APE::Color(0x7C, 0x48, 0x48, 0xFF);
-const APE::Color APE::KnownColor::TuscanTan = APE::Color(0xA6, 0x7B, 0x5B, 0xFF);
-const APE::Color APE::KnownColor::Tuscany = APE::Color(0xC0, 0x99, 0x99, 0xFF);
-const APE::Color APE::KnownColor::TwilightLavender = APE::Color(0x8A, 0x49, 0x6B, 0xFF);
-const APE::Color APE::KnownColor::TyrianPurple = APE::Color(0x66, 0x02, 0x3C, 0xFF);
-const APE::Color APE::KnownColor::UaBlue = APE::Color(0x00, 0x33, 0xAA, 0xFF);
-const APE::Color APE::KnownColor::UaRed = APE::Color(0xD9, 0x00, 0x4C, 0xFF);
-const APE::Color APE::KnownColor::Ultramarine = APE::Color(0x3F, 0x00, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::UltramarineBlue = APE::Color(0x41, 0x66, 0xF5, 0xFF);
-const APE::Color APE::KnownColor::UltraPink = APE::Color(0xFF, 0x6F, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::UltraRed = APE::Color(0xFC, 0x6C, 0x85, 0xFF);
-const APE::Color APE::KnownColor::Umber = APE::Color(0x63, 0x51, 0x47, 0xFF);
-const APE::Color APE::KnownColor::UnbleachedSilk = APE::Color(0xFF, 0xDD, 0xCA, 0xFF);
-const APE::Color APE::KnownColor::UnitedNationsBlue = APE::Color(0x00, 0x9E, 0xDB, 0xFF);
-const APE::Color APE::KnownColor::UniversityOfPennsylvaniaRed = APE::Color(0xA5, 0x00, 0x21, 0xFF);
-const APE::Color APE::KnownColor::UnmellowYellow = APE::Color(0xFF, 0xFF, 0x66, 0xFF);
-const APE::Color APE::KnownColor::UpForestGreen = APE::Color(0x01, 0x44, 0x21, 0xFF);
-const APE::Color APE::KnownColor::UpMaroon = APE::Color(0x7B, 0x11, 0x13, 0xFF);
-const APE::Color APE::KnownColor::UpsdellRed = APE::Color(0xAE, 0x20, 0x29, 0xFF);
-const APE::Color APE::KnownColor::UranianBlue = APE::Color(0xAF, 0xDB, 0xF5, 0xFF);
-const APE::Color APE::KnownColor::UsafaBlue = APE::Color(0x00, 0x4F, 0x98, 0xFF);
-const APE::Color APE::KnownColor::VanDykeBrown = APE::Color(0x66, 0x42, 0x28, 0xFF);
-const APE::Color APE::KnownColor::Vanilla = APE::Color(0xF3, 0xE5, 0xAB, 0xFF);
-const APE::Color APE::KnownColor::VanillaIce = APE::Color(0xF3, 0x8F, 0xA9, 0xFF);
-const APE::Color APE::KnownColor::VegasGold = APE::Color(0xC5, 0xB3, 0x58, 0xFF);
-const APE::Color APE::KnownColor::VenetianRed = APE::Color(0xC8, 0x08, 0x15, 0xFF);
-const APE::Color APE::KnownColor::Verdigris = APE::Color(0x43, 0xB3, 0xAE, 0xFF);
-const APE::Color APE::KnownColor::Vermilion = APE::Color(0xE3, 0x42, 0x34, 0xFF);
-const APE::Color APE::KnownColor::Veronica = APE::Color(0xA0, 0x20, 0xF0, 0xFF);
-const APE::Color APE::KnownColor::Violet = APE::Color(0x8F, 0x00, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::VioletColorWheel = APE::Color(0x7F, 0x00, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::VioletCrayola = APE::Color(0x96, 0x3D, 0x7F, 0xFF);
-const APE::Color APE::KnownColor::VioletRyb = APE::Color(0x86, 0x01, 0xAF, 0xFF);
-const APE::Color APE::KnownColor::VioletWeb = APE::Color(0xEE, 0x82, 0xEE, 0xFF);
-const APE::Color APE::KnownColor::VioletBlue = APE::Color(0x32, 0x4A, 0xB2, 0xFF);
-const APE::Color APE::KnownColor::VioletBlueCrayola = APE::Color(0x76, 0x6E, 0xC8, 0xFF);
-const APE::Color APE::KnownColor::VioletRed = APE::Color(0xF7, 0x53, 0x94, 0xFF);
-const APE::Color APE::KnownColor::VioletRedPerbang = APE::Color(0xF0, 0x59, 0x9C, 0xFF);
-const APE::Color APE::KnownColor::Viridian = APE::Color(0x40, 0x82, 0x6D, 0xFF);
-const APE::Color APE::KnownColor::ViridianGreen = APE::Color(0x00, 0x96, 0x98, 0xFF);
-const APE::Color APE::KnownColor::VividBurgundy = APE::Color(0x9F, 0x1D, 0x35, 0xFF);
-const APE::Color APE::KnownColor::VividSkyBlue = APE::Color(0x00, 0xCC, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::VividTangerine = APE::Color(0xFF, 0xA0, 0x89, 0xFF);
-const APE::Color APE::KnownColor::VividViolet = APE::Color(0x9F, 0x00, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::Volt = APE::Color(0xCE, 0xFF, 0x00, 0xFF);
-const APE::Color APE::KnownColor::WarmBlack = APE::Color(0x00, 0x42, 0x42, 0xFF);
-const APE::Color APE::KnownColor::WeezyBlue = APE::Color(0x18, 0x9B, 0xCC, 0xFF);
-const APE::Color APE::KnownColor::Wheat = APE::Color(0xF5, 0xDE, 0xB3, 0xFF);
-const APE::Color APE::KnownColor::White = APE::Color(0xFF, 0xFF, 0xFF, 0xFF);
-const APE::Color APE::KnownColor::WildBlueYonder = APE::Color(0xA2, 0xAD, 0xD0, 0xFF);
-const APE::Color APE::KnownColor::WildOrchid = APE::Color(0xD4, 0x70, 0xA2, 0xFF);
-const APE::Color APE::KnownColor::WildStrawberry = APE::Color(0xFF, 0x43, 0xA4, 0xFF);
-const APE::Color APE::KnownColor::WildWatermelon = APE::Color(0xFC, 0x6C, 0x85, 0xFF);
-const APE::Color APE::KnownColor::WindsorTan = APE::Color(0xA7, 0x55, 0x02, 0xFF);
-const APE::Color APE::KnownColor::Wine = APE::Color(0x72, 0x2F, 0x37, 0xFF);
-const APE::Color APE::KnownColor::WineDregs = APE::Color(0x67, 0x31, 0x47, 0xFF);
-const APE::Color APE::KnownColor::WinterSky = APE::Color(0xFF, 0x00, 0x7C, 0xFF);
-const APE::Color APE::KnownColor::WintergreenDream = APE::Color(0x56, 0x88, 0x7D, 0xFF);
-const APE::Color APE::KnownColor::Wisteria = APE::Color(0xC9, 0xA0, 0xDC, 0xFF);
-const APE::Color APE::KnownColor::WoodBrown = APE::Color(0xC1, 0x9A, 0x6B, 0xFF);
-const APE::Color APE::KnownColor::Xanadu = APE::Color(0x73, 0x86, 0x78, 0xFF);
-const APE::Color APE::KnownColor::Xanthic = APE::Color(0xEE, 0xED, 0x09, 0xFF);
-const APE::Color APE::KnownColor::Xanthous = APE::Color(0xF1, 0xB4, 0x2F, 0xFF);
-const APE::Color APE::KnownColor::YaleBlue = APE::Color(0x00, 0x35, 0x6B, 0xFF);
-const APE::Color APE::KnownColor::Yellow = APE::Color(0xFF, 0xFF, 0x00, 0xFF);
-const APE::Color APE::KnownColor::YellowCrayola = APE::Color(0xFC, 0xE8, 0x83, 0xFF);
-const APE::Color APE::KnownColor::YellowMunsell = APE::Color(0xEF, 0xCC, 0x00, 0xFF);
-const APE::Color APE::KnownColor::YellowNcs = APE::Color(0xFF, 0xD3, 0x00, 0xFF);
-const APE::Color APE::KnownColor::YellowPantone = APE::Color(0xFE, 0xDF, 0x00, 0xFF);
-const APE::Color APE::KnownColor::YellowProcess = APE::Color(0xFF, 0xEF, 0x00, 0xFF);
-const APE::Color APE::KnownColor::YellowRyb = APE::Color(0xFE, 0xFE, 0x33, 0xFF);
-const APE::Color APE::KnownColor::YellowGreen = APE::Color(0x9A, 0xCD, 0x32, 0xFF);
-const APE::Color APE::KnownColor::YellowGreenCrayola = APE::Color(0xC5, 0xE3, 0x84, 0xFF);
-const APE::Color APE::KnownColor::YellowGreenColorWheel = APE::Color(0x30, 0xB2, 0x1A, 0xFF);
-const APE::Color APE::KnownColor::YellowOrange = APE::Color(0xFF, 0xAE, 0x42, 0xFF);
-const APE::Color APE::KnownColor::YellowOrangeColorWheel = APE::Color(0xFF, 0x95, 0x05, 0xFF);
-const APE::Color APE::KnownColor::YellowSunshine = APE::Color(0xFF, 0xF7, 0x00, 0xFF);
-const APE::Color APE::KnownColor::YinmnBlue = APE::Color(0x2E, 0x50, 0x90, 0xFF);
-const APE::Color APE::KnownColor::Zaffre = APE::Color(0x00, 0x14, 0xA8, 0xFF);
-const APE::Color APE::KnownColor::ZinnwalditeBrown = APE::Color(0x2C, 0x16, 0x08, 0xFF);
-const APE::Color APE::KnownColor::Zomp = APE::Color(0x39, 0xA7, 0x8E, 0xFF);
\ No newline at end of file
+void APE::Color::LerpSpan(const APE::Color* a, const APE::Color* b, float t, APE::Color* out, std::size_t count) {
+    LerpColorSpan(a, b, 1, GetLerpWeight(t), out, count);
+}
+void APE::Color::LerpSpan(const APE::Color* colors, const APE::Color& target, float t, APE::Color* out, std::size_t count) {
+    LerpColorSpan(colors, &target, 0, GetLerpWeight(t), out, count);
+}
+void APE::Color::LightenSpan(const APE::Color* colors, float percent, APE::Color* out, std::size_t count) {
+    LerpSpan(colors, Color(255), percent * 0.01f, out, count);
+}
+void APE::Color::DarkenSpan(const APE::Color* colors, float percent, APE::Color* out, std::size_t count) {
+    LerpSpan(colors, Color(0, 255), percent * 0.01f, out, count);
+}
+void APE::Color::PremultiplySpan(const APE::Color* colors, APE::Color* out, std::size_t count) {
+    switch (GetColorKernel()) {
+    case ColorKernel::AVX2: PremultiplyColorSpanAVX2(colors, out, count); break;
+    case ColorKernel::SSE2: PremultiplyColorSpanSSE2(colors, out, count); break;
+    default: PremultiplyColorSpanScalar(colors, out, count); break;
+    }
+}
+
+//* --- APE::Color span kernels ---
+
+void APE::LerpColorSpanScalar(const APE::Color* a, const APE::Color* b, std::size_t bStep, unsigned weight, APE::Color* out, std::size_t count) {
+    for (std::size_t i = 0; i < count; i++)
+        out[i] = LerpColor(a[i], b[i * bStep], weight);
+}
+
+void APE::PremultiplyColorSpanScalar(const APE::Color* colors, APE::Color* out, std::size_t count) {
+    for (std::size_t i = 0; i < count; i++)
+        out[i] = colors[i].Premultiply();
+}
+
+#ifdef APE_COLOR_SSE2
+// The colors are unpacked to 16-bit channels, two colors per half, where every product fit.
+static __m128i LerpChannelsSSE2(__m128i a, __m128i b, __m128i weightA, __m128i weightB) {
+    __m128i sum = _mm_add_epi16(_mm_mullo_epi16(a, weightA), _mm_mullo_epi16(b, weightB));
+    return _mm_srli_epi16(_mm_add_epi16(sum, _mm_set1_epi16(128)), 8);
+}
+
+void APE::LerpColorSpanSSE2(const APE::Color* a, const APE::Color* b, std::size_t bStep, unsigned weight, APE::Color* out, std::size_t count) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i weightA = _mm_set1_epi16(static_cast<short>(256 - weight)), weightB = _mm_set1_epi16(static_cast<short>(weight));
+    int32_t target;
+    std::memcpy(&target, b, sizeof(target));
+    __m128i bv = _mm_set1_epi32(target);
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i av = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        if (bStep) bv = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        __m128i low = LerpChannelsSSE2(_mm_unpacklo_epi8(av, zero), _mm_unpacklo_epi8(bv, zero), weightA, weightB);
+        __m128i high = LerpChannelsSSE2(_mm_unpackhi_epi8(av, zero), _mm_unpackhi_epi8(bv, zero), weightA, weightB);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(low, high));
+    }
+    LerpColorSpanScalar(a + i, b + i * bStep, bStep, weight, out + i, count - i);
+}
+
+void APE::PremultiplyColorSpanSSE2(const APE::Color* colors, APE::Color* out, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(colors + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), PremultiplyColorsSSE2(v));
+    }
+    PremultiplyColorSpanScalar(colors + i, out + i, count - i);
+}
+#else
+void APE::LerpColorSpanSSE2(const APE::Color* a, const APE::Color* b, std::size_t bStep, unsigned weight, APE::Color* out, std::size_t count) {
+    LerpColorSpanScalar(a, b, bStep, weight, out, count);
+}
+
+void APE::PremultiplyColorSpanSSE2(const APE::Color* colors, APE::Color* out, std::size_t count) {
+    PremultiplyColorSpanScalar(colors, out, count);
+}
+#endif
+
+//* --- APE::KnownColor ---
+
+bool APE::KnownColor::TryParse(std::string_view name, APE::Color& color) {
+    std::uint64_t hash = HashName(name);
+    std::uint16_t seed = KnownColorsHash.Seeds[GetBucket(hash)];
+    if (seed == 0) return false;
+    std::uint16_t index = KnownColorsHash.Slots[GetSlot(hash, seed)];
+    if (index == EmptySlot || !IsSameName(KnownColors[index].Name, name)) return false;
+    color = KnownColors[index].Value;
+    return true;
+}
+
+std::string_view APE::KnownColor::GetNearestName(const APE::Color& color) {
+    std::size_t nearest = 0;
+    int nearestDistance = -1;
+    for (std::size_t i = 0; i < KnownColorsCount; i++) {
+        const APE::Color& known = KnownColors[i].Value;
+        int red = (int)known.Red - color.Red, green = (int)known.Green - color.Green, blue = (int)known.Blue - color.Blue;
+        int distance = red*red + green*green + blue*blue;
+        if (nearestDistance < 0 || distance < nearestDistance) {
+            nearest = i;
+            nearestDistance = distance;
+            if (distance == 0) break;
+        }
+    }
+    return KnownColors[nearest].Name;
+}
+
+std::size_t APE::KnownColor::Count() { return KnownColorsCount; }
@@ -0,0 +1,384 @@
+#include "APE/APE_ColorSpace.h"
+#include "APE_Color_Span.h"
+
+#include <cmath>
+#include <cstring>
+
+#ifdef APE_COLOR_SSE2
+#include <xmmintrin.h>
+#endif
+
+// The HSV, HSL and OKLab conversions of APE::Color. The SSE2 kernels convert 4 colors at a time, with the
+// channels transposed to one register per channel, and do the same float operations in the same order as the
+// scalar ones, so both give the same result.
+
+namespace {
+    static_assert(sizeof(APE::HSVColor) == 16 && sizeof(APE::HSLColor) == 16 && sizeof(APE::OKLabColor) == 16,
+                  "The SIMD kernels load the HSV, HSL and OKLab colors as 4 packed floats!");
+
+    const float ChannelScale = 1.0f / 255.0f;
+    const float LinearScale = 1.0f / 65535.0f;
+    const float OneThird = 1.0f / 3.0f;
+    // The initial guess of the cube root, added to a third of the float bits.
+    const int32_t CbrtMagic = 709921077;
+    // The OKLab conversions work on linear colors, a chunk at a time.
+    const std::size_t ChunkSize = 256;
+
+    // Same selection as the SSE2 min and max instructions.
+    float Min(float a, float b) { return a < b ? a : b; }
+    float Max(float a, float b) { return a > b ? a : b; }
+    float ClampUnit(float x) { return Min(Max(x, 0.0f), 1.0f); }
+
+    uint8_t ToChannel(float x) { return static_cast<uint8_t>(static_cast<int>(ClampUnit(x) * 255.0f + 0.5f)); }
+    uint16_t ToLinearChannel(float x) { return static_cast<uint16_t>(static_cast<int>(ClampUnit(x) * 65535.0f + 0.5f)); }
+
+    // Wrap x to [0->period).
+    float Wrap(float x, float period, float inversePeriod) { return x - period * std::floor(x * inversePeriod); }
+
+    float Cbrt(float x) {
+        x = Max(x, 0.0f);
+        int32_t bits;
+        std::memcpy(&bits, &x, sizeof(bits));
+        bits = static_cast<int32_t>(static_cast<float>(bits) * OneThird) + CbrtMagic;
+        float y;
+        std::memcpy(&y, &bits, sizeof(y));
+        for (int i = 0; i < 3; i++)
+            y = (y + y + x / (y * y)) * OneThird;
+        return y;
+    }
+
+    float GetHue(float r, float g, float b, float max, float delta) {
+        float d = delta > 0.0f ? delta : 1.0f;
+        float h = max == r ? (g - b) / d : (max == g ? (b - r) / d + 2.0f : (r - g) / d + 4.0f);
+        h = h * 60.0f;
+        return h + (h < 0.0f ? 360.0f : 0.0f);
+    }
+
+    APE::HSVColor ToHSVColor(const APE::Color& color) {
+        float r = color.Red * ChannelScale, g = color.Green * ChannelScale, b = color.Blue * ChannelScale;
+        float max = Max(Max(r, g), b), min = Min(Min(r, g), b), delta = max - min;
+        return APE::HSVColor(GetHue(r, g, b, max, delta), delta / (max > 0.0f ? max : 1.0f), max, color.Alpha * ChannelScale);
+    }
+
+    APE::HSLColor ToHSLColor(const APE::Color& color) {
+        float r = color.Red * ChannelScale, g = color.Green * ChannelScale, b = color.Blue * ChannelScale;
+        float max = Max(Max(r, g), b), min = Min(Min(r, g), b), delta = max - min;
+        float sum = max + min, divisor = 1.0f - std::fabs(sum - 1.0f);
+        return APE::HSLColor(GetHue(r, g, b, max, delta), delta / (divisor > 0.0f ? divisor : 1.0f), sum * 0.5f, color.Alpha * ChannelScale);
+    }
+
+    // f(n) = v - v * s * max(0, min(k, 4 - k, 1)), with k = (n + h / 60) mod 6.
+    float GetHSVChannel(float n, float h, float v, float c) {
+        float k = Wrap(n + h, 6.0f, 1.0f / 6.0f);
+        return v - c * Max(Min(Min(k, 4.0f - k), 1.0f), 0.0f);
+    }
+
+    APE::Color FromHSVColor(const APE::HSVColor& color) {
+        float h = color.Hue * (1.0f / 60.0f), v = ClampUnit(color.Value), c = v * ClampUnit(color.Saturation);
+        return APE::Color(ToChannel(GetHSVChannel(5.0f, h, v, c)), ToChannel(GetHSVChannel(3.0f, h, v, c)),
+                          ToChannel(GetHSVChannel(1.0f, h, v, c)), ToChannel(color.Alpha));
+    }
+
+    // f(n) = l - s * min(l, 1 - l) * max(-1, min(k - 3, 9 - k, 1)), with k = (n + h / 30) mod 12.
+    float GetHSLChannel(float n, float h, float l, float a) {
+        float k = Wrap(n + h, 12.0f, 1.0f / 12.0f);
+        return l - a * Max(Min(Min(k - 3.0f, 9.0f - k), 1.0f), -1.0f);
+    }
+
+    APE::Color FromHSLColor(const APE::HSLColor& color) {
+        float h = color.Hue * (1.0f / 30.0f), l = ClampUnit(color.Lightness), a = ClampUnit(color.Saturation) * Min(l, 1.0f - l);
+        return APE::Color(ToChannel(GetHSLChannel(0.0f, h, l, a)), ToChannel(GetHSLChannel(8.0f, h, l, a)),
+                          ToChannel(GetHSLChannel(4.0f, h, l, a)), ToChannel(color.Alpha));
+    }
+
+    // The OKLab matrices of Björn Ottosson, from linear sRGB to the cone responses then to OKLab.
+    APE::OKLabColor ToOKLabColor(const APE::LinearColor& color) {
+        float r = color.Red * LinearScale, g = color.Green * LinearScale, b = color.Blue * LinearScale;
+        float l = Cbrt(0.4122214708f * r + 0.5363325363f * g + 0.0514459929f * b);
+        float m = Cbrt(0.2119034982f * r + 0.6806995451f * g + 0.1073969566f * b);
+        float s = Cbrt(0.0883024619f * r + 0.2817188376f * g + 0.6299787005f * b);
+        return APE::OKLabColor(0.2104542553f * l + 0.7936178050f * m + -0.0040720468f * s,
+                               1.9779984951f * l + -2.4285922050f * m + 0.4505937099f * s,
+                               0.0259040371f * l + 0.7827717662f * m + -0.8086757660f * s, color.Alpha * LinearScale);
+    }
+
+    APE::LinearColor FromOKLabColor(const APE::OKLabColor& color) {
+        float l = color.Lightness + 0.3963377774f * color.A + 0.2158037573f * color.B;
+        float m = color.Lightness + -0.1055613458f * color.A + -0.0638541728f * color.B;
+        float s = color.Lightness + -0.0894841775f * color.A + -1.2914855480f * color.B;
+        l = l * l * l;
+        m = m * m * m;
+        s = s * s * s;
+        return APE::LinearColor(ToLinearChannel(4.0767416621f * l + -3.3077115913f * m + 0.2309699292f * s),
+                                ToLinearChannel(-1.2684380046f * l + 2.6097574011f * m + -0.3413193965f * s),
+                                ToLinearChannel(-0.0041960863f * l + -0.7034186147f * m + 1.7076147010f * s),
+                                ToLinearChannel(color.Alpha));
+    }
+
+#ifdef APE_COLOR_SSE2
+    bool UseSSE2() { return APE::GetColorKernel() != APE::ColorKernel::Scalar; }
+
+    __m128 Select(__m128 mask, __m128 a, __m128 b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+    __m128 ClampUnitSSE2(__m128 x) { return _mm_min_ps(_mm_max_ps(x, _mm_setzero_ps()), _mm_set1_ps(1.0f)); }
+
+    __m128 FloorSSE2(__m128 x) {
+        __m128 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));
+        return _mm_sub_ps(t, _mm_and_ps(_mm_cmpgt_ps(t, x), _mm_set1_ps(1.0f)));
+    }
+
+    __m128 WrapSSE2(__m128 x, float period, float inversePeriod) {
+        return _mm_sub_ps(x, _mm_mul_ps(_mm_set1_ps(period), FloorSSE2(_mm_mul_ps(x, _mm_set1_ps(inversePeriod)))));
+    }
+
+    __m128 CbrtSSE2(__m128 x) {
+        const __m128 third = _mm_set1_ps(OneThird);
+        x = _mm_max_ps(x, _mm_setzero_ps());
+        __m128i bits = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(_mm_castps_si128(x)), third));
+        __m128 y = _mm_castsi128_ps(_mm_add_epi32(bits, _mm_set1_epi32(CbrtMagic)));
+        for (int i = 0; i < 3; i++)
+            y = _mm_mul_ps(_mm_add_ps(_mm_add_ps(y, y), _mm_div_ps(x, _mm_mul_ps(y, y))), third);
+        return y;
+    }
+
+    // Load 4 colors, with a register per channel (in range [0->255]).
+    void LoadColorsSSE2(const APE::Color* colors, __m128& r, __m128& g, __m128& b, __m128& a) {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(colors));
+        __m128i low = _mm_unpacklo_epi8(v, zero), high = _mm_unpackhi_epi8(v, zero);
+        r = _mm_cvtepi32_ps(_mm_unpacklo_epi16(low, zero));
+        g = _mm_cvtepi32_ps(_mm_unpackhi_epi16(low, zero));
+        b = _mm_cvtepi32_ps(_mm_unpacklo_epi16(high, zero));
+        a = _mm_cvtepi32_ps(_mm_unpackhi_epi16(high, zero));
+        _MM_TRANSPOSE4_PS(r, g, b, a);
+    }
+
+    // Store 4 colors from a register per channel (in range [0->1], clamped).
+    void StoreColorsSSE2(APE::Color* colors, __m128 r, __m128 g, __m128 b, __m128 a) {
+        const __m128 scale = _mm_set1_ps(255.0f), half = _mm_set1_ps(0.5f);
+        r = _mm_add_ps(_mm_mul_ps(ClampUnitSSE2(r), scale), half);
+        g = _mm_add_ps(_mm_mul_ps(ClampUnitSSE2(g), scale), half);
+        b = _mm_add_ps(_mm_mul_ps(ClampUnitSSE2(b), scale), half);
+        a = _mm_add_ps(_mm_mul_ps(ClampUnitSSE2(a), scale), half);
+        _MM_TRANSPOSE4_PS(r, g, b, a);
+        __m128i low = _mm_packs_epi32(_mm_cvttps_epi32(r), _mm_cvttps_epi32(g));
+        __m128i high = _mm_packs_epi32(_mm_cvttps_epi32(b), _mm_cvttps_epi32(a));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(colors), _mm_packus_epi16(low, high));
+    }
+
+    void LoadLinearColorsSSE2(const APE::LinearColor* colors, __m128& r, __m128& g, __m128& b, __m128& a) {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(colors));
+        __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(colors + 2));
+        r = _mm_cvtepi32_ps(_mm_unpacklo_epi16(first, zero));
+        g = _mm_cvtepi32_ps(_mm_unpackhi_epi16(first, zero));
+        b = _mm_cvtepi32_ps(_mm_unpacklo_epi16(second, zero));
+        a = _mm_cvtepi32_ps(_mm_unpackhi_epi16(second, zero));
+        _MM_TRANSPOSE4_PS(r, g, b, a);
+    }
+
+    // The 16-bit values are sign extended, so the signed saturation of the pack keep them.
+    __m128i ToLinearChannelsSSE2(__m128 x) {
+        x = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(65535.0f)), _mm_set1_ps(0.5f));
+        return _mm_srai_epi32(_mm_slli_epi32(_mm_cvttps_epi32(x), 16), 16);
+    }
+
+    void StoreLinearColorsSSE2(APE::LinearColor* colors, __m128 r, __m128 g, __m128 b, __m128 a) {
+        r = ClampUnitSSE2(r);
+        g = ClampUnitSSE2(g);
+        b = ClampUnitSSE2(b);
+        a = ClampUnitSSE2(a);
+        _MM_TRANSPOSE4_PS(r, g, b, a);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(colors), _mm_packs_epi32(ToLinearChannelsSSE2(r), ToLinearChannelsSSE2(g)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(colors + 2), _mm_packs_epi32(ToLinearChannelsSSE2(b), ToLinearChannelsSSE2(a)));
+    }
+
+    // Load or store 4 colors of 4 floats (HSV, HSL or OKLab), with a register per value.
+    template<typename T>
+    void LoadFloatColorsSSE2(const T* colors, __m128& x, __m128& y, __m128& z, __m128& w) {
+        const float* values = reinterpret_cast<const float*>(colors);
+        x = _mm_loadu_ps(values);
+        y = _mm_loadu_ps(values + 4);
+        z = _mm_loadu_ps(values + 8);
+        w = _mm_loadu_ps(values + 12);
+        _MM_TRANSPOSE4_PS(x, y, z, w);
+    }
+
+    template<typename T>
+    void StoreFloatColorsSSE2(T* colors, __m128 x, __m128 y, __m128 z, __m128 w) {
+        float* values = reinterpret_cast<float*>(colors);
+        _MM_TRANSPOSE4_PS(x, y, z, w);
+        _mm_storeu_ps(values, x);
+        _mm_storeu_ps(values + 4, y);
+        _mm_storeu_ps(values + 8, z);
+        _mm_storeu_ps(values + 12, w);
+    }
+
+    __m128 GetHueSSE2(__m128 r, __m128 g, __m128 b, __m128 max, __m128 delta) {
+        __m128 d = Select(_mm_cmpgt_ps(delta, _mm_setzero_ps()), delta, _mm_set1_ps(1.0f));
+        __m128 hr = _mm_div_ps(_mm_sub_ps(g, b), d);
+        __m128 hg = _mm_add_ps(_mm_div_ps(_mm_sub_ps(b, r), d), _mm_set1_ps(2.0f));
+        __m128 hb = _mm_add_ps(_mm_div_ps(_mm_sub_ps(r, g), d), _mm_set1_ps(4.0f));
+        __m128 h = Select(_mm_cmpeq_ps(max, r), hr, Select(_mm_cmpeq_ps(max, g), hg, hb));
+        h = _mm_mul_ps(h, _mm_set1_ps(60.0f));
+        return _mm_add_ps(h, _mm_and_ps(_mm_cmplt_ps(h, _mm_setzero_ps()), _mm_set1_ps(360.0f)));
+    }
+
+    void ToHSVColorsSSE2(const APE::Color* colors, APE::HSVColor* out) {
+        const __m128 scale = _mm_set1_ps(ChannelScale), one = _mm_set1_ps(1.0f);
+        __m128 r, g, b, a;
+        LoadColorsSSE2(colors, r, g, b, a);
+        r = _mm_mul_ps(r, scale);
+        g = _mm_mul_ps(g, scale);
+        b = _mm_mul_ps(b, scale);
+        __m128 max = _mm_max_ps(_mm_max_ps(r, g), b), min = _mm_min_ps(_mm_min_ps(r, g), b), delta = _mm_sub_ps(max, min);
+        __m128 s = _mm_div_ps(delta, Select(_mm_cmpgt_ps(max, _mm_setzero_ps()), max, one));
+        StoreFloatColorsSSE2(out, GetHueSSE2(r, g, b, max, delta), s, max, _mm_mul_ps(a, scale));
+    }
+
+    void ToHSLColorsSSE2(const APE::Color* colors, APE::HSLColor* out) {
+        const __m128 scale = _mm_set1_ps(ChannelScale), one = _mm_set1_ps(1.0f);
+        __m128 r, g, b, a;
+        LoadColorsSSE2(colors, r, g, b, a);
+        r = _mm_mul_ps(r, scale);
+        g = _mm_mul_ps(g, scale);
+        b = _mm_mul_ps(b, scale);
+        __m128 max = _mm_max_ps(_mm_max_ps(r, g), b), min = _mm_min_ps(_mm_min_ps(r, g), b), delta = _mm_sub_ps(max, min);
+        __m128 sum = _mm_add_ps(max, min);
+        __m128 divisor = _mm_sub_ps(one, _mm_andnot_ps(_mm_set1_ps(-0.0f), _mm_sub_ps(sum, one)));
+        __m128 s = _mm_div_ps(delta, Select(_mm_cmpgt_ps(divisor, _mm_setzero_ps()), divisor, one));
+        StoreFloatColorsSSE2(out, GetHueSSE2(r, g, b, max, delta), s, _mm_mul_ps(sum, _mm_set1_ps(0.5f)), _mm_mul_ps(a, scale));
+    }
+
+    __m128 GetHSVChannelsSSE2(float n, __m128 h, __m128 v, __m128 c) {
+        __m128 k = WrapSSE2(_mm_add_ps(_mm_set1_ps(n), h), 6.0f, 1.0f / 6.0f);
+        __m128 w = _mm_min_ps(_mm_min_ps(k, _mm_sub_ps(_mm_set1_ps(4.0f), k)), _mm_set1_ps(1.0f));
+        return _mm_sub_ps(v, _mm_mul_ps(c, _mm_max_ps(w, _mm_setzero_ps())));
+    }
+
+    void FromHSVColorsSSE2(const APE::HSVColor* colors, APE::Color* out) {
+        __m128 h, s, v, a;
+        LoadFloatColorsSSE2(colors, h, s, v, a);
+        h = _mm_mul_ps(h, _mm_set1_ps(1.0f / 60.0f));
+        v = ClampUnitSSE2(v);
+        __m128 c = _mm_mul_ps(v, ClampUnitSSE2(s));
+        StoreColorsSSE2(out, GetHSVChannelsSSE2(5.0f, h, v, c), GetHSVChannelsSSE2(3.0f, h, v, c), GetHSVChannelsSSE2(1.0f, h, v, c), a);
+    }
+
+    __m128 GetHSLChannelsSSE2(float n, __m128 h, __m128 l, __m128 a) {
+        __m128 k = WrapSSE2(_mm_add_ps(_mm_set1_ps(n), h), 12.0f, 1.0f / 12.0f);
+        __m128 w = _mm_min_ps(_mm_min_ps(_mm_sub_ps(k, _mm_set1_ps(3.0f)), _mm_sub_ps(_mm_set1_ps(9.0f), k)), _mm_set1_ps(1.0f));
+        return _mm_sub_ps(l, _mm_mul_ps(a, _mm_max_ps(w, _mm_set1_ps(-1.0f))));
+    }
+
+    void FromHSLColorsSSE2(const APE::HSLColor* colors, APE::Color* out) {
+        __m128 h, s, l, alpha;
+        LoadFloatColorsSSE2(colors, h, s, l, alpha);
+        h = _mm_mul_ps(h, _mm_set1_ps(1.0f / 30.0f));
+        l = ClampUnitSSE2(l);
+        __m128 a = _mm_mul_ps(ClampUnitSSE2(s), _mm_min_ps(l, _mm_sub_ps(_mm_set1_ps(1.0f), l)));
+        StoreColorsSSE2(out, GetHSLChannelsSSE2(0.0f, h, l, a), GetHSLChannelsSSE2(8.0f, h, l, a), GetHSLChannelsSSE2(4.0f, h, l, a), alpha);
+    }
+
+    // c0 * x + c1 * y + c2 * z, in the same order as the scalar expressions.
+    __m128 Dot(float c0, __m128 x, float c1, __m128 y, float c2, __m128 z) {
+        return _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(c0), x), _mm_mul_ps(_mm_set1_ps(c1), y)), _mm_mul_ps(_mm_set1_ps(c2), z));
+    }
+
+    void ToOKLabColorsSSE2(const APE::LinearColor* colors, APE::OKLabColor* out) {
+        const __m128 scale = _mm_set1_ps(LinearScale);
+        __m128 r, g, b, a;
+        LoadLinearColorsSSE2(colors, r, g, b, a);
+        r = _mm_mul_ps(r, scale);
+        g = _mm_mul_ps(g, scale);
+        b = _mm_mul_ps(b, scale);
+        __m128 l = CbrtSSE2(Dot(0.4122214708f, r, 0.5363325363f, g, 0.0514459929f, b));
+        __m128 m = CbrtSSE2(Dot(0.2119034982f, r, 0.6806995451f, g, 0.1073969566f, b));
+        __m128 s = CbrtSSE2(Dot(0.0883024619f, r, 0.2817188376f, g, 0.6299787005f, b));
+        StoreFloatColorsSSE2(out, Dot(0.2104542553f, l, 0.7936178050f, m, -0.0040720468f, s),
+                             Dot(1.9779984951f, l, -2.4285922050f, m, 0.4505937099f, s),
+                             Dot(0.0259040371f, l, 0.7827717662f, m, -0.8086757660f, s), _mm_mul_ps(a, scale));
+    }
+
+    void FromOKLabColorsSSE2(const APE::OKLabColor* colors, APE::LinearColor* out) {
+        __m128 lightness, a, b, alpha;
+        LoadFloatColorsSSE2(colors, lightness, a, b, alpha);
+        __m128 l = _mm_add_ps(_mm_add_ps(lightness, _mm_mul_ps(_mm_set1_ps(0.3963377774f), a)), _mm_mul_ps(_mm_set1_ps(0.2158037573f), b));
+        __m128 m = _mm_add_ps(_mm_add_ps(lightness, _mm_mul_ps(_mm_set1_ps(-0.1055613458f), a)), _mm_mul_ps(_mm_set1_ps(-0.0638541728f), b));
+        __m128 s = _mm_add_ps(_mm_add_ps(lightness, _mm_mul_ps(_mm_set1_ps(-0.0894841775f), a)), _mm_mul_ps(_mm_set1_ps(-1.2914855480f), b));
+        l = _mm_mul_ps(_mm_mul_ps(l, l), l);
+        m = _mm_mul_ps(_mm_mul_ps(m, m), m);
+        s = _mm_mul_ps(_mm_mul_ps(s, s), s);
+        StoreLinearColorsSSE2(out, Dot(4.0767416621f, l, -3.3077115913f, m, 0.2309699292f, s),
+                              Dot(-1.2684380046f, l, 2.6097574011f, m, -0.3413193965f, s),
+                              Dot(-0.0041960863f, l, -0.7034186147f, m, 1.7076147010f, s), alpha);
+    }
+#endif
+}
+
+//* --- APE::Color color models ---
+
+APE::HSVColor APE::Color::ToHSV() const { return ToHSVColor(*this); }
+APE::HSLColor APE::Color::ToHSL() const { return ToHSLColor(*this); }
+APE::OKLabColor APE::Color::ToOKLab() const { return ToOKLabColor(ColorSpace::ToLinear(*this)); }
+
+APE::Color APE::Color::FromHSV(const APE::HSVColor& color) { return FromHSVColor(color); }
+APE::Color APE::Color::FromHSL(const APE::HSLColor& color) { return FromHSLColor(color); }
+APE::Color APE::Color::FromOKLab(const APE::OKLabColor& color) { return ColorSpace::ToSRGB(FromOKLabColor(color)); }
+
+void APE::Color::ToHSVSpan(const APE::Color* colors, APE::HSVColor* out, std::size_t count) {
+    std::size_t i = 0;
+#ifdef APE_COLOR_SSE2
+    if (UseSSE2())
+        for (; i + 4 <= count; i += 4) ToHSVColorsSSE2(colors + i, out + i);
+#endif
+    for (; i < count; i++) out[i] = ToHSVColor(colors[i]);
+}
+void APE::Color::ToHSLSpan(const APE::Color* colors, APE::HSLColor* out, std::size_t count) {
+    std::size_t i = 0;
+#ifdef APE_COLOR_SSE2
+    if (UseSSE2())
+        for (; i + 4 <= count; i += 4) ToHSLColorsSSE2(colors + i, out + i);
+#endif
+    for (; i < count; i++) out[i] = ToHSLColor(colors[i]);
+}
+void APE::Color::ToOKLabSpan(const APE::Color* colors, APE::OKLabColor* out, std::size_t count) {
+    LinearColor linear[ChunkSize];
+    for (std::size_t first = 0; first < count; first += ChunkSize) {
+        std::size_t size = APE_MIN(ChunkSize, count - first), i = 0;
+        ColorSpace::ToLinear(colors + first, linear, size);
+#ifdef APE_COLOR_SSE2
+        if (UseSSE2())
+            for (; i + 4 <= size; i += 4) ToOKLabColorsSSE2(linear + i, out + first + i);
+#endif
+        for (; i < size; i++) out[first + i] = ToOKLabColor(linear[i]);
+    }
+}
+
+void APE::Color::FromHSVSpan(const APE::HSVColor* colors, APE::Color* out, std::size_t count) {
+    std::size_t i = 0;
+#ifdef APE_COLOR_SSE2
+    if (UseSSE2())
+        for (; i + 4 <= count; i += 4) FromHSVColorsSSE2(colors + i, out + i);
+#endif
+    for (; i < count; i++) out[i] = FromHSVColor(colors[i]);
+}
+void APE::Color::FromHSLSpan(const APE::HSLColor* colors, APE::Color* out, std::size_t count) {
+    std::size_t i = 0;
+#ifdef APE_COLOR_SSE2
+    if (UseSSE2())
+        for (; i + 4 <= count; i += 4) FromHSLColorsSSE2(colors + i, out + i);
+#endif
+    for (; i < count; i++) out[i] = FromHSLColor(colors[i]);
+}
+void APE::Color::FromOKLabSpan(const APE::OKLabColor* colors, APE::Color* out, std::size_t count) {
+    LinearColor linear[ChunkSize];
+    for (std::size_t first = 0; first < count; first += ChunkSize) {
+        std::size_t size = APE_MIN(ChunkSize, count - first), i = 0;
+#ifdef APE_COLOR_SSE2
+        if (UseSSE2())
+            for (; i + 4 <= size; i += 4) FromOKLabColorsSSE2(colors + first + i, linear + i);
+#endif
+        for (; i < size; i++) linear[i] = FromOKLabColor(colors[first + i]);
+        ColorSpace::ToSRGB(linear, out + first, size);
+    }
+}
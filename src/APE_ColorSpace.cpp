@@ -0,0 +1,103 @@
+#include "APE/APE_ColorSpace.h"
+#include "APE_Color_Span.h"
+
+#include <cmath>
+
+namespace {
+    struct SRGBTables {
+        uint16_t ToLinear[256];
+        uint8_t ToSRGB[APE::ColorSpace::LinearToSRGBTableSize];
+    };
+
+    // The sRGB transfer functions, on [0, 1] values.
+    double DecodeSRGB(double value) {
+        return value <= 0.04045 ? value / 12.92 : std::pow((value + 0.055) / 1.055, 2.4);
+    }
+
+    double EncodeSRGB(double value) {
+        return value <= 0.0031308 ? value * 12.92 : 1.055 * std::pow(value, 1.0 / 2.4) - 0.055;
+    }
+
+    SRGBTables BuildSRGBTables() {
+        SRGBTables tables;
+        for (int i = 0; i < 256; i++)
+            tables.ToLinear[i] = static_cast<uint16_t>(std::lround(DecodeSRGB(i / 255.0) * 65535.0));
+        // Each entry cover 16 linear values, it take the sRGB value of the middle one.
+        for (std::size_t i = 0; i < APE::ColorSpace::LinearToSRGBTableSize; i++)
+            tables.ToSRGB[i] = static_cast<uint8_t>(std::lround(EncodeSRGB((i * 16 + 7.5) / 65535.0) * 255.0));
+        return tables;
+    }
+
+    // The tables are built on the first use, so loading the library do no work.
+    const SRGBTables& GetSRGBTables() {
+        static const SRGBTables tables = BuildSRGBTables();
+        return tables;
+    }
+
+    uint8_t LerpLinearChannel(const SRGBTables& tables, uint8_t a, uint8_t b, unsigned weight) {
+        uint32_t value = (tables.ToLinear[a] * (256 - weight) + tables.ToLinear[b] * weight + 128) >> 8;
+        return tables.ToSRGB[value >> 4];
+    }
+
+    APE::Color LerpLinearColor(const SRGBTables& tables, const APE::Color& a, const APE::Color& b, unsigned weight) {
+        return APE::Color(LerpLinearChannel(tables, a.Red, b.Red, weight), LerpLinearChannel(tables, a.Green, b.Green, weight),
+                          LerpLinearChannel(tables, a.Blue, b.Blue, weight), APE::LerpChannel(a.Alpha, b.Alpha, weight));
+    }
+}
+
+//* --- APE::ColorSpace ---
+
+uint16_t APE::ColorSpace::SRGBToLinear(uint8_t value) { return GetSRGBTables().ToLinear[value]; }
+uint8_t APE::ColorSpace::LinearToSRGB(uint16_t value) { return GetSRGBTables().ToSRGB[value >> 4]; }
+
+APE::LinearColor APE::ColorSpace::ToLinear(const APE::Color& color) {
+    const SRGBTables& tables = GetSRGBTables();
+    return LinearColor(tables.ToLinear[color.Red], tables.ToLinear[color.Green], tables.ToLinear[color.Blue],
+                       static_cast<uint16_t>(color.Alpha * 257));
+}
+APE::Color APE::ColorSpace::ToSRGB(const APE::LinearColor& color) {
+    const SRGBTables& tables = GetSRGBTables();
+    return Color(tables.ToSRGB[color.Red >> 4], tables.ToSRGB[color.Green >> 4], tables.ToSRGB[color.Blue >> 4],
+                 static_cast<uint8_t>((color.Alpha + 128) / 257));
+}
+
+void APE::ColorSpace::ToLinear(const APE::Color* colors, APE::LinearColor* out, std::size_t count) {
+    const SRGBTables& tables = GetSRGBTables();
+    for (std::size_t i = 0; i < count; i++) {
+        const Color& color = colors[i];
+        out[i] = LinearColor(tables.ToLinear[color.Red], tables.ToLinear[color.Green], tables.ToLinear[color.Blue],
+                             static_cast<uint16_t>(color.Alpha * 257));
+    }
+}
+void APE::ColorSpace::ToSRGB(const APE::LinearColor* colors, APE::Color* out, std::size_t count) {
+    const SRGBTables& tables = GetSRGBTables();
+    for (std::size_t i = 0; i < count; i++) {
+        const LinearColor& color = colors[i];
+        out[i] = Color(tables.ToSRGB[color.Red >> 4], tables.ToSRGB[color.Green >> 4], tables.ToSRGB[color.Blue >> 4],
+                       static_cast<uint8_t>((color.Alpha + 128) / 257));
+    }
+}
+
+APE::Color APE::ColorSpace::Lerp(const APE::Color& a, const APE::Color& b, float t) {
+    return LerpLinearColor(GetSRGBTables(), a, b, GetLerpWeight(t));
+}
+APE::Color APE::ColorSpace::Lighten(const APE::Color& color, float percent) {
+    return Lerp(color, Color(255), percent * 0.01f);
+}
+APE::Color APE::ColorSpace::Darken(const APE::Color& color, float percent) {
+    return Lerp(color, Color(0, 255), percent * 0.01f);
+}
+
+void APE::ColorSpace::LerpSpan(const APE::Color* a, const APE::Color* b, float t, APE::Color* out, std::size_t count) {
+    const SRGBTables& tables = GetSRGBTables();
+    unsigned weight = GetLerpWeight(t);
+    for (std::size_t i = 0; i < count; i++)
+        out[i] = LerpLinearColor(tables, a[i], b[i], weight);
+}
+void APE::ColorSpace::LerpSpan(const APE::Color* colors, const APE::Color& target, float t, APE::Color* out, std::size_t count) {
+    const SRGBTables& tables = GetSRGBTables();
+    unsigned weight = GetLerpWeight(t);
+    Color end = target;
+    for (std::size_t i = 0; i < count; i++)
+        out[i] = LerpLinearColor(tables, colors[i], end, weight);
+}
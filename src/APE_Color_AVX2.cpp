@@ -0,0 +1,149 @@
+#include "APE_Color_Span.h"
+
+#include <cstring>
+
+// This file is the only one compiled with AVX2 enabled (see CMakeLists.txt), its kernels must only be called
+// after checking the CPU support at runtime.
+
+#ifdef __AVX2__
+// The unpack, shuffle and pack instructions work inside each 128-bit lane, so the colors keep their order.
+static __m256i LerpChannelsAVX2(__m256i a, __m256i b, __m256i weightA, __m256i weightB) {
+    __m256i sum = _mm256_add_epi16(_mm256_mullo_epi16(a, weightA), _mm256_mullo_epi16(b, weightB));
+    return _mm256_srli_epi16(_mm256_add_epi16(sum, _mm256_set1_epi16(128)), 8);
+}
+
+bool APE::IsColorAVX2KernelCompiled() { return true; }
+
+void APE::LerpColorSpanAVX2(const APE::Color* a, const APE::Color* b, std::size_t bStep, unsigned weight, APE::Color* out, std::size_t count) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i weightA = _mm256_set1_epi16(static_cast<short>(256 - weight)), weightB = _mm256_set1_epi16(static_cast<short>(weight));
+    int32_t target;
+    std::memcpy(&target, b, sizeof(target));
+    __m256i bv = _mm256_set1_epi32(target);
+
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i av = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        if (bStep) bv = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        __m256i low = LerpChannelsAVX2(_mm256_unpacklo_epi8(av, zero), _mm256_unpacklo_epi8(bv, zero), weightA, weightB);
+        __m256i high = LerpChannelsAVX2(_mm256_unpackhi_epi8(av, zero), _mm256_unpackhi_epi8(bv, zero), weightA, weightB);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_packus_epi16(low, high));
+    }
+    LerpColorSpanScalar(a + i, b + i * bStep, bStep, weight, out + i, count - i);
+}
+
+void APE::PremultiplyColorSpanAVX2(const APE::Color* colors, APE::Color* out, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(colors + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), PremultiplyColorsAVX2(v));
+    }
+    PremultiplyColorSpanScalar(colors + i, out + i, count - i);
+}
+
+void APE::BlendColorSpanAVX2(BlendOperation operation, const APE::PremultipliedColor* src, std::size_t srcStep, APE::Color* dst, std::size_t count) {
+    int32_t color;
+    std::memcpy(&color, src, sizeof(color));
+    __m256i sv = _mm256_set1_epi32(color);
+
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        if (srcStep) sv = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        __m256i dv = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), BlendColorsAVX2(operation, sv, dv));
+    }
+    BlendColorSpanScalar(operation, src + i * srcStep, srcStep, dst + i, count - i);
+}
+
+// The byte shuffle masks of the packed formats, the same for each 128-bit lane (a negative index write a zero).
+static __m256i GetPackShuffleAVX2(const APE::PackedLayout& layout, bool unpack) {
+    const unsigned shifts[4] = { layout.RedShift, layout.GreenShift, layout.BlueShift, layout.AlphaShift };
+    alignas(32) int8_t mask[32];
+    for (int i = 0; i < 32; i += 4) {
+        for (int c = 0; c < 4; c++) {
+            int packed = i + (int)shifts[c] / 8;
+            if (unpack) mask[i + c] = (c == 3 && !layout.HasAlpha) ? -1 : (int8_t)(packed % 16);
+            else mask[packed] = (int8_t)((i + c) % 16);
+        }
+    }
+    return _mm256_load_si256(reinterpret_cast<const __m256i*>(mask));
+}
+
+void APE::PackColorSpanAVX2(const APE::Color* colors, uint32_t* pixels, const APE::PackedLayout& layout, std::size_t count) {
+    const __m256i shuffle = GetPackShuffleAVX2(layout, false);
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(colors + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(pixels + i), _mm256_shuffle_epi8(v, shuffle));
+    }
+    PackColorSpanScalar(colors + i, pixels + i, layout, count - i);
+}
+void APE::UnpackColorSpanAVX2(const uint32_t* pixels, const APE::PackedLayout& layout, APE::Color* colors, std::size_t count) {
+    const __m256i shuffle = GetPackShuffleAVX2(layout, true);
+    const __m256i alphaOpaque = _mm256_set1_epi32(layout.HasAlpha ? 0 : static_cast<int>(0xFF000000u));
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pixels + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(colors + i), _mm256_or_si256(_mm256_shuffle_epi8(v, shuffle), alphaOpaque));
+    }
+    UnpackColorSpanScalar(pixels + i, layout, colors + i, count - i);
+}
+
+void APE::PackColorSpanRGB565AVX2(const APE::Color* colors, uint16_t* pixels, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(colors + i));
+        __m256i r = _mm256_and_si256(_mm256_slli_epi32(v, 8), _mm256_set1_epi32(0xF800));
+        __m256i g = _mm256_and_si256(_mm256_srli_epi32(v, 5), _mm256_set1_epi32(0x07E0));
+        __m256i b = _mm256_and_si256(_mm256_srli_epi32(v, 19), _mm256_set1_epi32(0x001F));
+        // The pack work inside each 128-bit lane, the two halves are gathered in the low lane afterward.
+        __m256i packed = _mm256_packus_epi32(_mm256_or_si256(_mm256_or_si256(r, g), b), _mm256_setzero_si256());
+        packed = _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pixels + i), _mm256_castsi256_si128(packed));
+    }
+    PackColorSpanRGB565Scalar(colors + i, pixels + i, count - i);
+}
+void APE::UnpackColorSpanRGB565AVX2(const uint16_t* pixels, APE::Color* colors, std::size_t count) {
+    const __m256i alphaOpaque = _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i p = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + i)));
+        __m256i r = _mm256_srli_epi32(p, 11), g = _mm256_and_si256(_mm256_srli_epi32(p, 5), _mm256_set1_epi32(0x3F));
+        __m256i b = _mm256_and_si256(p, _mm256_set1_epi32(0x1F));
+        r = _mm256_or_si256(_mm256_slli_epi32(r, 3), _mm256_srli_epi32(r, 2));
+        g = _mm256_or_si256(_mm256_slli_epi32(g, 2), _mm256_srli_epi32(g, 4));
+        b = _mm256_or_si256(_mm256_slli_epi32(b, 3), _mm256_srli_epi32(b, 2));
+        __m256i c = _mm256_or_si256(_mm256_or_si256(r, _mm256_slli_epi32(g, 8)), _mm256_or_si256(_mm256_slli_epi32(b, 16), alphaOpaque));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(colors + i), c);
+    }
+    UnpackColorSpanRGB565Scalar(pixels + i, colors + i, count - i);
+}
+#else
+bool APE::IsColorAVX2KernelCompiled() { return false; }
+
+void APE::LerpColorSpanAVX2(const APE::Color* a, const APE::Color* b, std::size_t bStep, unsigned weight, APE::Color* out, std::size_t count) {
+    LerpColorSpanScalar(a, b, bStep, weight, out, count);
+}
+
+void APE::PremultiplyColorSpanAVX2(const APE::Color* colors, APE::Color* out, std::size_t count) {
+    PremultiplyColorSpanScalar(colors, out, count);
+}
+
+void APE::BlendColorSpanAVX2(BlendOperation operation, const APE::PremultipliedColor* src, std::size_t srcStep, APE::Color* dst, std::size_t count) {
+    BlendColorSpanScalar(operation, src, srcStep, dst, count);
+}
+
+void APE::PackColorSpanAVX2(const APE::Color* colors, uint32_t* pixels, const APE::PackedLayout& layout, std::size_t count) {
+    PackColorSpanScalar(colors, pixels, layout, count);
+}
+void APE::UnpackColorSpanAVX2(const uint32_t* pixels, const APE::PackedLayout& layout, APE::Color* colors, std::size_t count) {
+    UnpackColorSpanScalar(pixels, layout, colors, count);
+}
+
+void APE::PackColorSpanRGB565AVX2(const APE::Color* colors, uint16_t* pixels, std::size_t count) {
+    PackColorSpanRGB565Scalar(colors, pixels, count);
+}
+void APE::UnpackColorSpanRGB565AVX2(const uint16_t* pixels, APE::Color* colors, std::size_t count) {
+    UnpackColorSpanRGB565Scalar(pixels, colors, count);
+}
+#endif
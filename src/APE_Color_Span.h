@@ -0,0 +1,229 @@
+#ifndef __APE_COLOR_SPAN_H__
+#define __APE_COLOR_SPAN_H__
+
+#include "APE/APE_Blend.h"
+#include "APE/APE_Color.h"
+
+#include <cstddef>
+#include <cstdint>
+
+// Internal kernels of the Color span operations, shared between their translation units.
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define APE_COLOR_SSE2 1
+#endif
+
+#ifdef APE_COLOR_SSE2
+#include <emmintrin.h>
+#endif
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace APE {
+    static_assert(sizeof(Color) == 4, "The SIMD kernels store Color as packed 32-bit RGBA!");
+    static_assert(sizeof(PremultipliedColor) == 4, "The SIMD kernels store PremultipliedColor as packed 32-bit RGBA!");
+
+    /// @brief The instruction sets of the color kernels.
+    enum class ColorKernel { Scalar, SSE2, AVX2 };
+    /// @brief Get the fastest color kernel supported by the CPU, detected on first use.
+    ColorKernel GetColorKernel();
+
+    /// @brief The composite operations of the premultiplied blend kernels (see APE::Blend).
+    enum class BlendOperation { Over, Add, Modulate, Multiply };
+
+    /// @brief Convert an interpolation value to the 8.8 fixed point weight used by every lerp, so the scalar
+    /// and the SIMD kernels give the same result.
+    /// @param t The interpolation value, in range [0->1] (if out of range will clamped it, NaN become 0).
+    /// @return The weight, in range [0->256].
+    static inline unsigned GetLerpWeight(float t) {
+        if (!(t > 0.0f)) return 0;
+        return t < 1.0f ? static_cast<unsigned>(t * 256.0f + 0.5f) : 256;
+    }
+
+    /// @brief Interpolate a channel with a weight from GetLerpWeight(), rounded to nearest.
+    static inline uint8_t LerpChannel(unsigned a, unsigned b, unsigned weight) {
+        return static_cast<uint8_t>((a * (256 - weight) + b * weight + 128) >> 8);
+    }
+
+    /// @brief Interpolate two colors with a weight from GetLerpWeight().
+    static inline Color LerpColor(const Color& a, const Color& b, unsigned weight) {
+        return Color(LerpChannel(a.Red, b.Red, weight), LerpChannel(a.Green, b.Green, weight),
+                     LerpChannel(a.Blue, b.Blue, weight), LerpChannel(a.Alpha, b.Alpha, weight));
+    }
+
+    /// @brief Multiply two 8-bit values as [0, 1] fractions, rounded exactly (x * y / 255).
+    static inline uint8_t MultiplyChannel(unsigned x, unsigned y) {
+        unsigned t = x * y + 128;
+        return static_cast<uint8_t>((t + (t >> 8)) >> 8);
+    }
+
+    /// @brief Add two 8-bit values, saturated.
+    static inline uint8_t AddChannel(unsigned x, unsigned y) { return static_cast<uint8_t>(APE_MIN(255u, x + y)); }
+
+    /// @brief Composite a premultiplied color into a color, the reference of every blend kernel.
+    static inline Color BlendPremultipliedColor(BlendOperation operation, const PremultipliedColor& src, const Color& dst) {
+        unsigned inv = 255 - src.Alpha;
+        switch (operation) {
+        case BlendOperation::Over:
+            return Color(AddChannel(src.Red, MultiplyChannel(dst.Red, inv)), AddChannel(src.Green, MultiplyChannel(dst.Green, inv)),
+                         AddChannel(src.Blue, MultiplyChannel(dst.Blue, inv)), AddChannel(src.Alpha, MultiplyChannel(dst.Alpha, inv)));
+        case BlendOperation::Add:
+            return Color(AddChannel(src.Red, dst.Red), AddChannel(src.Green, dst.Green), AddChannel(src.Blue, dst.Blue), dst.Alpha);
+        case BlendOperation::Modulate:
+            return Color(MultiplyChannel(src.Red, dst.Red), MultiplyChannel(src.Green, dst.Green),
+                         MultiplyChannel(src.Blue, dst.Blue), dst.Alpha);
+        default:
+            return Color(AddChannel(MultiplyChannel(src.Red, dst.Red), MultiplyChannel(dst.Red, inv)),
+                         AddChannel(MultiplyChannel(src.Green, dst.Green), MultiplyChannel(dst.Green, inv)),
+                         AddChannel(MultiplyChannel(src.Blue, dst.Blue), MultiplyChannel(dst.Blue, inv)), dst.Alpha);
+        }
+    }
+
+    /// @brief Check if the AVX2 color kernels were compiled, their translation unit is the only one built with AVX2 enabled.
+    bool IsColorAVX2KernelCompiled();
+
+    /// @brief The lerp kernels, interpolate count colors of a to b with a weight from GetLerpWeight().
+    /// @param bStep 1 to read a color of b per color of a, 0 to interpolate every color to b[0].
+    /// @note out can be the same as a or b.
+    void LerpColorSpanScalar(const Color* a, const Color* b, std::size_t bStep, unsigned weight, Color* out, std::size_t count);
+    void LerpColorSpanSSE2(const Color* a, const Color* b, std::size_t bStep, unsigned weight, Color* out, std::size_t count);
+    void LerpColorSpanAVX2(const Color* a, const Color* b, std::size_t bStep, unsigned weight, Color* out, std::size_t count);
+
+    /// @brief The premultiply kernels, multiply the red, green and blue channels of count colors by their alpha.
+    /// @note out can be the same as colors.
+    void PremultiplyColorSpanScalar(const Color* colors, Color* out, std::size_t count);
+    void PremultiplyColorSpanSSE2(const Color* colors, Color* out, std::size_t count);
+    void PremultiplyColorSpanAVX2(const Color* colors, Color* out, std::size_t count);
+
+    /// @brief Composite count premultiplied colors into dst, with the fastest kernel supported by the CPU.
+    /// @param srcStep 1 to read a color of src per color of dst, 0 to composite src[0] into every color.
+    void BlendColorSpan(BlendOperation operation, const PremultipliedColor* src, std::size_t srcStep, Color* dst, std::size_t count);
+    /// @brief The blend kernels, with the same parameters as BlendColorSpan().
+    void BlendColorSpanScalar(BlendOperation operation, const PremultipliedColor* src, std::size_t srcStep, Color* dst, std::size_t count);
+    void BlendColorSpanSSE2(BlendOperation operation, const PremultipliedColor* src, std::size_t srcStep, Color* dst, std::size_t count);
+    void BlendColorSpanAVX2(BlendOperation operation, const PremultipliedColor* src, std::size_t srcStep, Color* dst, std::size_t count);
+
+    /// @brief The layout of a packed 32-bit pixel format, the shift of each channel in the pixel value (multiples
+    /// of 8). The formats without alpha get the alpha in their unused byte, and are read as opaque.
+    struct PackedLayout {
+        unsigned RedShift, GreenShift, BlueShift, AlphaShift;
+        bool HasAlpha;
+    };
+
+    /// @brief The pack kernels, convert count colors to packed 32-bit pixel values.
+    /// @note The SIMD kernels are only built for x86, which is little endian.
+    void PackColorSpanScalar(const Color* colors, uint32_t* pixels, const PackedLayout& layout, std::size_t count);
+    void PackColorSpanSSE2(const Color* colors, uint32_t* pixels, const PackedLayout& layout, std::size_t count);
+    void PackColorSpanAVX2(const Color* colors, uint32_t* pixels, const PackedLayout& layout, std::size_t count);
+    /// @brief The unpack kernels, convert count packed 32-bit pixel values to colors.
+    void UnpackColorSpanScalar(const uint32_t* pixels, const PackedLayout& layout, Color* colors, std::size_t count);
+    void UnpackColorSpanSSE2(const uint32_t* pixels, const PackedLayout& layout, Color* colors, std::size_t count);
+    void UnpackColorSpanAVX2(const uint32_t* pixels, const PackedLayout& layout, Color* colors, std::size_t count);
+    /// @brief The RGB565 kernels, the channels are truncated when packed and expanded by bit replication when unpacked.
+    void PackColorSpanRGB565Scalar(const Color* colors, uint16_t* pixels, std::size_t count);
+    void PackColorSpanRGB565SSE2(const Color* colors, uint16_t* pixels, std::size_t count);
+    void PackColorSpanRGB565AVX2(const Color* colors, uint16_t* pixels, std::size_t count);
+    void UnpackColorSpanRGB565Scalar(const uint16_t* pixels, Color* colors, std::size_t count);
+    void UnpackColorSpanRGB565SSE2(const uint16_t* pixels, Color* colors, std::size_t count);
+    void UnpackColorSpanRGB565AVX2(const uint16_t* pixels, Color* colors, std::size_t count);
+
+    // The SIMD helpers work on packed colors, the channels are unpacked to 16-bit lanes where every product fit.
+    // They have an internal linkage, since a copy built with AVX2 enabled must not be shared with the other
+    // translation units.
+#ifdef APE_COLOR_SSE2
+    /// @brief Multiply the 16-bit lanes as [0, 1] fractions, rounded exactly (x * y / 255).
+    static inline __m128i MultiplyChannelsSSE2(__m128i x, __m128i y) {
+        __m128i t = _mm_add_epi16(_mm_mullo_epi16(x, y), _mm_set1_epi16(128));
+        return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+    }
+
+    /// @brief Copy the alpha lane of each unpacked color to its four lanes.
+    static inline __m128i BroadcastAlphaSSE2(__m128i channels) {
+        return _mm_shufflehi_epi16(_mm_shufflelo_epi16(channels, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    }
+
+    /// @brief Premultiply 4 packed colors, with the same result as Color::Premultiply().
+    static inline __m128i PremultiplyColorsSSE2(__m128i colors) {
+        const __m128i zero = _mm_setzero_si128();
+        // The alpha lane is multiplied by 255 to keep it.
+        const __m128i alphaLanes = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0), alphaOne = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+        __m128i low = _mm_unpacklo_epi8(colors, zero), high = _mm_unpackhi_epi8(colors, zero);
+        low = MultiplyChannelsSSE2(low, _mm_or_si128(_mm_andnot_si128(alphaLanes, BroadcastAlphaSSE2(low)), alphaOne));
+        high = MultiplyChannelsSSE2(high, _mm_or_si128(_mm_andnot_si128(alphaLanes, BroadcastAlphaSSE2(high)), alphaOne));
+        return _mm_packus_epi16(low, high);
+    }
+
+    /// @brief Composite 4 packed premultiplied colors into 4 packed colors, with the same result as BlendPremultipliedColor().
+    static inline __m128i BlendColorsSSE2(BlendOperation operation, __m128i src, __m128i dst) {
+        const __m128i zero = _mm_setzero_si128(), maxChannel = _mm_set1_epi16(255);
+        const __m128i alphaMask = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+        if (operation == BlendOperation::Add)
+            return _mm_or_si128(_mm_andnot_si128(alphaMask, _mm_adds_epu8(src, dst)), _mm_and_si128(alphaMask, dst));
+
+        __m128i result[2];
+        for (int half = 0; half < 2; half++) {
+            __m128i s = half ? _mm_unpackhi_epi8(src, zero) : _mm_unpacklo_epi8(src, zero);
+            __m128i d = half ? _mm_unpackhi_epi8(dst, zero) : _mm_unpacklo_epi8(dst, zero);
+            if (operation == BlendOperation::Modulate) {
+                result[half] = MultiplyChannelsSSE2(s, d);
+                continue;
+            }
+            __m128i inv = _mm_sub_epi16(maxChannel, BroadcastAlphaSSE2(s));
+            __m128i kept = MultiplyChannelsSSE2(d, inv);
+            result[half] = _mm_add_epi16(operation == BlendOperation::Over ? s : MultiplyChannelsSSE2(s, d), kept);
+        }
+        __m128i packed = _mm_packus_epi16(result[0], result[1]);
+        if (operation == BlendOperation::Over) return packed;
+        return _mm_or_si128(_mm_andnot_si128(alphaMask, packed), _mm_and_si128(alphaMask, dst));
+    }
+#endif
+
+#ifdef __AVX2__
+    /// @brief The AVX2 versions of the SSE2 helpers, on 8 packed colors. The unpack, shuffle and pack instructions
+    /// work inside each 128-bit lane, so the colors keep their order.
+    static inline __m256i MultiplyChannelsAVX2(__m256i x, __m256i y) {
+        __m256i t = _mm256_add_epi16(_mm256_mullo_epi16(x, y), _mm256_set1_epi16(128));
+        return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+    }
+
+    static inline __m256i BroadcastAlphaAVX2(__m256i channels) {
+        return _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(channels, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    }
+
+    static inline __m256i PremultiplyColorsAVX2(__m256i colors) {
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i alphaLanes = _mm256_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0);
+        const __m256i alphaOne = _mm256_set_epi16(255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0);
+        __m256i low = _mm256_unpacklo_epi8(colors, zero), high = _mm256_unpackhi_epi8(colors, zero);
+        low = MultiplyChannelsAVX2(low, _mm256_or_si256(_mm256_andnot_si256(alphaLanes, BroadcastAlphaAVX2(low)), alphaOne));
+        high = MultiplyChannelsAVX2(high, _mm256_or_si256(_mm256_andnot_si256(alphaLanes, BroadcastAlphaAVX2(high)), alphaOne));
+        return _mm256_packus_epi16(low, high);
+    }
+
+    static inline __m256i BlendColorsAVX2(BlendOperation operation, __m256i src, __m256i dst) {
+        const __m256i zero = _mm256_setzero_si256(), maxChannel = _mm256_set1_epi16(255);
+        const __m256i alphaMask = _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+        if (operation == BlendOperation::Add)
+            return _mm256_or_si256(_mm256_andnot_si256(alphaMask, _mm256_adds_epu8(src, dst)), _mm256_and_si256(alphaMask, dst));
+
+        __m256i result[2];
+        for (int half = 0; half < 2; half++) {
+            __m256i s = half ? _mm256_unpackhi_epi8(src, zero) : _mm256_unpacklo_epi8(src, zero);
+            __m256i d = half ? _mm256_unpackhi_epi8(dst, zero) : _mm256_unpacklo_epi8(dst, zero);
+            if (operation == BlendOperation::Modulate) {
+                result[half] = MultiplyChannelsAVX2(s, d);
+                continue;
+            }
+            __m256i inv = _mm256_sub_epi16(maxChannel, BroadcastAlphaAVX2(s));
+            __m256i kept = MultiplyChannelsAVX2(d, inv);
+            result[half] = _mm256_add_epi16(operation == BlendOperation::Over ? s : MultiplyChannelsAVX2(s, d), kept);
+        }
+        __m256i packed = _mm256_packus_epi16(result[0], result[1]);
+        if (operation == BlendOperation::Over) return packed;
+        return _mm256_or_si256(_mm256_andnot_si256(alphaMask, packed), _mm256_and_si256(alphaMask, dst));
+    }
+#endif
+}
+
+#endif // __APE_COLOR_SPAN_H__
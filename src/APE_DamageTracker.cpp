@@ -0,0 +1,96 @@
+#include "APE/APE_DamageTracker.h"
+#include "APE/APE_Define.h"
+
+#include <stdlib.h>
+
+// Merge two rectangles when it cost at most this many undamaged pixels, that is cheaper than another draw.
+static const long long MergeWasteThreshold = 1024;
+
+// The undamaged area added by replacing two rectangles with their union.
+static long long MergeWaste(const APE::Rectangle& r1, const APE::Rectangle& r2) {
+    return APE::Rectangle::Union(r1, r2).Area() - r1.Area() - r2.Area() + APE::Rectangle::Intersect(r1, r2).Area();
+}
+
+//* --- APE::DamageTracker ---
+
+APE::DamageTracker::DamageTracker(const APE::Size& size, std::size_t maxRectangles)
+    : m_size(size.Absolute()), m_maxRectangles(APE_MAX(maxRectangles, (std::size_t)1)) {}
+
+APE::Size APE::DamageTracker::GetSize() const { return m_size; }
+std::size_t APE::DamageTracker::GetMaxRectangles() const { return m_maxRectangles; }
+
+void APE::DamageTracker::AddDamage(const APE::Rectangle& area) {
+    if (area.IsEmptyArea()) return;
+    Rectangle damage = Rectangle::Intersect(Rectangle(area.LeftSide(), area.TopSide(), abs(area.Width), abs(area.Height)),
+                                            Rectangle(Point::Zero, m_size));
+    if (damage.IsEmptyArea()) return;
+
+    // Absorb every rectangle that is covered by, or cheap to merge with, the new damage. A merge may make
+    // new rectangles cheap to absorb, so repeat until nothing change.
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (std::size_t i = 0; i < m_rectangles.size(); i++) {
+            if (m_rectangles[i].IsContain(damage)) return;
+            if (damage.IsContain(m_rectangles[i]) || MergeWaste(damage, m_rectangles[i]) <= MergeWasteThreshold) {
+                damage = Rectangle::Union(damage, m_rectangles[i]);
+                m_rectangles[i] = m_rectangles.back();
+                m_rectangles.pop_back();
+                merged = true;
+                break;
+            }
+        }
+    }
+    m_rectangles.push_back(damage);
+    Coalesce();
+}
+void APE::DamageTracker::DamageAll() {
+    m_rectangles.clear();
+    if (!m_size.IsEmptyArea())
+        m_rectangles.push_back(Rectangle(Point::Zero, m_size));
+}
+void APE::DamageTracker::Clear() { m_rectangles.clear(); }
+
+void APE::DamageTracker::Coalesce() {
+    while (m_rectangles.size() > m_maxRectangles) {
+        std::size_t first = 0, second = 1;
+        long long bestWaste = -1;
+        for (std::size_t i = 0; i < m_rectangles.size(); i++)
+            for (std::size_t j = i + 1; j < m_rectangles.size(); j++) {
+                long long waste = MergeWaste(m_rectangles[i], m_rectangles[j]);
+                if (bestWaste < 0 || waste < bestWaste) {
+                    bestWaste = waste;
+                    first = i; second = j;
+                }
+            }
+        Rectangle merged = Rectangle::Union(m_rectangles[first], m_rectangles[second]);
+        m_rectangles[second] = m_rectangles.back();
+        m_rectangles.pop_back();
+        m_rectangles[first] = m_rectangles.back();
+        m_rectangles.pop_back();
+
+        // The union may now cover other rectangles, they are not needed anymore.
+        for (std::size_t i = 0; i < m_rectangles.size();) {
+            if (merged.IsContain(m_rectangles[i])) {
+                m_rectangles[i] = m_rectangles.back();
+                m_rectangles.pop_back();
+            } else i++;
+        }
+        m_rectangles.push_back(merged);
+    }
+}
+
+bool APE::DamageTracker::IsDamaged() const { return !m_rectangles.empty(); }
+const std::vector<APE::Rectangle>& APE::DamageTracker::GetRectangles() const { return m_rectangles; }
+APE::Rectangle APE::DamageTracker::GetBounds() const {
+    if (m_rectangles.empty()) return Rectangle::Empty;
+    Rectangle bounds = m_rectangles[0];
+    for (std::size_t i = 1; i < m_rectangles.size(); i++)
+        bounds = Rectangle::Union(bounds, m_rectangles[i]);
+    return bounds;
+}
+long long APE::DamageTracker::GetDamagedArea() const {
+    long long area = 0;
+    for (const Rectangle& r : m_rectangles) area += r.Area();
+    return area;
+}
@@ -0,0 +1,109 @@
+#include "APE/APE_Gradient.h"
+#include "APE/APE_ColorSpace.h"
+#include "APE_Color_Span.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+// Clamp a position to [0->1], NaN become 0.
+static float ClampPosition(float position) {
+    if (!(position > 0.0f)) return 0.0f;
+    return position < 1.0f ? position : 1.0f;
+}
+
+static bool IsBefore(const APE::GradientStop& a, const APE::GradientStop& b) { return a.Position < b.Position; }
+
+//* --- APE::Gradient ---
+
+APE::Gradient::Gradient(std::size_t tableSize, APE::GradientInterpolation interpolation) : m_interpolation(interpolation) {
+    if (tableSize != SmallTableSize && tableSize != LargeTableSize)
+        throw std::runtime_error("Gradient: Invalid table size to create!");
+    m_table.resize(tableSize, Color::Empty);
+}
+APE::Gradient::Gradient(const APE::Color& start, const APE::Color& end, std::size_t tableSize, APE::GradientInterpolation interpolation)
+    : Gradient(tableSize, interpolation) {
+    GradientStop stops[2] = { { 0.0f, start }, { 1.0f, end } };
+    SetStops(stops, 2);
+}
+
+void APE::Gradient::AddStop(float position, const APE::Color& color) {
+    GradientStop stop = { ClampPosition(position), color };
+    // After the stops at the same position, so adding a stop twice make a hard edge.
+    m_stops.insert(std::upper_bound(m_stops.begin(), m_stops.end(), stop, IsBefore), stop);
+    Bake();
+}
+void APE::Gradient::SetStops(const APE::GradientStop* stops, std::size_t count) {
+    m_stops.clear();
+    for (std::size_t i = 0; stops && i < count; i++)
+        m_stops.push_back({ ClampPosition(stops[i].Position), stops[i].Value });
+    std::stable_sort(m_stops.begin(), m_stops.end(), IsBefore);
+    Bake();
+}
+void APE::Gradient::ClearStops() {
+    m_stops.clear();
+    Bake();
+}
+const std::vector<APE::GradientStop>& APE::Gradient::GetStops() const { return m_stops; }
+
+APE::GradientInterpolation APE::Gradient::GetInterpolation() const { return m_interpolation; }
+void APE::Gradient::SetInterpolation(APE::GradientInterpolation interpolation) {
+    if (m_interpolation == interpolation) return;
+    m_interpolation = interpolation;
+    Bake();
+}
+
+std::size_t APE::Gradient::GetTableSize() const { return m_table.size(); }
+const APE::Color* APE::Gradient::GetTable() const { return m_table.data(); }
+
+APE::Color APE::Gradient::Sample(float t) const {
+    return m_table[(std::size_t)(ClampPosition(t) * (m_table.size() - 1) + 0.5f)];
+}
+void APE::Gradient::SampleSpan(const float* t, APE::Color* out, std::size_t count) const {
+    const float last = (float)(m_table.size() - 1);
+    for (std::size_t i = 0; i < count; i++)
+        out[i] = m_table[(std::size_t)(ClampPosition(t[i]) * last + 0.5f)];
+}
+
+void APE::Gradient::Bake() {
+    std::size_t size = m_table.size();
+    if (m_stops.empty()) {
+        std::fill(m_table.begin(), m_table.end(), Color::Empty);
+        return;
+    }
+
+    // The OKLab entries are interpolated first, then converted to Color all at once with the SIMD kernels.
+    std::vector<OKLabColor> stopsLab, tableLab;
+    if (m_interpolation == GradientInterpolation::OKLab) {
+        std::vector<Color> colors;
+        for (const GradientStop& stop : m_stops) colors.push_back(stop.Value);
+        stopsLab.resize(colors.size());
+        Color::ToOKLabSpan(colors.data(), stopsLab.data(), colors.size());
+        tableLab.resize(size);
+    }
+
+    // The entries positions only increase, so the stop after the position is found by walking the stops.
+    std::size_t next = 0;
+    for (std::size_t i = 0; i < size; i++) {
+        float t = (float)i / (float)(size - 1);
+        while (next < m_stops.size() && m_stops[next].Position <= t) next++;
+        std::size_t a = next == 0 ? 0 : next - 1, b = next == m_stops.size() ? m_stops.size() - 1 : next;
+        float f = a == b ? 0.0f : (t - m_stops[a].Position) / (m_stops[b].Position - m_stops[a].Position);
+
+        switch (m_interpolation) {
+        case GradientInterpolation::SRGB:
+            m_table[i] = LerpColor(m_stops[a].Value, m_stops[b].Value, GetLerpWeight(f));
+            break;
+        case GradientInterpolation::Linear:
+            m_table[i] = ColorSpace::Lerp(m_stops[a].Value, m_stops[b].Value, f);
+            break;
+        default:
+            tableLab[i] = OKLabColor(stopsLab[a].Lightness + (stopsLab[b].Lightness - stopsLab[a].Lightness) * f,
+                                     stopsLab[a].A + (stopsLab[b].A - stopsLab[a].A) * f,
+                                     stopsLab[a].B + (stopsLab[b].B - stopsLab[a].B) * f,
+                                     stopsLab[a].Alpha + (stopsLab[b].Alpha - stopsLab[a].Alpha) * f);
+            break;
+        }
+    }
+    if (m_interpolation == GradientInterpolation::OKLab)
+        Color::FromOKLabSpan(tableLab.data(), m_table.data(), size);
+}
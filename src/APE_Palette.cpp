@@ -0,0 +1,341 @@
+#include "APE/APE_Palette.h"
+#include "APE/APE_ThreadPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+    // The histogram of Palette::Build(), 5 bits per channel.
+    const std::size_t HistogramBits = 5;
+    const std::size_t HistogramSize = (std::size_t)1 << (HistogramBits * 3);
+    // Counting the colors on threads is only worth it for the large images.
+    const std::size_t MinPixelsPerTask = 1 << 16;
+    const int KMeansIterations = 8;
+
+    // The grid cache of Palette, 4 bits per channel.
+    const int CellBits = 4;
+    const int CellsPerAxis = 1 << CellBits;
+    const int CellSize = 256 / CellsPerAxis;
+
+    const int BayerMatrix[64] = {
+         0, 32,  8, 40,  2, 34, 10, 42,
+        48, 16, 56, 24, 50, 18, 58, 26,
+        12, 44,  4, 36, 14, 46,  6, 38,
+        60, 28, 52, 20, 62, 30, 54, 22,
+         3, 35, 11, 43,  1, 33,  9, 41,
+        51, 19, 59, 27, 49, 17, 57, 25,
+        15, 47,  7, 39, 13, 45,  5, 37,
+        63, 31, 55, 23, 61, 29, 53, 21
+    };
+
+    struct HistogramBin {
+        uint64_t Count = 0;
+        uint64_t Sums[3] = {};
+    };
+
+    // A non-empty histogram bin, with the mean of its pixels.
+    struct ColorEntry {
+        int Channels[3];
+        uint64_t Count;
+        uint64_t Sums[3];
+    };
+
+    // A box of median cut, the entries [First, Last).
+    struct ColorBox {
+        std::size_t First, Last;
+        int Axis;
+        uint64_t Priority;
+    };
+
+    int GetChannel(const APE::Color& color, int axis) { return axis == 0 ? color.Red : (axis == 1 ? color.Green : color.Blue); }
+
+    int ClampChannel(int value) { return APE_FAST_CLAMP(0, 255, value); }
+
+    uint8_t GetMean(uint64_t sum, uint64_t count) { return static_cast<uint8_t>((sum + count / 2) / count); }
+
+    int GetDistance(const APE::Color& a, int r, int g, int b) {
+        int dr = a.Red - r, dg = a.Green - g, db = a.Blue - b;
+        return dr * dr + dg * dg + db * db;
+    }
+
+    void AddToHistogram(const APE::Color* pixels, std::size_t count, std::vector<HistogramBin>& histogram) {
+        const int shift = 8 - (int)HistogramBits;
+        for (std::size_t i = 0; i < count; i++) {
+            const APE::Color& pixel = pixels[i];
+            HistogramBin& bin = histogram[((std::size_t)(pixel.Red >> shift) << (HistogramBits * 2)) |
+                                          ((std::size_t)(pixel.Green >> shift) << HistogramBits) | (std::size_t)(pixel.Blue >> shift)];
+            bin.Count++;
+            bin.Sums[0] += pixel.Red;
+            bin.Sums[1] += pixel.Green;
+            bin.Sums[2] += pixel.Blue;
+        }
+    }
+
+    // Find the longest axis of a box, its priority is its pixels count times its length along the axis.
+    void MeasureBox(const std::vector<ColorEntry>& entries, ColorBox& box) {
+        int minimum[3] = { 255, 255, 255 }, maximum[3] = { 0, 0, 0 };
+        uint64_t count = 0;
+        for (std::size_t i = box.First; i < box.Last; i++) {
+            for (int c = 0; c < 3; c++) {
+                minimum[c] = APE_MIN(minimum[c], entries[i].Channels[c]);
+                maximum[c] = APE_MAX(maximum[c], entries[i].Channels[c]);
+            }
+            count += entries[i].Count;
+        }
+        box.Axis = 0;
+        for (int c = 1; c < 3; c++)
+            if (maximum[c] - minimum[c] > maximum[box.Axis] - minimum[box.Axis]) box.Axis = c;
+        box.Priority = box.Last - box.First > 1 ? count * (uint64_t)(maximum[box.Axis] - minimum[box.Axis]) : 0;
+    }
+
+    std::vector<APE::Color> MedianCut(std::vector<ColorEntry>& entries, std::size_t colorsCount) {
+        std::vector<ColorBox> boxes;
+        boxes.push_back({ 0, entries.size(), 0, 0 });
+        MeasureBox(entries, boxes[0]);
+
+        while (boxes.size() < colorsCount) {
+            std::size_t selected = 0;
+            for (std::size_t i = 1; i < boxes.size(); i++)
+                if (boxes[i].Priority > boxes[selected].Priority) selected = i;
+            ColorBox& box = boxes[selected];
+            if (box.Priority == 0) break;
+
+            // Split at the median pixel along the longest axis, keeping at least an entry on each side.
+            int axis = box.Axis;
+            std::sort(entries.begin() + box.First, entries.begin() + box.Last,
+                      [axis](const ColorEntry& a, const ColorEntry& b) { return a.Channels[axis] < b.Channels[axis]; });
+            uint64_t total = 0, half = 0;
+            for (std::size_t i = box.First; i < box.Last; i++) total += entries[i].Count;
+            std::size_t split = box.First;
+            while (split < box.Last - 1 && half * 2 < total) half += entries[split++].Count;
+            split = APE_MAX(split, box.First + 1);
+
+            ColorBox upper = { split, box.Last, 0, 0 };
+            box.Last = split;
+            MeasureBox(entries, box);
+            MeasureBox(entries, upper);
+            boxes.push_back(upper);
+        }
+
+        std::vector<APE::Color> colors;
+        for (const ColorBox& box : boxes) {
+            uint64_t count = 0, sums[3] = {};
+            for (std::size_t i = box.First; i < box.Last; i++) {
+                count += entries[i].Count;
+                for (int c = 0; c < 3; c++) sums[c] += entries[i].Sums[c];
+            }
+            colors.push_back(APE::Color(GetMean(sums[0], count), GetMean(sums[1], count), GetMean(sums[2], count)));
+        }
+        return colors;
+    }
+
+    // Move each palette color to the mean of the entries nearest to it, until nothing move.
+    std::vector<APE::Color> KMeans(const std::vector<ColorEntry>& entries, std::vector<APE::Color> colors) {
+        for (int iteration = 0; iteration < KMeansIterations; iteration++) {
+            APE::Palette palette(colors.data(), colors.size());
+            std::vector<HistogramBin> clusters(colors.size());
+            for (const ColorEntry& entry : entries) {
+                HistogramBin& cluster = clusters[palette.FindNearest(APE::Color((uint8_t)entry.Channels[0], (uint8_t)entry.Channels[1], (uint8_t)entry.Channels[2]))];
+                cluster.Count += entry.Count;
+                for (int c = 0; c < 3; c++) cluster.Sums[c] += entry.Sums[c];
+            }
+
+            bool moved = false;
+            for (std::size_t i = 0; i < colors.size(); i++) {
+                if (clusters[i].Count == 0) continue;
+                APE::Color mean(GetMean(clusters[i].Sums[0], clusters[i].Count), GetMean(clusters[i].Sums[1], clusters[i].Count),
+                                GetMean(clusters[i].Sums[2], clusters[i].Count));
+                moved |= mean != colors[i];
+                colors[i] = mean;
+            }
+            if (!moved) break;
+        }
+        return colors;
+    }
+
+    // Run the strips of rows of an image, on the pool threads if any.
+    void RunStrips(int height, APE::ThreadPool* pool, const std::function<void(std::size_t)>& strip) {
+        std::size_t strips = (std::size_t)((height + APE::Palette::StripHeight - 1) / APE::Palette::StripHeight);
+        if (pool) {
+            pool->Run(strips, strip);
+            return;
+        }
+        for (std::size_t i = 0; i < strips; i++) strip(i);
+    }
+}
+
+//* --- APE::Palette ---
+
+APE::Palette::Palette() { BuildGrid(); }
+APE::Palette::Palette(const APE::Color* colors, std::size_t count) {
+    if (count > MaxColorsCount)
+        throw std::runtime_error("Palette: Too many colors to create!");
+    if (colors) m_colors.assign(colors, colors + count);
+    BuildGrid();
+}
+
+APE::Palette APE::Palette::Build(const APE::Color* pixels, std::size_t count, std::size_t colorsCount, APE::PaletteMethod method, APE::ThreadPool* pool) {
+    if (!pixels || count == 0) return Palette();
+    colorsCount = APE_FAST_CLAMP((std::size_t)1, MaxColorsCount, colorsCount);
+
+    // Each task count its part of the pixels in its own histogram, merged afterward.
+    std::size_t tasks = pool ? APE_MAX((std::size_t)1, APE_MIN(pool->ThreadsCount(), count / MinPixelsPerTask)) : 1;
+    std::vector<std::vector<HistogramBin>> histograms(tasks, std::vector<HistogramBin>(HistogramSize));
+    std::size_t perTask = (count + tasks - 1) / tasks;
+    auto countTask = [&](std::size_t task) {
+        std::size_t first = task * perTask, last = APE_MIN(count, first + perTask);
+        if (first < last) AddToHistogram(pixels + first, last - first, histograms[task]);
+    };
+    if (tasks > 1) pool->Run(tasks, countTask);
+    else countTask(0);
+
+    std::vector<ColorEntry> entries;
+    for (std::size_t i = 0; i < HistogramSize; i++) {
+        ColorEntry entry = { { 0, 0, 0 }, 0, { 0, 0, 0 } };
+        for (std::size_t task = 0; task < tasks; task++) {
+            entry.Count += histograms[task][i].Count;
+            for (int c = 0; c < 3; c++) entry.Sums[c] += histograms[task][i].Sums[c];
+        }
+        if (entry.Count == 0) continue;
+        for (int c = 0; c < 3; c++) entry.Channels[c] = GetMean(entry.Sums[c], entry.Count);
+        entries.push_back(entry);
+    }
+
+    std::vector<Color> colors = MedianCut(entries, colorsCount);
+    if (method == PaletteMethod::KMeans)
+        colors = KMeans(entries, colors);
+    return Palette(colors.data(), colors.size());
+}
+
+std::size_t APE::Palette::GetColorsCount() const { return m_colors.size(); }
+const APE::Color* APE::Palette::GetColors() const { return m_colors.data(); }
+
+void APE::Palette::BuildGrid() {
+    // The nearest color of a color of the cell is at most at the smallest farthest distance of a palette color to
+    // the cell, so only the palette colors whose nearest distance to the cell is under it can be the nearest.
+    // The squared distances along each axis are computed once per slice of cells, then summed per cell.
+    const std::size_t count = m_colors.size();
+    m_candidates.clear();
+    if (count == 0) {
+        m_cellStarts.assign((std::size_t)CellsPerAxis * CellsPerAxis * CellsPerAxis + 1, 0);
+        return;
+    }
+    std::vector<int> nearAxis(3 * CellsPerAxis * count), farAxis(3 * CellsPerAxis * count);
+    for (int axis = 0; axis < 3; axis++) {
+        for (int slice = 0; slice < CellsPerAxis; slice++) {
+            int low = slice * CellSize, high = low + CellSize - 1;
+            int* nearSlice = &nearAxis[(axis * CellsPerAxis + slice) * count];
+            int* farSlice = &farAxis[(axis * CellsPerAxis + slice) * count];
+            for (std::size_t i = 0; i < count; i++) {
+                int value = GetChannel(m_colors[i], axis);
+                int nearest = value < low ? low - value : (value > high ? value - high : 0);
+                int farthest = APE_MAX(APE_ABS(value - low), APE_ABS(value - high));
+                nearSlice[i] = nearest * nearest;
+                farSlice[i] = farthest * farthest;
+            }
+        }
+    }
+
+    m_cellStarts.assign((std::size_t)CellsPerAxis * CellsPerAxis * CellsPerAxis + 1, 0);
+    std::vector<int> nearDistances(count);
+    for (int cell = 0; cell < CellsPerAxis * CellsPerAxis * CellsPerAxis; cell++) {
+        std::size_t slices[3] = { (std::size_t)(cell >> (CellBits * 2)), (std::size_t)((cell >> CellBits) & (CellsPerAxis - 1)),
+                                  (std::size_t)(cell & (CellsPerAxis - 1)) };
+        const int* nearRed = &nearAxis[slices[0] * count];
+        const int* nearGreen = &nearAxis[(CellsPerAxis + slices[1]) * count];
+        const int* nearBlue = &nearAxis[(2 * CellsPerAxis + slices[2]) * count];
+        const int* farRed = &farAxis[slices[0] * count];
+        const int* farGreen = &farAxis[(CellsPerAxis + slices[1]) * count];
+        const int* farBlue = &farAxis[(2 * CellsPerAxis + slices[2]) * count];
+        int bound = 3 * 255 * 255;
+        for (std::size_t i = 0; i < count; i++) {
+            nearDistances[i] = nearRed[i] + nearGreen[i] + nearBlue[i];
+            bound = APE_MIN(bound, farRed[i] + farGreen[i] + farBlue[i]);
+        }
+        for (std::size_t i = 0; i < count; i++)
+            if (nearDistances[i] <= bound) m_candidates.push_back(static_cast<uint8_t>(i));
+        m_cellStarts[cell + 1] = static_cast<uint32_t>(m_candidates.size());
+    }
+}
+
+uint8_t APE::Palette::FindNearest(const APE::Color& color) const {
+    std::size_t cell = ((std::size_t)(color.Red >> (8 - CellBits)) << (CellBits * 2)) |
+                       ((std::size_t)(color.Green >> (8 - CellBits)) << CellBits) | (std::size_t)(color.Blue >> (8 - CellBits));
+    // The candidates are in palette order, so the first one is kept on a tie.
+    uint8_t nearest = 0;
+    int nearestDistance = 3 * 255 * 255 + 1;
+    for (uint32_t i = m_cellStarts[cell]; i < m_cellStarts[cell + 1]; i++) {
+        int distance = GetDistance(m_colors[m_candidates[i]], color.Red, color.Green, color.Blue);
+        if (distance < nearestDistance) {
+            nearestDistance = distance;
+            nearest = m_candidates[i];
+        }
+    }
+    return nearest;
+}
+
+void APE::Palette::Quantize(const APE::Color* pixels, const APE::Size& size, uint8_t* indices, APE::DitherMethod dither, APE::ThreadPool* pool) const {
+    if (m_colors.empty() || !pixels || !indices || size.Width <= 0 || size.Height <= 0) return;
+    const std::size_t width = (std::size_t)size.Width;
+
+    if (dither == DitherMethod::FloydSteinberg) {
+        RunStrips(size.Height, pool, [&](std::size_t strip) {
+            // The errors in 1/16, of the current and next rows, with a column of margin on each side.
+            std::vector<int> current((width + 2) * 3, 0), next((width + 2) * 3, 0);
+            int first = (int)strip * StripHeight, last = APE_MIN(size.Height, first + StripHeight);
+            for (int y = first; y < last; y++) {
+                // Serpentine order, every other row from right to left.
+                bool reverse = ((y - first) & 1) != 0;
+                int step = reverse ? -1 : 1;
+                for (std::size_t i = 0; i < width; i++) {
+                    std::size_t x = reverse ? width - 1 - i : i, offset = (std::size_t)y * width + x;
+                    int* error = &current[(x + 1) * 3];
+                    int channels[3];
+                    for (int c = 0; c < 3; c++)
+                        channels[c] = ClampChannel(GetChannel(pixels[offset], c) + ((error[c] + 8) >> 4));
+
+                    uint8_t index = FindNearest(Color((uint8_t)channels[0], (uint8_t)channels[1], (uint8_t)channels[2]));
+                    indices[offset] = index;
+                    int* ahead = error + step * 3;
+                    int* below = &next[(x + 1) * 3];
+                    for (int c = 0; c < 3; c++) {
+                        int quantError = channels[c] - GetChannel(m_colors[index], c);
+                        ahead[c] += quantError * 7;
+                        below[c - step * 3] += quantError * 3;
+                        below[c] += quantError * 5;
+                        below[c + step * 3] += quantError;
+                    }
+                }
+                current.swap(next);
+                std::fill(next.begin(), next.end(), 0);
+            }
+        });
+        return;
+    }
+
+    // The Bayer thresholds are scaled to the mean spacing of the palette colors along an axis.
+    int offsets[64] = {};
+    if (dither == DitherMethod::Ordered) {
+        float spread = 255.0f / std::cbrt((float)m_colors.size());
+        for (int i = 0; i < 64; i++)
+            offsets[i] = (int)std::lround(((BayerMatrix[i] + 0.5f) / 64.0f - 0.5f) * spread);
+    }
+    RunStrips(size.Height, pool, [&](std::size_t strip) {
+        int first = (int)strip * StripHeight, last = APE_MIN(size.Height, first + StripHeight);
+        for (int y = first; y < last; y++) {
+            const int* rowOffsets = offsets + (y & 7) * 8;
+            for (std::size_t x = 0; x < width; x++) {
+                const Color& pixel = pixels[(std::size_t)y * width + x];
+                int offset = rowOffsets[x & 7];
+                indices[(std::size_t)y * width + x] = FindNearest(Color((uint8_t)ClampChannel(pixel.Red + offset),
+                    (uint8_t)ClampChannel(pixel.Green + offset), (uint8_t)ClampChannel(pixel.Blue + offset)));
+            }
+        }
+    });
+}
+
+void APE::Palette::ToColors(const uint8_t* indices, APE::Color* out, std::size_t count) const {
+    for (std::size_t i = 0; i < count; i++)
+        out[i] = indices[i] < m_colors.size() ? m_colors[indices[i]] : Color::Empty;
+}
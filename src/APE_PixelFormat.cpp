@@ -0,0 +1,201 @@
+#include "APE/APE_PixelFormat.h"
+#include "APE_Color_Span.h"
+
+namespace {
+    bool GetPackedLayout(APE::PixelFormat format, APE::PackedLayout& layout) {
+        switch (format) {
+        case APE::PixelFormat::RGBA8888: layout = { 24, 16, 8, 0, true }; return true;
+        case APE::PixelFormat::ARGB8888: layout = { 16, 8, 0, 24, true }; return true;
+        case APE::PixelFormat::ABGR8888: layout = { 0, 8, 16, 24, true }; return true;
+        case APE::PixelFormat::BGRA8888: layout = { 8, 16, 24, 0, true }; return true;
+        case APE::PixelFormat::XRGB8888: layout = { 16, 8, 0, 24, false }; return true;
+        case APE::PixelFormat::XBGR8888: layout = { 0, 8, 16, 24, false }; return true;
+        default: return false;
+        }
+    }
+
+    // Bit replication, so 0 stay 0 and the maximum become 255.
+    uint8_t Expand5(unsigned value) { return static_cast<uint8_t>((value << 3) | (value >> 2)); }
+    uint8_t Expand6(unsigned value) { return static_cast<uint8_t>((value << 2) | (value >> 4)); }
+}
+
+//* --- APE::PixelConverter ---
+
+int APE::PixelConverter::GetBytesPerPixel(APE::PixelFormat format) {
+    if (format == PixelFormat::RGB565) return 2;
+    PackedLayout layout;
+    return GetPackedLayout(format, layout) ? 4 : 0;
+}
+
+bool APE::PixelConverter::ToPixels(const APE::Color* colors, void* pixels, APE::PixelFormat format, std::size_t count) {
+    if (format == PixelFormat::RGB565) {
+        if (!colors || !pixels) return true;
+        uint16_t* out = static_cast<uint16_t*>(pixels);
+        switch (GetColorKernel()) {
+        case ColorKernel::AVX2: PackColorSpanRGB565AVX2(colors, out, count); break;
+        case ColorKernel::SSE2: PackColorSpanRGB565SSE2(colors, out, count); break;
+        default: PackColorSpanRGB565Scalar(colors, out, count); break;
+        }
+        return true;
+    }
+
+    PackedLayout layout;
+    if (!GetPackedLayout(format, layout)) return false;
+    if (!colors || !pixels) return true;
+    uint32_t* out = static_cast<uint32_t*>(pixels);
+    switch (GetColorKernel()) {
+    case ColorKernel::AVX2: PackColorSpanAVX2(colors, out, layout, count); break;
+    case ColorKernel::SSE2: PackColorSpanSSE2(colors, out, layout, count); break;
+    default: PackColorSpanScalar(colors, out, layout, count); break;
+    }
+    return true;
+}
+bool APE::PixelConverter::ToPixels(const APE::Color* colors, const APE::Size& size, void* pixels, int pitch, APE::PixelFormat format) {
+    int bytesPerPixel = GetBytesPerPixel(format);
+    if (bytesPerPixel == 0 || size.Width < 0 || size.Height < 0 || pitch < size.Width * bytesPerPixel) return false;
+    for (int y = 0; y < size.Height && colors && pixels; y++)
+        ToPixels(colors + (std::size_t)y * size.Width, static_cast<uint8_t*>(pixels) + (std::size_t)y * pitch, format, size.Width);
+    return true;
+}
+
+bool APE::PixelConverter::FromPixels(const void* pixels, APE::PixelFormat format, APE::Color* colors, std::size_t count) {
+    if (format == PixelFormat::RGB565) {
+        if (!pixels || !colors) return true;
+        const uint16_t* in = static_cast<const uint16_t*>(pixels);
+        switch (GetColorKernel()) {
+        case ColorKernel::AVX2: UnpackColorSpanRGB565AVX2(in, colors, count); break;
+        case ColorKernel::SSE2: UnpackColorSpanRGB565SSE2(in, colors, count); break;
+        default: UnpackColorSpanRGB565Scalar(in, colors, count); break;
+        }
+        return true;
+    }
+
+    PackedLayout layout;
+    if (!GetPackedLayout(format, layout)) return false;
+    if (!pixels || !colors) return true;
+    const uint32_t* in = static_cast<const uint32_t*>(pixels);
+    switch (GetColorKernel()) {
+    case ColorKernel::AVX2: UnpackColorSpanAVX2(in, layout, colors, count); break;
+    case ColorKernel::SSE2: UnpackColorSpanSSE2(in, layout, colors, count); break;
+    default: UnpackColorSpanScalar(in, layout, colors, count); break;
+    }
+    return true;
+}
+bool APE::PixelConverter::FromPixels(const void* pixels, int pitch, APE::PixelFormat format, const APE::Size& size, APE::Color* colors) {
+    int bytesPerPixel = GetBytesPerPixel(format);
+    if (bytesPerPixel == 0 || size.Width < 0 || size.Height < 0 || pitch < size.Width * bytesPerPixel) return false;
+    for (int y = 0; y < size.Height && pixels && colors; y++)
+        FromPixels(static_cast<const uint8_t*>(pixels) + (std::size_t)y * pitch, format, colors + (std::size_t)y * size.Width, size.Width);
+    return true;
+}
+
+//* --- APE::PixelConverter kernels ---
+
+// The scalar kernels work on the pixel values, so they are right whatever the byte order of the CPU.
+void APE::PackColorSpanScalar(const APE::Color* colors, uint32_t* pixels, const APE::PackedLayout& layout, std::size_t count) {
+    for (std::size_t i = 0; i < count; i++)
+        pixels[i] = ((uint32_t)colors[i].Red << layout.RedShift) | ((uint32_t)colors[i].Green << layout.GreenShift) |
+                    ((uint32_t)colors[i].Blue << layout.BlueShift) | ((uint32_t)colors[i].Alpha << layout.AlphaShift);
+}
+void APE::UnpackColorSpanScalar(const uint32_t* pixels, const APE::PackedLayout& layout, APE::Color* colors, std::size_t count) {
+    uint32_t alphaMask = layout.HasAlpha ? 0xFF : 0, alphaOpaque = layout.HasAlpha ? 0 : 0xFF;
+    for (std::size_t i = 0; i < count; i++)
+        colors[i] = Color((uint8_t)(pixels[i] >> layout.RedShift), (uint8_t)(pixels[i] >> layout.GreenShift), (uint8_t)(pixels[i] >> layout.BlueShift),
+                          (uint8_t)(((pixels[i] >> layout.AlphaShift) & alphaMask) | alphaOpaque));
+}
+
+void APE::PackColorSpanRGB565Scalar(const APE::Color* colors, uint16_t* pixels, std::size_t count) {
+    for (std::size_t i = 0; i < count; i++)
+        pixels[i] = (uint16_t)(((colors[i].Red >> 3) << 11) | ((colors[i].Green >> 2) << 5) | (colors[i].Blue >> 3));
+}
+void APE::UnpackColorSpanRGB565Scalar(const uint16_t* pixels, APE::Color* colors, std::size_t count) {
+    for (std::size_t i = 0; i < count; i++)
+        colors[i] = Color(Expand5(pixels[i] >> 11), Expand6((pixels[i] >> 5) & 0x3F), Expand5(pixels[i] & 0x1F), 255);
+}
+
+#ifdef APE_COLOR_SSE2
+// SSE2 has no byte shuffle, the channels are moved with masks and shifts on the 32-bit lanes (the colors are
+// loaded as little endian values: red in the lowest byte, alpha in the highest one).
+void APE::PackColorSpanSSE2(const APE::Color* colors, uint32_t* pixels, const APE::PackedLayout& layout, std::size_t count) {
+    const __m128i channelMask = _mm_set1_epi32(0xFF);
+    const __m128i redShift = _mm_cvtsi32_si128((int)layout.RedShift), greenShift = _mm_cvtsi32_si128((int)layout.GreenShift);
+    const __m128i blueShift = _mm_cvtsi32_si128((int)layout.BlueShift), alphaShift = _mm_cvtsi32_si128((int)layout.AlphaShift);
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(colors + i));
+        __m128i r = _mm_sll_epi32(_mm_and_si128(v, channelMask), redShift);
+        __m128i g = _mm_sll_epi32(_mm_and_si128(_mm_srli_epi32(v, 8), channelMask), greenShift);
+        __m128i b = _mm_sll_epi32(_mm_and_si128(_mm_srli_epi32(v, 16), channelMask), blueShift);
+        __m128i a = _mm_sll_epi32(_mm_srli_epi32(v, 24), alphaShift);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pixels + i), _mm_or_si128(_mm_or_si128(r, g), _mm_or_si128(b, a)));
+    }
+    PackColorSpanScalar(colors + i, pixels + i, layout, count - i);
+}
+void APE::UnpackColorSpanSSE2(const uint32_t* pixels, const APE::PackedLayout& layout, APE::Color* colors, std::size_t count) {
+    const __m128i channelMask = _mm_set1_epi32(0xFF);
+    const __m128i alphaMask = _mm_set1_epi32(layout.HasAlpha ? 0xFF : 0), alphaOpaque = _mm_set1_epi32(layout.HasAlpha ? 0 : static_cast<int>(0xFF000000u));
+    const __m128i redShift = _mm_cvtsi32_si128((int)layout.RedShift), greenShift = _mm_cvtsi32_si128((int)layout.GreenShift);
+    const __m128i blueShift = _mm_cvtsi32_si128((int)layout.BlueShift), alphaShift = _mm_cvtsi32_si128((int)layout.AlphaShift);
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + i));
+        __m128i r = _mm_and_si128(_mm_srl_epi32(v, redShift), channelMask);
+        __m128i g = _mm_slli_epi32(_mm_and_si128(_mm_srl_epi32(v, greenShift), channelMask), 8);
+        __m128i b = _mm_slli_epi32(_mm_and_si128(_mm_srl_epi32(v, blueShift), channelMask), 16);
+        __m128i a = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(_mm_srl_epi32(v, alphaShift), alphaMask), 24), alphaOpaque);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(colors + i), _mm_or_si128(_mm_or_si128(r, g), _mm_or_si128(b, a)));
+    }
+    UnpackColorSpanScalar(pixels + i, layout, colors + i, count - i);
+}
+
+void APE::PackColorSpanRGB565SSE2(const APE::Color* colors, uint16_t* pixels, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i packed[2];
+        for (int half = 0; half < 2; half++) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(colors + i + half * 4));
+            __m128i r = _mm_and_si128(_mm_slli_epi32(v, 8), _mm_set1_epi32(0xF800));
+            __m128i g = _mm_and_si128(_mm_srli_epi32(v, 5), _mm_set1_epi32(0x07E0));
+            __m128i b = _mm_and_si128(_mm_srli_epi32(v, 19), _mm_set1_epi32(0x001F));
+            // Sign extended, so the signed saturation of the pack keep the 16 bits.
+            packed[half] = _mm_srai_epi32(_mm_slli_epi32(_mm_or_si128(_mm_or_si128(r, g), b), 16), 16);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pixels + i), _mm_packs_epi32(packed[0], packed[1]));
+    }
+    PackColorSpanRGB565Scalar(colors + i, pixels + i, count - i);
+}
+void APE::UnpackColorSpanRGB565SSE2(const uint16_t* pixels, APE::Color* colors, std::size_t count) {
+    const __m128i zero = _mm_setzero_si128(), alphaOpaque = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + i));
+        for (int half = 0; half < 2; half++) {
+            __m128i p = half ? _mm_unpackhi_epi16(v, zero) : _mm_unpacklo_epi16(v, zero);
+            __m128i r = _mm_srli_epi32(p, 11), g = _mm_and_si128(_mm_srli_epi32(p, 5), _mm_set1_epi32(0x3F));
+            __m128i b = _mm_and_si128(p, _mm_set1_epi32(0x1F));
+            r = _mm_or_si128(_mm_slli_epi32(r, 3), _mm_srli_epi32(r, 2));
+            g = _mm_or_si128(_mm_slli_epi32(g, 2), _mm_srli_epi32(g, 4));
+            b = _mm_or_si128(_mm_slli_epi32(b, 3), _mm_srli_epi32(b, 2));
+            __m128i c = _mm_or_si128(_mm_or_si128(r, _mm_slli_epi32(g, 8)), _mm_or_si128(_mm_slli_epi32(b, 16), alphaOpaque));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(colors + i + half * 4), c);
+        }
+    }
+    UnpackColorSpanRGB565Scalar(pixels + i, colors + i, count - i);
+}
+#else
+void APE::PackColorSpanSSE2(const APE::Color* colors, uint32_t* pixels, const APE::PackedLayout& layout, std::size_t count) {
+    PackColorSpanScalar(colors, pixels, layout, count);
+}
+void APE::UnpackColorSpanSSE2(const uint32_t* pixels, const APE::PackedLayout& layout, APE::Color* colors, std::size_t count) {
+    UnpackColorSpanScalar(pixels, layout, colors, count);
+}
+
+void APE::PackColorSpanRGB565SSE2(const APE::Color* colors, uint16_t* pixels, std::size_t count) {
+    PackColorSpanRGB565Scalar(colors, pixels, count);
+}
+void APE::UnpackColorSpanRGB565SSE2(const uint16_t* pixels, APE::Color* colors, std::size_t count) {
+    UnpackColorSpanRGB565Scalar(pixels, colors, count);
+}
+#endif
@@ -0,0 +1,282 @@
+#include "APE/APE_Profiler.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+
+namespace {
+    enum class EventKind : std::uint8_t { Zone, Counter };
+
+    struct Event {
+        const char* Name;
+        std::uint64_t Start;
+        std::uint64_t End;
+        long long Value;
+        EventKind Kind;
+    };
+
+    // A single producer (the owning thread) single consumer (EndFrame()) ring buffer.
+    struct ThreadBuffer {
+        std::vector<Event> Events;
+        std::atomic<std::size_t> Head;
+        std::atomic<std::size_t> Tail;
+        std::atomic<std::size_t> Dropped;
+        std::size_t ThreadIndex;
+
+        ThreadBuffer(std::size_t threadIndex)
+            : Events(APE::Profiler::BufferCapacity), Head(0), Tail(0), Dropped(0), ThreadIndex(threadIndex) {}
+    };
+
+    struct CapturedEvent {
+        Event Data;
+        std::size_t ThreadIndex;
+    };
+
+    struct ProfilerState {
+        // Guard everything except the buffers content, which is synchronised through their Head and Tail.
+        std::mutex Mutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> Buffers;
+
+        std::uint64_t Origin;
+        std::uint64_t FrameStart;
+        std::size_t FrameIndex = 0;
+        APE::ProfilerFrame LastFrame;
+
+        bool Capturing = false;
+        std::vector<CapturedEvent> CapturedEvents;
+        std::vector<APE::ProfilerFrame> CapturedFrames;
+
+        ProfilerState() : Origin(APE::Profiler::Now()), FrameStart(Origin) {}
+    };
+
+    ProfilerState& GetState() {
+        static ProfilerState state;
+        return state;
+    }
+
+#ifdef APE_ENABLE_PROFILER
+    ThreadBuffer& GetThreadBuffer() {
+        // The buffers are owned by the state, so the events of a finished thread can still be drained.
+        thread_local ThreadBuffer* buffer = nullptr;
+        if (!buffer) {
+            ProfilerState& state = GetState();
+            std::lock_guard<std::mutex> lock(state.Mutex);
+            state.Buffers.emplace_back(new ThreadBuffer(state.Buffers.size() + 1));
+            buffer = state.Buffers.back().get();
+        }
+        return *buffer;
+    }
+
+    void PushEvent(const Event& event) {
+        ThreadBuffer& buffer = GetThreadBuffer();
+        std::size_t head = buffer.Head.load(std::memory_order_relaxed);
+        if (head - buffer.Tail.load(std::memory_order_acquire) >= APE::Profiler::BufferCapacity) {
+            buffer.Dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        buffer.Events[head & (APE::Profiler::BufferCapacity - 1)] = event;
+        buffer.Head.store(head + 1, std::memory_order_release);
+    }
+
+    bool IsSameName(const char* a, const char* b) { return a == b || std::strcmp(a, b) == 0; }
+
+    void AddToFrame(APE::ProfilerFrame& frame, const Event& event) {
+        if (event.Kind == EventKind::Zone) {
+            for (APE::ProfilerZoneStatistics& zone : frame.Zones) {
+                if (!IsSameName(zone.Name, event.Name)) continue;
+                zone.Calls++;
+                zone.Microseconds += (event.End - event.Start) / 1000.0;
+                return;
+            }
+            APE::ProfilerZoneStatistics zone;
+            zone.Name = event.Name;
+            zone.Calls = 1;
+            zone.Microseconds = (event.End - event.Start) / 1000.0;
+            frame.Zones.push_back(zone);
+        } else {
+            for (APE::ProfilerCounterStatistics& counter : frame.Counters) {
+                if (!IsSameName(counter.Name, event.Name)) continue;
+                counter.Total += event.Value;
+                return;
+            }
+            APE::ProfilerCounterStatistics counter;
+            counter.Name = event.Name;
+            counter.Total = event.Value;
+            frame.Counters.push_back(counter);
+        }
+    }
+#endif
+
+    void WriteJSONString(std::ostream& stream, const char* text) {
+        stream << '"';
+        for (const char* c = text; *c; c++) {
+            if (*c == '"' || *c == '\\') stream << '\\' << *c;
+            else if ((unsigned char)*c < 0x20) stream << ' ';
+            else stream << *c;
+        }
+        stream << '"';
+    }
+}
+
+//* --- APE::ProfilerFrame ---
+
+const APE::ProfilerZoneStatistics* APE::ProfilerFrame::FindZone(const std::string& name) const {
+    for (const ProfilerZoneStatistics& zone : Zones)
+        if (name == zone.Name) return &zone;
+    return nullptr;
+}
+const APE::ProfilerCounterStatistics* APE::ProfilerFrame::FindCounter(const std::string& name) const {
+    for (const ProfilerCounterStatistics& counter : Counters)
+        if (name == counter.Name) return &counter;
+    return nullptr;
+}
+
+//* --- APE::Profiler ---
+
+const std::size_t APE::Profiler::BufferCapacity;
+
+bool APE::Profiler::IsEnabled() {
+#ifdef APE_ENABLE_PROFILER
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::uint64_t APE::Profiler::Now() {
+    return (std::uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void APE::Profiler::RecordZone(const char* name, std::uint64_t start, std::uint64_t end) {
+#ifdef APE_ENABLE_PROFILER
+    PushEvent(Event{ name, start, end, 0, EventKind::Zone });
+#else
+    (void)name; (void)start; (void)end;
+#endif
+}
+void APE::Profiler::AddCounter(const char* name, long long value) {
+#ifdef APE_ENABLE_PROFILER
+    std::uint64_t now = Now();
+    PushEvent(Event{ name, now, now, value, EventKind::Counter });
+#else
+    (void)name; (void)value;
+#endif
+}
+
+void APE::Profiler::EndFrame() {
+#ifdef APE_ENABLE_PROFILER
+    std::uint64_t now = Now();
+    ProfilerState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.Mutex);
+
+    ProfilerFrame frame;
+    frame.Index = state.FrameIndex++;
+    frame.StartMicroseconds = (state.FrameStart - state.Origin) / 1000.0;
+    frame.Microseconds = (now - state.FrameStart) / 1000.0;
+    for (std::unique_ptr<ThreadBuffer>& buffer : state.Buffers) {
+        std::size_t head = buffer->Head.load(std::memory_order_acquire);
+        std::size_t tail = buffer->Tail.load(std::memory_order_relaxed);
+        for (; tail != head; tail++) {
+            const Event& event = buffer->Events[tail & (BufferCapacity - 1)];
+            AddToFrame(frame, event);
+            if (state.Capturing)
+                state.CapturedEvents.push_back(CapturedEvent{ event, buffer->ThreadIndex });
+        }
+        buffer->Tail.store(head, std::memory_order_release);
+        frame.DroppedEvents += buffer->Dropped.exchange(0, std::memory_order_relaxed);
+    }
+
+    if (state.Capturing)
+        state.CapturedFrames.push_back(frame);
+    state.LastFrame = std::move(frame);
+    state.FrameStart = now;
+#endif
+}
+
+APE::ProfilerFrame APE::Profiler::GetLastFrame() {
+    ProfilerState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.Mutex);
+    return state.LastFrame;
+}
+
+void APE::Profiler::StartCapture() {
+    ProfilerState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.Mutex);
+    state.CapturedEvents.clear();
+    state.CapturedFrames.clear();
+    state.Capturing = true;
+}
+void APE::Profiler::StopCapture() {
+    ProfilerState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.Mutex);
+    state.Capturing = false;
+}
+bool APE::Profiler::IsCapturing() {
+    ProfilerState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.Mutex);
+    return state.Capturing;
+}
+
+void APE::Profiler::WriteChromeTrace(std::ostream& stream) {
+    ProfilerState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.Mutex);
+
+    std::ios_base::fmtflags flags = stream.flags();
+    std::streamsize precision = stream.precision();
+    stream << std::fixed << std::setprecision(3);
+
+    // The frames have their own track (tid 0), the threads are numbered from 1 in order of first record.
+    stream << "{\"traceEvents\":[\n";
+    stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Frames\"}}";
+    for (const std::unique_ptr<ThreadBuffer>& buffer : state.Buffers)
+        stream << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->ThreadIndex
+               << ",\"args\":{\"name\":\"Thread " << buffer->ThreadIndex << "\"}}";
+
+    for (const ProfilerFrame& frame : state.CapturedFrames) {
+        stream << ",\n{\"name\":\"Frame " << frame.Index << "\",\"cat\":\"Frame\",\"ph\":\"X\",\"pid\":1,\"tid\":0"
+               << ",\"ts\":" << frame.StartMicroseconds << ",\"dur\":" << frame.Microseconds << ",\"args\":{";
+        stream << "\"Dropped events\":" << frame.DroppedEvents;
+        for (const ProfilerZoneStatistics& zone : frame.Zones) {
+            stream << ',';
+            WriteJSONString(stream, (std::string(zone.Name) + " calls").c_str());
+            stream << ':' << zone.Calls << ',';
+            WriteJSONString(stream, (std::string(zone.Name) + " us").c_str());
+            stream << ':' << zone.Microseconds;
+        }
+        for (const ProfilerCounterStatistics& counter : frame.Counters) {
+            stream << ',';
+            WriteJSONString(stream, counter.Name);
+            stream << ':' << counter.Total;
+        }
+        stream << "}}";
+    }
+
+    for (const CapturedEvent& captured : state.CapturedEvents) {
+        const Event& event = captured.Data;
+        // A zone may have started just before the state was created, so the difference is signed.
+        double start = (long long)(event.Start - state.Origin) / 1000.0;
+        stream << ",\n{\"name\":";
+        WriteJSONString(stream, event.Name);
+        if (event.Kind == EventKind::Zone)
+            stream << ",\"cat\":\"APE\",\"ph\":\"X\",\"pid\":1,\"tid\":" << captured.ThreadIndex
+                   << ",\"ts\":" << start << ",\"dur\":" << (event.End - event.Start) / 1000.0 << '}';
+        else
+            stream << ",\"ph\":\"C\",\"pid\":1,\"tid\":" << captured.ThreadIndex
+                   << ",\"ts\":" << start << ",\"args\":{\"value\":" << event.Value << "}}";
+    }
+    stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    stream.flags(flags);
+    stream.precision(precision);
+}
+bool APE::Profiler::SaveChromeTrace(const std::string& path) {
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file) return false;
+    WriteChromeTrace(file);
+    return (bool)file;
+}
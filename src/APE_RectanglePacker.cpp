@@ -0,0 +1,88 @@
+#include "APE/APE_RectanglePacker.h"
+#include "APE/APE_Define.h"
+
+#include <climits>
+#include <stdlib.h>
+
+//* --- APE::SkylinePacker ---
+
+APE::SkylinePacker::SkylinePacker(const APE::Size& size) : m_size(size.Absolute()) {
+    Clear();
+}
+
+int APE::SkylinePacker::Fit(std::size_t index, int width, int height) const {
+    int x = m_skyline[index].X;
+    if (x + width > m_size.Width) return -1;
+
+    // The rectangle rest on the highest node it span over.
+    int y = 0, width_left = width;
+    for (std::size_t i = index; width_left > 0; i++) {
+        y = APE_MAX(y, m_skyline[i].Y);
+        if (y + height > m_size.Height) return -1;
+        width_left -= m_skyline[i].Width;
+    }
+    return y;
+}
+
+bool APE::SkylinePacker::Insert(const APE::Size& size, APE::Rectangle& result) {
+    int width = abs(size.Width), height = abs(size.Height);
+    if (width == 0 || height == 0 || width > m_size.Width || height > m_size.Height)
+        return false;
+
+    // Find the position with the lowest top side, prefer the narrowest node on ties.
+    std::size_t best_index = m_skyline.size();
+    int best_top = INT_MAX, best_width = INT_MAX, best_y = 0;
+    for (std::size_t i = 0; i < m_skyline.size(); i++) {
+        int y = Fit(i, width, height);
+        if (y < 0) continue;
+        if (y + height < best_top || (y + height == best_top && m_skyline[i].Width < best_width)) {
+            best_index = i;
+            best_top = y + height;
+            best_width = m_skyline[i].Width;
+            best_y = y;
+        }
+    }
+    if (best_index == m_skyline.size())
+        return false;
+
+    // Raise the skyline over the new rectangle, then shrink or remove the nodes it covered.
+    SkylineNode node = { m_skyline[best_index].X, best_y + height, width };
+    m_skyline.insert(m_skyline.begin() + best_index, node);
+    for (std::size_t i = best_index + 1; i < m_skyline.size();) {
+        int right = m_skyline[i - 1].X + m_skyline[i - 1].Width;
+        if (m_skyline[i].X >= right) break;
+
+        int shrink = right - m_skyline[i].X;
+        if (m_skyline[i].Width > shrink) {
+            m_skyline[i].X += shrink;
+            m_skyline[i].Width -= shrink;
+            break;
+        }
+        m_skyline.erase(m_skyline.begin() + i);
+    }
+
+    // Merge the neighbours that ended up at the same height.
+    for (std::size_t i = 0; i + 1 < m_skyline.size();) {
+        if (m_skyline[i].Y == m_skyline[i + 1].Y) {
+            m_skyline[i].Width += m_skyline[i + 1].Width;
+            m_skyline.erase(m_skyline.begin() + i + 1);
+        }
+        else i++;
+    }
+
+    m_usedArea += (long long)width * height;
+    result = Rectangle(node.X, best_y, width, height);
+    return true;
+}
+
+void APE::SkylinePacker::Clear() {
+    m_usedArea = 0;
+    m_skyline.clear();
+    if (!m_size.IsEmptyArea())
+        m_skyline.push_back(SkylineNode{ 0, 0, m_size.Width });
+}
+
+APE::Size APE::SkylinePacker::GetSize() const { return m_size; }
+double APE::SkylinePacker::GetOccupancy() const {
+    return m_size.IsEmptyArea() ? 0 : (double)m_usedArea / (double)m_size.Area();
+}
@@ -1,32 +1,94 @@
 #include "APE/APE_Renderer.h"
 #include "APE/APE_Color.h"
+#include <cmath>
 #include <stdexcept>
 
+APE::Rectangle APE::GetPixelBounds(double left, double top, double right, double bottom) {
+    // Keep the bounds far from the int limits, so Width / Height and the inclusive sides can't overflow.
+    static const double Limit = 1 << 29;
+    int minX = (int)std::floor(APE_CLAMP(-Limit, Limit, left));
+    int minY = (int)std::floor(APE_CLAMP(-Limit, Limit, top));
+    int maxX = (int)std::ceil(APE_CLAMP(-Limit, Limit, right));
+    int maxY = (int)std::ceil(APE_CLAMP(-Limit, Limit, bottom));
+    return APE::Rectangle(minX, minY, maxX - minX + 1, maxY - minY + 1);
+}
+
 //* --- APE::Sprite ---
 
+APE::Sprite::Sprite(const APE::Sprite& sprite)
+    : m_vertices(sprite.m_vertices), m_triangles(sprite.m_triangles),
+      m_revision(sprite.m_revision), m_renderCacheEnabled(sprite.m_renderCacheEnabled) {}
+
+APE::Sprite& APE::Sprite::operator=(const APE::Sprite& sprite) {
+    if (this == &sprite) return *this;
+    m_vertices = sprite.m_vertices;
+    m_triangles = sprite.m_triangles;
+    m_renderCacheEnabled = sprite.m_renderCacheEnabled;
+    m_renderCache.reset();
+    m_revision++;
+    return *this;
+}
+
 void APE::Sprite::AddVertex(const APE::Vertex& vertex) {
     m_vertices.push_back(vertex);
+    m_revision++;
 }
 
 void APE::Sprite::AddTriangle(std::size_t i0, std::size_t i1, std::size_t i2) {
     m_triangles.push_back(i0);
     m_triangles.push_back(i1);
     m_triangles.push_back(i2);
+    m_revision++;
 }
 
 void APE::Sprite::Clear() {
     m_vertices.clear();
     m_triangles.clear();
+    m_revision++;
 }
 
 std::size_t APE::Sprite::VerticesCount() const { return m_vertices.size(); }
 std::size_t APE::Sprite::TrianglesCount() const { return m_triangles.size(); }
 
 const std::vector<APE::Vertex>& APE::Sprite::GetVertices() const { return m_vertices; }
-std::vector<APE::Vertex>& APE::Sprite::GetVertices() { return m_vertices; }
+std::vector<APE::Vertex>& APE::Sprite::GetVertices() { m_revision++; return m_vertices; }
 
 const std::vector<std::size_t>& APE::Sprite::GetTriangles() const { return m_triangles; }
-std::vector<std::size_t>& APE::Sprite::GetTriangles() { return m_triangles; }
+std::vector<std::size_t>& APE::Sprite::GetTriangles() { m_revision++; return m_triangles; }
+
+std::size_t APE::Sprite::GetRevision() const { return m_revision; }
+
+APE::Rectangle APE::Sprite::GetBounds() const {
+    if (m_boundsValid && m_boundsRevision == m_revision) return m_bounds;
+
+    if (m_vertices.empty()) m_bounds = APE::Rectangle::Empty;
+    else {
+        APE::Vector2 min = m_vertices[0].Position, max = min;
+        for (const APE::Vertex& vertex : m_vertices) {
+            min.X = APE_MIN(min.X, vertex.Position.X);
+            min.Y = APE_MIN(min.Y, vertex.Position.Y);
+            max.X = APE_MAX(max.X, vertex.Position.X);
+            max.Y = APE_MAX(max.Y, vertex.Position.Y);
+        }
+        m_bounds = APE::GetPixelBounds(min.X, min.Y, max.X, max.Y);
+    }
+    m_boundsValid = true;
+    m_boundsRevision = m_revision;
+    return m_bounds;
+}
+
+void APE::Sprite::EnableRenderCache() { m_renderCacheEnabled = true; }
+void APE::Sprite::DisableRenderCache() {
+    m_renderCacheEnabled = false;
+    m_renderCache.reset();
+}
+bool APE::Sprite::IsRenderCacheEnabled() const { return m_renderCacheEnabled; }
+
+APE::ISpriteCache* APE::Sprite::GetRenderCache() const { return m_renderCache.get(); }
+void APE::Sprite::SetRenderCache(std::unique_ptr<APE::ISpriteCache> cache) const {
+    if (m_renderCacheEnabled)
+        m_renderCache = std::move(cache);
+}
 
 
 //* --- APE::IRenderer ---
@@ -0,0 +1,123 @@
+#include "APE/APE_Tessellator.h"
+#include "APE/APE_Define.h"
+
+#include <cmath>
+#include <stdlib.h>
+
+// The maximum distance between a curve and its segments, in pixels.
+static const double CurveTolerance = 0.125;
+static const int MinSegments = 8;
+static const int MaxSegments = 1024;
+static const double Pi = 3.14159265358979323846;
+
+//* --- APE::Tessellator ---
+
+int APE::Tessellator::GetSegmentsCount(double radius) {
+    if (!(radius > CurveTolerance)) return MinSegments;
+    // A segment of angle a is at most radius * (1 - cos(a / 2)) away from the curve.
+    double segments = std::ceil(Pi / std::acos(1.0 - CurveTolerance / radius));
+    if (!(segments < MaxSegments)) return MaxSegments;
+    int count = (static_cast<int>(segments) + 3) / 4 * 4;
+    return APE_MAX(count, MinSegments);
+}
+const std::vector<APE::Vector2>& APE::Tessellator::GetUnitCircle(int segments) {
+    segments = APE_CLAMP(MinSegments, MaxSegments, (segments + 3) / 4 * 4);
+    std::size_t index = static_cast<std::size_t>(segments / 4);
+    if (index >= m_unitCircles.size())
+        m_unitCircles.resize(index + 1);
+
+    std::vector<Vector2>& circle = m_unitCircles[index];
+    if (circle.empty()) {
+        circle.resize(segments);
+        for (int i = 0; i < segments; i++) {
+            double angle = 2.0 * Pi * i / segments;
+            circle[i] = Vector2(std::cos(angle), std::sin(angle));
+        }
+        // Make the quarter points exact, so the rounded corners meet the straight sides.
+        int quarter = segments / 4;
+        circle[0] = Vector2(1, 0); circle[quarter] = Vector2(0, 1);
+        circle[2 * quarter] = Vector2(-1, 0); circle[3 * quarter] = Vector2(0, -1);
+    }
+    return circle;
+}
+
+void APE::Tessellator::EllipsePath(std::vector<APE::Vector2>& path, const APE::Vector2& center, double radiusX, double radiusY, int segments) {
+    const std::vector<Vector2>& circle = GetUnitCircle(segments);
+    path.resize(circle.size());
+    for (std::size_t i = 0; i < circle.size(); i++)
+        path[i] = Vector2(center.X + circle[i].X * radiusX, center.Y + circle[i].Y * radiusY);
+}
+void APE::Tessellator::RoundedRectanglePath(std::vector<APE::Vector2>& path, double left, double top, double right, double bottom, double radius, int segments) {
+    const std::vector<Vector2>& circle = GetUnitCircle(segments);
+    int quarter = static_cast<int>(circle.size()) / 4;
+    // The corners in the circle order: bottom-right, bottom-left, top-left, top-right.
+    const double centerX[4] = { right - radius, left + radius, left + radius, right - radius };
+    const double centerY[4] = { bottom - radius, bottom - radius, top + radius, top + radius };
+
+    path.resize(4 * (quarter + 1));
+    std::size_t n = 0;
+    for (int corner = 0; corner < 4; corner++)
+        for (int i = 0; i <= quarter; i++) {
+            const Vector2& p = circle[(corner * quarter + i) % circle.size()];
+            path[n++] = Vector2(centerX[corner] + p.X * radius, centerY[corner] + p.Y * radius);
+        }
+}
+void APE::Tessellator::AppendFan(APE::Sprite& sprite, const std::vector<APE::Vector2>& path, const APE::Color& color) {
+    // Fan from the first point of the path rather than the center: the center of a pixel-centered shape is
+    // a pixel center, where every triangle meet and rounding could cover the pixel twice.
+    std::size_t first = sprite.VerticesCount();
+    for (const Vector2& p : path)
+        sprite.AddVertex(Vertex(p, color, Vector2::Zero));
+    for (std::size_t i = 1; i + 1 < path.size(); i++)
+        sprite.AddTriangle(first, first + i, first + i + 1);
+}
+void APE::Tessellator::AppendRing(APE::Sprite& sprite, const std::vector<APE::Vector2>& outer, const std::vector<APE::Vector2>& inner, const APE::Color& color) {
+    std::size_t first = sprite.VerticesCount(), count = outer.size();
+    for (std::size_t i = 0; i < count; i++) {
+        sprite.AddVertex(Vertex(outer[i], color, Vector2::Zero));
+        sprite.AddVertex(Vertex(inner[i], color, Vector2::Zero));
+    }
+    for (std::size_t i = 0; i < count; i++) {
+        std::size_t o0 = first + 2 * i, i0 = o0 + 1;
+        std::size_t o1 = first + 2 * ((i + 1) % count), i1 = o1 + 1;
+        sprite.AddTriangle(o0, o1, i1);
+        sprite.AddTriangle(o0, i1, i0);
+    }
+}
+
+void APE::Tessellator::AppendFilledEllipse(APE::Sprite& sprite, const APE::Vector2& center, double radiusX, double radiusY, const APE::Color& color) {
+    radiusX = fabs(radiusX); radiusY = fabs(radiusY);
+    if (radiusX == 0 || radiusY == 0) return;
+    EllipsePath(m_outerPath, center, radiusX, radiusY, GetSegmentsCount(APE_MAX(radiusX, radiusY)));
+    AppendFan(sprite, m_outerPath, color);
+}
+void APE::Tessellator::AppendEllipseOutline(APE::Sprite& sprite, const APE::Vector2& center, double radiusX, double radiusY, double thickness, const APE::Color& color) {
+    radiusX = fabs(radiusX); radiusY = fabs(radiusY);
+    if (radiusX == 0 || radiusY == 0 || !(thickness > 0)) return;
+    double half = thickness / 2;
+    int segments = GetSegmentsCount(APE_MAX(radiusX, radiusY) + half);
+    EllipsePath(m_outerPath, center, radiusX + half, radiusY + half, segments);
+    EllipsePath(m_innerPath, center, APE_MAX(radiusX - half, 0.0), APE_MAX(radiusY - half, 0.0), segments);
+    AppendRing(sprite, m_outerPath, m_innerPath, color);
+}
+void APE::Tessellator::AppendFilledRoundedRectangle(APE::Sprite& sprite, const APE::Rectangle& area, double radius, const APE::Color& color) {
+    if (area.IsEmptyArea()) return;
+    double left = area.LeftSide(), top = area.TopSide(), right = left + abs(area.Width), bottom = top + abs(area.Height);
+    radius = APE_CLAMP(0.0, APE_MIN(right - left, bottom - top) / 2, radius);
+
+    RoundedRectanglePath(m_outerPath, left, top, right, bottom, radius, GetSegmentsCount(radius));
+    AppendFan(sprite, m_outerPath, color);
+}
+void APE::Tessellator::AppendRoundedRectangleOutline(APE::Sprite& sprite, const APE::Rectangle& area, double radius, double thickness, const APE::Color& color) {
+    if (area.IsEmptyArea() || !(thickness > 0)) return;
+    double left = area.LeftSide(), top = area.TopSide(), right = left + abs(area.Width), bottom = top + abs(area.Height);
+    double maxRadius = APE_MIN(right - left, bottom - top) / 2;
+    radius = APE_CLAMP(0.0, maxRadius, radius);
+    thickness = APE_MIN(thickness, maxRadius);
+
+    int segments = GetSegmentsCount(radius);
+    RoundedRectanglePath(m_outerPath, left, top, right, bottom, radius, segments);
+    RoundedRectanglePath(m_innerPath, left + thickness, top + thickness, right - thickness, bottom - thickness,
+                         APE_MAX(radius - thickness, 0.0), segments);
+    AppendRing(sprite, m_outerPath, m_innerPath, color);
+}
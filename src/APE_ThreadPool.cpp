@@ -0,0 +1,67 @@
+#include "APE/APE_ThreadPool.h"
+
+//* --- APE::ThreadPool ---
+
+APE::ThreadPool::ThreadPool(std::size_t threadsCount) : m_nextTask(0) {
+    if (threadsCount == 0)
+        threadsCount = APE_MAX(1u, std::thread::hardware_concurrency());
+    for (std::size_t i = 1; i < threadsCount; i++)
+        m_workers.emplace_back(&ThreadPool::WorkerLoop, this);
+}
+APE::ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wakeCondition.notify_all();
+    for (std::thread& worker : m_workers)
+        worker.join();
+}
+
+void APE::ThreadPool::WorkerLoop() {
+    std::size_t generation = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wakeCondition.wait(lock, [&]() { return m_stop || m_generation != generation; });
+            if (m_stop) return;
+            generation = m_generation;
+        }
+        RunTasks();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (--m_busyWorkers == 0)
+                m_doneCondition.notify_one();
+        }
+    }
+}
+void APE::ThreadPool::RunTasks() {
+    std::size_t index;
+    while ((index = m_nextTask.fetch_add(1, std::memory_order_relaxed)) < m_tasksCount)
+        (*m_task)(index);
+}
+
+std::size_t APE::ThreadPool::ThreadsCount() const { return m_workers.size() + 1; }
+
+void APE::ThreadPool::Run(std::size_t tasksCount, const std::function<void(std::size_t)>& task) {
+    if (tasksCount == 0) return;
+    if (tasksCount == 1 || m_workers.empty()) {
+        for (std::size_t i = 0; i < tasksCount; i++) task(i);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task = &task;
+        m_tasksCount = tasksCount;
+        m_nextTask.store(0, std::memory_order_relaxed);
+        m_busyWorkers = m_workers.size();
+        m_generation++;
+    }
+    m_wakeCondition.notify_all();
+    RunTasks();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_doneCondition.wait(lock, [&]() { return m_busyWorkers == 0; });
+    m_task = nullptr;
+}
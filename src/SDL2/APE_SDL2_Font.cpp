@@ -0,0 +1,190 @@
+#include "APE/SDL2/APE_SDL2_Font.h"
+
+#include <cstring>
+#include <stdexcept>
+
+// Decode the next UTF-8 character of the given text, advancing the index. Invalid sequences (bad lead bytes,
+// overlong encodings, surrogates and code points above U+10FFFF) decode as U+FFFD, and the decoding resume at
+// the first byte that isn't part of the valid start of the sequence.
+static uint32_t DecodeUTF8(const std::string& text, std::size_t& index) {
+    unsigned char c = static_cast<unsigned char>(text[index++]);
+    if (c < 0x80) return c;
+
+    // The range of the second byte is narrowed for the leads that could start an invalid sequence, so they
+    // are rejected before reading the rest of it (as the Unicode standard recommend).
+    int length = 0;
+    unsigned char low = 0x80, high = 0xBF;
+    if (c >= 0xC2 && c <= 0xDF) length = 1;
+    else if (c >= 0xE0 && c <= 0xEF) {
+        length = 2;
+        if (c == 0xE0) low = 0xA0;
+        else if (c == 0xED) high = 0x9F;
+    } else if (c >= 0xF0 && c <= 0xF4) {
+        length = 3;
+        if (c == 0xF0) low = 0x90;
+        else if (c == 0xF4) high = 0x8F;
+    } else return 0xFFFD;
+
+    uint32_t codepoint = c & (0x3F >> length);
+    for (int i = 0; i < length; i++) {
+        if (index >= text.size()) return 0xFFFD;
+        unsigned char next = static_cast<unsigned char>(text[index]);
+        if (next < low || next > high) return 0xFFFD;
+        codepoint = (codepoint << 6) | (next & 0x3F);
+        index++;
+        low = 0x80;
+        high = 0xBF;
+    }
+    return codepoint;
+}
+
+//* --- APE::SDL2::SDL2Font ---
+
+APE::SDL2::SDL2Font::SDL2Font(SDL2Renderer* renderer, const std::string& path, int pointSize, const APE::Size& atlasPageSize)
+    : m_atlas(renderer, atlasPageSize) {
+    if (!TTF_WasInit() && TTF_Init() != 0)
+        throw std::runtime_error("SDL2Font: Failed to initialize SDL2_ttf!");
+
+    m_data = TTF_OpenFont(path.c_str(), pointSize);
+    if (!m_data)
+        throw std::runtime_error("SDL2Font: Failed to load the font '" + path + "'!");
+    m_lineSkip = TTF_FontLineSkip(m_data);
+}
+APE::SDL2::SDL2Font::~SDL2Font() {
+    if (m_data)
+        TTF_CloseFont(m_data);
+}
+
+const APE::SDL2::SDL2Glyph* APE::SDL2::SDL2Font::GetGlyph(uint32_t codepoint) {
+    auto it = m_glyphs.find(codepoint);
+    if (it != m_glyphs.end()) return &it->second;
+    if (!m_data || !TTF_GlyphIsProvided32(m_data, codepoint)) return nullptr;
+
+    SDL2Glyph glyph;
+    int min_x = 0, max_x = 0, min_y = 0, max_y = 0;
+    TTF_GlyphMetrics32(m_data, codepoint, &min_x, &max_x, &min_y, &max_y, &glyph.Advance);
+
+    // Rasterise in white, the text color is applied by the vertex color.
+    SDL_Surface* rendered = TTF_RenderGlyph32_Blended(m_data, codepoint, SDL_Color{ 255, 255, 255, 255 });
+    SDL_Surface* surface = rendered ? SDL_ConvertSurfaceFormat(rendered, SDL_PIXELFORMAT_RGBA32, 0) : nullptr;
+    if (rendered) SDL_FreeSurface(rendered);
+
+    if (surface && surface->w > 0 && surface->h > 0 && max_x > min_x) {
+        std::vector<Color> pixels((std::size_t)surface->w * surface->h);
+        SDL_LockSurface(surface);
+        for (int y = 0; y < surface->h; y++)
+            std::memcpy(&pixels[(std::size_t)y * surface->w],
+                static_cast<const uint8_t*>(surface->pixels) + (std::size_t)y * surface->pitch,
+                (std::size_t)surface->w * sizeof(Color));
+        SDL_UnlockSurface(surface);
+
+        if (m_atlas.AddPixels(Size(surface->w, surface->h), pixels.data(), glyph.Region))
+            glyph.ImageSize = Size(surface->w, surface->h);
+    }
+    if (surface) SDL_FreeSurface(surface);
+
+    return &(m_glyphs[codepoint] = glyph);
+}
+int APE::SDL2::SDL2Font::GetLineSkip() const { return m_lineSkip; }
+const APE::SDL2::SDL2TextureAtlas& APE::SDL2::SDL2Font::GetAtlas() const { return m_atlas; }
+
+APE::Size APE::SDL2::SDL2Font::MeasureText(const std::string& text) {
+    if (text.empty()) return Size::Zero;
+    int width = 0, line_width = 0, lines = 1;
+    uint32_t previous = 0;
+    for (std::size_t i = 0; i < text.size();) {
+        uint32_t codepoint = DecodeUTF8(text, i);
+        if (codepoint == '\n') {
+            width = APE_MAX(width, line_width);
+            line_width = 0;
+            previous = 0;
+            lines++;
+            continue;
+        }
+        const SDL2Glyph* glyph = GetGlyph(codepoint);
+        if (!glyph) continue;
+        if (previous) line_width += TTF_GetFontKerningSizeGlyphs32(m_data, previous, codepoint);
+        line_width += glyph->Advance;
+        previous = codepoint;
+    }
+    return Size(APE_MAX(width, line_width), lines * m_lineSkip);
+}
+
+void APE::SDL2::SDL2Font::BuildText(const std::string& text, const APE::Point& position, const APE::Color& color, std::vector<CompactSprite32>& pages) {
+    for (CompactSprite32& page : pages)
+        page.Clear();
+
+    Point pen = position;
+    uint32_t previous = 0;
+    for (std::size_t i = 0; i < text.size();) {
+        uint32_t codepoint = DecodeUTF8(text, i);
+        if (codepoint == '\n') {
+            pen = Point(position.X, pen.Y + m_lineSkip);
+            previous = 0;
+            continue;
+        }
+        const SDL2Glyph* glyph = GetGlyph(codepoint);
+        if (!glyph) continue;
+        if (previous) pen.X += TTF_GetFontKerningSizeGlyphs32(m_data, previous, codepoint);
+        previous = codepoint;
+
+        if (!glyph->ImageSize.IsEmptyArea()) {
+            if (pages.size() <= glyph->Region.Page)
+                pages.resize(glyph->Region.Page + 1);
+            CompactSprite32& page = pages[glyph->Region.Page];
+
+            // The glyph image cover the whole line height, so its top-left is at the pen position.
+            float left = (float)pen.X, top = (float)pen.Y;
+            float right = left + glyph->ImageSize.Width, bottom = top + glyph->ImageSize.Height;
+            float u0 = (float)glyph->Region.TopLeft.X, v0 = (float)glyph->Region.TopLeft.Y;
+            float u1 = (float)glyph->Region.BottomRight.X, v1 = (float)glyph->Region.BottomRight.Y;
+
+            uint32_t first = static_cast<uint32_t>(page.VerticesCount());
+            page.AddVertex(CompactVertex(left, top, color, u0, v0));
+            page.AddVertex(CompactVertex(right, top, color, u1, v0));
+            page.AddVertex(CompactVertex(right, bottom, color, u1, v1));
+            page.AddVertex(CompactVertex(left, bottom, color, u0, v1));
+            page.AddTriangle(first, first + 1, first + 2);
+            page.AddTriangle(first, first + 2, first + 3);
+        }
+        pen.X += glyph->Advance;
+    }
+}
+
+//* --- APE::SDL2::SDL2Text ---
+
+APE::SDL2::SDL2Text::SDL2Text(SDL2Font* font, const std::string& text) : m_font(font), m_text(text) {
+    if (!font)
+        throw std::runtime_error("SDL2Text: Invalid SDL2Font to create!");
+}
+
+const std::string& APE::SDL2::SDL2Text::GetText() const { return m_text; }
+void APE::SDL2::SDL2Text::SetText(const std::string& text) {
+    if (text == m_text) return;
+    m_text = text;
+    m_dirty = true;
+}
+
+APE::Point APE::SDL2::SDL2Text::GetPosition() const { return m_position; }
+void APE::SDL2::SDL2Text::SetPosition(const APE::Point& position) {
+    if (position == m_position) return;
+    m_position = position;
+    m_dirty = true;
+}
+
+APE::Color APE::SDL2::SDL2Text::GetColor() const { return m_color; }
+void APE::SDL2::SDL2Text::SetColor(const APE::Color& color) {
+    if (color == m_color) return;
+    m_color = color;
+    m_dirty = true;
+}
+
+void APE::SDL2::SDL2Text::Render(SDL2Renderer& renderer) {
+    if (m_dirty) {
+        m_font->BuildText(m_text, m_position, m_color, m_pages);
+        m_dirty = false;
+    }
+    for (std::size_t i = 0; i < m_pages.size(); i++)
+        if (m_pages[i].TrianglesCount() > 0)
+            renderer.RenderSprite(m_pages[i], m_font->GetAtlas().GetPage(i));
+}
@@ -0,0 +1,56 @@
+#include "APE/SDL2/APE_SDL2_RenderTarget.h"
+
+#include <stdexcept>
+
+//* --- APE::SDL2::SDL2RenderTarget ---
+
+APE::SDL2::SDL2RenderTarget::SDL2RenderTarget(SDL2Renderer* renderer, const APE::Size& size) {
+    if (!renderer || !renderer->m_data)
+        throw std::runtime_error("SDL2RenderTarget: Invalid SDL2Renderer to create!");
+    if (size.Width <= 0 || size.Height <= 0)
+        throw std::runtime_error("SDL2RenderTarget: Invalid size to create!");
+    if (SDL_RenderTargetSupported(renderer->m_data) != SDL_TRUE)
+        throw std::runtime_error("SDL2RenderTarget: Render targets are not supported by the renderer!");
+
+    m_data = SDL_CreateTexture(renderer->m_data, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, size.Width, size.Height);
+    if (!m_data)
+        throw std::runtime_error("SDL2RenderTarget: Failed to create the texture!");
+    m_renderer = renderer;
+    m_size = size;
+    SDL_SetTextureBlendMode(m_data, SDL_BLENDMODE_BLEND);
+}
+APE::SDL2::SDL2RenderTarget::~SDL2RenderTarget() {
+    if (m_recording)
+        EndRecord();
+    if (m_data)
+        SDL_DestroyTexture(m_data);
+}
+
+APE::Size APE::SDL2::SDL2RenderTarget::GetSize() const { return m_size; }
+
+APE::SDL2::SDL2DrawBlendMode APE::SDL2::SDL2RenderTarget::GetBlendMode() const {
+    if (!m_data) return SDL2DrawBlendMode::Invalid;
+    SDL_BlendMode tmp = SDL_BLENDMODE_INVALID;
+    SDL_GetTextureBlendMode(m_data, &tmp);
+    return static_cast<SDL2DrawBlendMode>(tmp);
+}
+void APE::SDL2::SDL2RenderTarget::SetBlendMode(SDL2DrawBlendMode blendMode) {
+    if (m_data)
+        SDL_SetTextureBlendMode(m_data, static_cast<SDL_BlendMode>(blendMode));
+}
+
+bool APE::SDL2::SDL2RenderTarget::IsValid() const { return m_valid; }
+void APE::SDL2::SDL2RenderTarget::Invalidate() { m_valid = false; }
+
+bool APE::SDL2::SDL2RenderTarget::BeginRecord(const APE::Color& clearColor) {
+    if (!m_data || m_recording || !m_renderer->PushRenderTarget(*this)) return false;
+    m_recording = true;
+    m_renderer->Clear(clearColor);
+    return true;
+}
+void APE::SDL2::SDL2RenderTarget::EndRecord() {
+    if (!m_recording || !m_renderer->PopRenderTarget(*this)) return;
+    m_recording = false;
+    m_valid = true;
+}
+bool APE::SDL2::SDL2RenderTarget::IsRecording() const { return m_recording; }
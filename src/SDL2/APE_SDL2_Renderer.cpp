@@ -1,10 +1,19 @@
 #include "APE/SDL2/APE_SDL2_Renderer.h"
+#include "APE/APE_Profiler.h"
+#include "APE/SDL2/APE_SDL2_RenderTarget.h"
+#include "APE/SDL2/APE_SDL2_Texture.h"
 #include "SDL_video.h"
 
 #include <algorithm>
+#include <cstddef>
 #include <stdexcept>
 #include <SDL2/SDL_render.h>
-#include <SDL2/SDL2_gfxPrimitives.h>
+
+// The compact vertex layout must match SDL_Vertex, so it can be submitted without conversion.
+static_assert(sizeof(APE::CompactVertex) == sizeof(SDL_Vertex), "CompactVertex must be layout-compatible with SDL_Vertex!");
+static_assert(offsetof(APE::CompactVertex, X) == offsetof(SDL_Vertex, position), "CompactVertex must be layout-compatible with SDL_Vertex!");
+static_assert(offsetof(APE::CompactVertex, Color) == offsetof(SDL_Vertex, color), "CompactVertex must be layout-compatible with SDL_Vertex!");
+static_assert(offsetof(APE::CompactVertex, U) == offsetof(SDL_Vertex, tex_coord), "CompactVertex must be layout-compatible with SDL_Vertex!");
 
 //* --- APE::SDL2::SDL2Renderer ---
 
@@ -22,21 +31,250 @@ APE::SDL2::SDL2Renderer::SDL2Renderer(SDL2Window* window) {
         throw std::runtime_error("SDL2Renderer: An SDL2Window can only have one renderer!");
 
     m_data = SDL_CreateRenderer(sdl_window, -1, SDL_RENDERER_ACCELERATED);
+    ResetStateCache();
 }
 APE::SDL2::SDL2Renderer::~SDL2Renderer() {
     if (m_data)
         SDL_DestroyRenderer(m_data);
 }
 
+APE::SDL2::SDL2Renderer::PrimitiveRun& APE::SDL2::SDL2Renderer::GetPrimitiveRun(PrimitiveKind kind, std::size_t first) {
+    FlushSprites();
+
+    const SDL_Color& color = m_drawColor;
+    m_frameStatistics.BatchedPrimitives++;
+
+    if (!m_primitiveRuns.empty()) {
+        PrimitiveRun& last = m_primitiveRuns.back();
+        if (last.Kind == kind &&
+            last.Color.r == color.r && last.Color.g == color.g && last.Color.b == color.b && last.Color.a == color.a)
+            return last;
+    }
+    EnsureCapacity(m_primitiveRuns, m_primitiveRuns.size() + 1);
+    m_primitiveRuns.push_back(PrimitiveRun{ kind, color, first, 0 });
+    return m_primitiveRuns.back();
+}
+void APE::SDL2::SDL2Renderer::FlushPrimitives() {
+    if (!m_data || m_primitiveRuns.empty()) return;
+
+    for (const PrimitiveRun& run : m_primitiveRuns) {
+        ApplyDrawColor(run.Color);
+        switch (run.Kind) {
+        case PrimitiveKind::Point:
+            SDL_RenderDrawPoints(m_data, &m_batchPoints[run.First], static_cast<int>(run.Count));
+            break;
+        case PrimitiveKind::Line:
+            SDL_RenderDrawLines(m_data, &m_batchPoints[run.First], static_cast<int>(run.Count));
+            break;
+        case PrimitiveKind::Rectangle:
+            SDL_RenderDrawRects(m_data, &m_batchRects[run.First], static_cast<int>(run.Count));
+            break;
+        case PrimitiveKind::FilledRectangle:
+            SDL_RenderFillRects(m_data, &m_batchRects[run.First], static_cast<int>(run.Count));
+            break;
+        }
+        m_frameStatistics.DrawCalls++;
+    }
+
+    // Keep the capacity, so steady-state frames didn't need to reallocate.
+    m_primitiveRuns.clear();
+    m_batchPoints.clear();
+    m_batchRects.clear();
+}
+
+void APE::SDL2::SDL2Renderer::ApplyDrawColor(const SDL_Color& color) {
+    if (color.r == m_sdlDrawColor.r && color.g == m_sdlDrawColor.g && color.b == m_sdlDrawColor.b && color.a == m_sdlDrawColor.a)
+        return;
+    SDL_SetRenderDrawColor(m_data, color.r, color.g, color.b, color.a);
+    m_sdlDrawColor = color;
+    m_frameStatistics.StateChanges++;
+}
+
+template <typename T>
+void APE::SDL2::SDL2Renderer::EnsureCapacity(std::vector<T>& buffer, std::size_t count) {
+    if (count <= buffer.capacity()) return;
+    buffer.reserve(APE_MAX(count, buffer.capacity() * 2));
+    m_frameStatistics.BufferAllocations++;
+}
+void APE::SDL2::SDL2Renderer::ConvertSprite(const Sprite& sprite, std::vector<SDL_Vertex>& vertices, std::vector<int>& indices) {
+    const std::vector<Vertex>& s_vertices = sprite.GetVertices();
+    const std::vector<std::size_t>& s_triangles = sprite.GetTriangles();
+    std::size_t v_first = vertices.size(), i_first = indices.size();
+
+    EnsureCapacity(vertices, v_first + s_vertices.size());
+    EnsureCapacity(indices, i_first + s_triangles.size());
+    vertices.resize(v_first + s_vertices.size());
+    indices.resize(i_first + s_triangles.size());
+
+    for (std::size_t i = 0; i < s_vertices.size(); i++) {
+        const Vertex& vertex = s_vertices[i];
+        vertices[v_first + i] = SDL_Vertex{
+            SDL_FPoint{(float)vertex.Position.X, (float)vertex.Position.Y},
+            SDL_Color{vertex.Color.Red, vertex.Color.Green, vertex.Color.Blue, vertex.Color.Alpha},
+            SDL_FPoint{(float)vertex.TexturePosition.X, (float)vertex.TexturePosition.Y}
+        };
+    }
+    for (std::size_t i = 0; i < s_triangles.size(); i++)
+        indices[i_first + i] = static_cast<int>(v_first + s_triangles[i]);
+}
+const APE::SDL2::SDL2Renderer::SpriteCache* APE::SDL2::SDL2Renderer::UpdateSpriteCache(const Sprite& sprite) {
+    if (!sprite.IsRenderCacheEnabled()) return nullptr;
+
+    SpriteCache* cache = dynamic_cast<SpriteCache*>(sprite.GetRenderCache());
+    if (!cache) {
+        cache = new SpriteCache;
+        sprite.SetRenderCache(std::unique_ptr<ISpriteCache>(cache));
+        m_frameStatistics.BufferAllocations++;
+    } else if (cache->Revision == sprite.GetRevision())
+        return cache;
+
+    cache->Vertices.clear();
+    cache->Indices.clear();
+    ConvertSprite(sprite, cache->Vertices, cache->Indices);
+    cache->Revision = sprite.GetRevision();
+    return cache;
+}
+
+void APE::SDL2::SDL2Renderer::BeginSpriteBatch(SDL_Texture* texture) {
+    FlushPrimitives();
+    if (texture != m_spriteBatchTexture) {
+        FlushSprites();
+        m_spriteBatchTexture = texture;
+    }
+    m_frameStatistics.BatchedSprites++;
+}
+void APE::SDL2::SDL2Renderer::AppendSprite(const Sprite& sprite, SDL_Texture* texture) {
+    BeginSpriteBatch(texture);
+
+    const SpriteCache* cache = UpdateSpriteCache(sprite);
+    if (cache)
+        AppendGeometry(cache->Vertices.data(), cache->Vertices.size(), cache->Indices.data(), cache->Indices.size(), sizeof(int));
+    else
+        ConvertSprite(sprite, m_batchVertices, m_batchIndices);
+}
+void APE::SDL2::SDL2Renderer::AppendGeometry(const SDL_Vertex* vertices, std::size_t vertexCount, const void* indices, std::size_t indexCount, int indexSize) {
+    std::size_t v_first = m_batchVertices.size(), i_first = m_batchIndices.size();
+    EnsureCapacity(m_batchVertices, v_first + vertexCount);
+    EnsureCapacity(m_batchIndices, i_first + indexCount);
+    m_batchVertices.insert(m_batchVertices.end(), vertices, vertices + vertexCount);
+    m_batchIndices.resize(i_first + indexCount);
+
+    // Rebase the indices to the end of the batch.
+    int base = static_cast<int>(v_first);
+    int* out = m_batchIndices.data() + i_first;
+    if (indexSize == sizeof(uint16_t)) {
+        const uint16_t* in = static_cast<const uint16_t*>(indices);
+        for (std::size_t i = 0; i < indexCount; i++)
+            out[i] = base + in[i];
+    } else {
+        const uint32_t* in = static_cast<const uint32_t*>(indices);
+        for (std::size_t i = 0; i < indexCount; i++)
+            out[i] = base + static_cast<int>(in[i]);
+    }
+}
+void APE::SDL2::SDL2Renderer::SubmitGeometry(SDL_Texture* texture, const SDL_Vertex* vertices, std::size_t vertexCount, const void* indices, std::size_t indexCount, int indexSize) {
+    const float* position = &vertices[0].position.x;
+    const SDL_Color* color = &vertices[0].color;
+    const float* tex_coord = &vertices[0].tex_coord.x;
+    SDL_RenderGeometryRaw(
+        m_data, texture,
+        position, sizeof(SDL_Vertex), color, sizeof(SDL_Vertex), tex_coord, sizeof(SDL_Vertex), static_cast<int>(vertexCount),
+        indices, static_cast<int>(indexCount), indexSize
+    );
+    m_frameStatistics.DrawCalls++;
+    APE_PROFILE_COUNTER("Vertices", (long long)vertexCount);
+    APE_PROFILE_COUNTER("Indices", (long long)indexCount);
+}
+void APE::SDL2::SDL2Renderer::FlushSprites() {
+    if (!m_data || m_batchIndices.empty()) return;
+
+    SubmitGeometry(m_spriteBatchTexture,
+        m_batchVertices.data(), m_batchVertices.size(), m_batchIndices.data(), m_batchIndices.size(), sizeof(int));
+
+    m_batchVertices.clear();
+    m_batchIndices.clear();
+}
+
+void APE::SDL2::SDL2Renderer::EnablePrimitiveBatching() { m_primitiveBatching = true; }
+void APE::SDL2::SDL2Renderer::DisablePrimitiveBatching() {
+    FlushPrimitives();
+    m_primitiveBatching = false;
+}
+bool APE::SDL2::SDL2Renderer::IsPrimitiveBatchingEnabled() const { return m_primitiveBatching; }
+void APE::SDL2::SDL2Renderer::EnableSpriteBatching() { m_spriteBatching = true; }
+void APE::SDL2::SDL2Renderer::DisableSpriteBatching() {
+    FlushSprites();
+    m_spriteBatching = false;
+}
+bool APE::SDL2::SDL2Renderer::IsSpriteBatchingEnabled() const { return m_spriteBatching; }
+
+void APE::SDL2::SDL2Renderer::Flush() {
+    APE_PROFILE_ZONE("SDL2Renderer::Flush");
+    // Only one of the batch can hold data at a time, since recording to one flush the other.
+    FlushPrimitives();
+    FlushSprites();
+}
+
+void APE::SDL2::SDL2Renderer::EnableCulling() { m_culling = true; }
+void APE::SDL2::SDL2Renderer::DisableCulling() { m_culling = false; }
+bool APE::SDL2::SDL2Renderer::IsCullingEnabled() const { return m_culling; }
+
+bool APE::SDL2::SDL2Renderer::IsCulled(const APE::Rectangle& bounds) {
+    if (!m_culling) return false;
+    if (!m_cullAreaValid) {
+        // The drawings are relative to the viewport, which is the whole target when not set, and the clip area is
+        // relative to the viewport too. SDL2 report the viewport in logical units, so the scale is handled.
+        SDL_Rect viewport = { 0, 0, 0, 0 };
+        SDL_RenderGetViewport(m_data, &viewport);
+        m_cullArea = Rectangle(0, 0, viewport.w, viewport.h);
+        if (m_clipEnabled)
+            m_cullArea = Rectangle::Intersect(m_cullArea, Rectangle(m_clipArea.x, m_clipArea.y, m_clipArea.w, m_clipArea.h));
+        m_cullAreaValid = true;
+    }
+    if (!Rectangle::Intersect(m_cullArea, bounds).IsEmptyArea()) return false;
+    m_frameStatistics.Culled++;
+    return true;
+}
+
+const APE::SDL2::SDL2RendererStatistics& APE::SDL2::SDL2Renderer::GetFrameStatistics() const { return m_frameStatistics; }
+const APE::SDL2::SDL2RendererStatistics& APE::SDL2::SDL2Renderer::GetLastFrameStatistics() const { return m_lastFrameStatistics; }
+
+void APE::SDL2::SDL2Renderer::ResetStateCache() {
+    if (!m_data) return;
+    SDL_GetRenderDrawColor(m_data, &m_sdlDrawColor.r, &m_sdlDrawColor.g, &m_sdlDrawColor.b, &m_sdlDrawColor.a);
+    m_drawColor = m_sdlDrawColor;
+
+    SDL_BlendMode blendMode = SDL_BLENDMODE_INVALID;
+    SDL_GetRenderDrawBlendMode(m_data, &blendMode);
+    m_blendMode = static_cast<SDL2DrawBlendMode>(blendMode);
+
+    m_clipEnabled = SDL_RenderIsClipEnabled(m_data) == SDL_TRUE;
+    SDL_RenderGetClipRect(m_data, &m_clipArea);
+
+    // There is no way to know if the viewport was set, so treat it as set unless it cover the entire output.
+    int w = 0, h = 0;
+    SDL_GetRendererOutputSize(m_data, &w, &h);
+    SDL_RenderGetViewport(m_data, &m_viewport);
+    m_viewportSet = !(m_viewport.x == 0 && m_viewport.y == 0 && m_viewport.w == w && m_viewport.h == h);
+    m_cullAreaValid = false;
+}
+
+APE::Color APE::SDL2::SDL2Renderer::GetDrawColor() const {
+    return Color(m_drawColor.r, m_drawColor.g, m_drawColor.b, m_drawColor.a);
+}
+void APE::SDL2::SDL2Renderer::SetDrawColor(const APE::Color& color) {
+    m_drawColor = SDL_Color{ color.Red, color.Green, color.Blue, color.Alpha };
+}
+
 APE::SDL2::SDL2DrawBlendMode APE::SDL2::SDL2Renderer::GetDrawBlendMode() const {
-    if (!m_data) return SDL2DrawBlendMode::Invalid;
-    SDL_BlendMode tmp = SDL_BLENDMODE_INVALID;
-    SDL_GetRenderDrawBlendMode(m_data, &tmp);
-    return static_cast<SDL2DrawBlendMode>(tmp);
+    return m_data ? m_blendMode : SDL2DrawBlendMode::Invalid;
 }
 void APE::SDL2::SDL2Renderer::SetDrawBlendMode(SDL2DrawBlendMode BlendMode) {
-    if (m_data)
-        SDL_SetRenderDrawBlendMode(m_data, static_cast<SDL_BlendMode>(BlendMode));
+    if (!m_data || BlendMode == m_blendMode) return;
+    Flush();
+    SDL_SetRenderDrawBlendMode(m_data, static_cast<SDL_BlendMode>(BlendMode));
+    m_blendMode = BlendMode;
+    m_frameStatistics.StateChanges++;
 }
 
 APE::Size APE::SDL2::SDL2Renderer::GetOutputSize() const {
@@ -47,6 +285,8 @@ APE::Size APE::SDL2::SDL2Renderer::GetOutputSize() const {
 }
 APE::Rectangle APE::SDL2::SDL2Renderer::GetViewport() const {
     if (!m_data) return Rectangle::Empty;
+    if (m_viewportSet) return Rectangle(m_viewport.x, m_viewport.y, m_viewport.w, m_viewport.h);
+    // The entire output, which follow the window size.
     SDL_Rect tmp = { 0, 0, 0, 0 };
     SDL_RenderGetViewport(m_data, &tmp);
     return Rectangle(tmp.x, tmp.y, tmp.w, tmp.h);
@@ -54,143 +294,326 @@ APE::Rectangle APE::SDL2::SDL2Renderer::GetViewport() const {
 void APE::SDL2::SDL2Renderer::SetViewport(const APE::Rectangle& area) {
     if (!m_data || area.IsEmptyArea()) return;
     SDL_Rect tmp = { area.LeftSide(), area.TopSide(), abs(area.Width), abs(area.Height) };
+    if (m_viewportSet && SDL_RectEquals(&tmp, &m_viewport)) return;
+    Flush();
     SDL_RenderSetViewport(m_data, &tmp);
+    m_viewport = tmp;
+    m_viewportSet = true;
+    m_cullAreaValid = false;
+    m_frameStatistics.StateChanges++;
 }
 void APE::SDL2::SDL2Renderer::ResetViewport() {
-    if (m_data)
-        SDL_RenderSetViewport(m_data, nullptr);
+    if (!m_data || !m_viewportSet) return;
+    Flush();
+    SDL_RenderSetViewport(m_data, nullptr);
+    m_viewportSet = false;
+    m_cullAreaValid = false;
+    m_frameStatistics.StateChanges++;
 }
 
 
 void APE::SDL2::SDL2Renderer::SetClipArea(const APE::Rectangle& area) {
     if (!m_data || area.IsEmptyArea()) return;
     SDL_Rect tmp = { area.LeftSide(), area.TopSide(), abs(area.Width), abs(area.Height) };
+    if (m_clipEnabled && SDL_RectEquals(&tmp, &m_clipArea)) return;
+    Flush();
     SDL_RenderSetClipRect(m_data, &tmp);
+    m_clipArea = tmp;
+    m_clipEnabled = true;
+    m_cullAreaValid = false;
+    m_frameStatistics.StateChanges++;
 }
 APE::Rectangle APE::SDL2::SDL2Renderer::GetClipArea() const {
     if (!IsClipEnabled()) return Rectangle::Empty;
-    SDL_Rect tmp = { 0, 0, 0, 0 };
-    SDL_RenderGetClipRect(m_data, &tmp);
-    return Rectangle(tmp.x, tmp.y, tmp.w, tmp.h);
+    return Rectangle(m_clipArea.x, m_clipArea.y, m_clipArea.w, m_clipArea.h);
 }
 void APE::SDL2::SDL2Renderer::DisableClip() {
-    if (m_data)
-        SDL_RenderSetClipRect(m_data, nullptr);
+    if (!m_data || !m_clipEnabled) return;
+    Flush();
+    SDL_RenderSetClipRect(m_data, nullptr);
+    m_clipEnabled = false;
+    m_cullAreaValid = false;
+    m_frameStatistics.StateChanges++;
 }
 bool APE::SDL2::SDL2Renderer::IsClipEnabled() const {
-    return m_data ? SDL_RenderIsClipEnabled(m_data) == SDL_TRUE : false;
+    return m_data ? m_clipEnabled : false;
 }
 
 
 void APE::SDL2::SDL2Renderer::Clear(const Color& color) {
+    APE_PROFILE_ZONE("SDL2Renderer::Clear");
     if (!m_data) return;
-    SDL_SetRenderDrawColor(m_data, color.Red, color.Green, color.Blue, color.Alpha);
+    Flush();
+    // The clear color stays the draw color, as the primitives drawn after Clear() expect.
+    m_drawColor = SDL_Color{ color.Red, color.Green, color.Blue, color.Alpha };
+    ApplyDrawColor(m_drawColor);
     SDL_RenderClear(m_data);
+    m_frameStatistics.DrawCalls++;
 }
 void APE::SDL2::SDL2Renderer::Present() {
-    if (m_data)
+    if (!m_data) return;
+    {
+        APE_PROFILE_ZONE("SDL2Renderer::Present");
+        Flush();
         SDL_RenderPresent(m_data);
+    }
+    APE_PROFILE_FRAME();
+    // The output size may change between frames (e.g. on window resize).
+    m_cullAreaValid = false;
+
+    m_lastFrameStatistics = m_frameStatistics;
+    m_frameStatistics = SDL2RendererStatistics();
 }
 
 
 void APE::SDL2::SDL2Renderer::DrawPoint(const APE::Point& position) {
-    if (m_data)
-        SDL_RenderDrawPoint(m_data, position.X, position.Y);
+    APE_PROFILE_ZONE("SDL2Renderer::DrawPoint");
+    if (!m_data || IsCulled(Rectangle(position.X, position.Y, 1, 1))) return;
+    if (m_primitiveBatching) {
+        GetPrimitiveRun(PrimitiveKind::Point, m_batchPoints.size()).Count++;
+        EnsureCapacity(m_batchPoints, m_batchPoints.size() + 1);
+        m_batchPoints.push_back(SDL_Point{ position.X, position.Y });
+        return;
+    }
+    Flush();
+    ApplyDrawColor(m_drawColor);
+    SDL_RenderDrawPoint(m_data, position.X, position.Y);
+    m_frameStatistics.DrawCalls++;
 }
 void APE::SDL2::SDL2Renderer::DrawLine(const APE::Point& start, const APE::Point& end) {
-    if (m_data)
-        SDL_RenderDrawLine(m_data, start.X, start.Y, end.X, end.Y);
+    APE_PROFILE_ZONE("SDL2Renderer::DrawLine");
+    if (!m_data || IsCulled(Rectangle::FromTwoPoint(start, end))) return;
+    if (m_primitiveBatching) {
+        // Lines are merged into a polyline, so only a line that start where the last one ended can
+        // extend the current run. A polyline draw its joints once, unlike separate lines, so the lines
+        // are only chained without blending, where drawing a pixel twice doesn't change it.
+        EnsureCapacity(m_batchPoints, m_batchPoints.size() + 2);
+        PrimitiveRun& run = GetPrimitiveRun(PrimitiveKind::Line, m_batchPoints.size());
+        bool chained = run.Count != 0 && m_blendMode == SDL2DrawBlendMode::None &&
+            m_batchPoints.back().x == start.X && m_batchPoints.back().y == start.Y;
+        if (!chained) {
+            if (run.Count != 0) {
+                PrimitiveRun next = PrimitiveRun{ PrimitiveKind::Line, run.Color, m_batchPoints.size(), 0 };
+                EnsureCapacity(m_primitiveRuns, m_primitiveRuns.size() + 1);
+                m_primitiveRuns.push_back(next);
+            }
+            m_batchPoints.push_back(SDL_Point{ start.X, start.Y });
+            m_primitiveRuns.back().Count++;
+        }
+        m_batchPoints.push_back(SDL_Point{ end.X, end.Y });
+        m_primitiveRuns.back().Count++;
+        return;
+    }
+    Flush();
+    ApplyDrawColor(m_drawColor);
+    SDL_RenderDrawLine(m_data, start.X, start.Y, end.X, end.Y);
+    m_frameStatistics.DrawCalls++;
 }
 
 void APE::SDL2::SDL2Renderer::DrawRectangle(const APE::Rectangle& area) {
+    APE_PROFILE_ZONE("SDL2Renderer::DrawRectangle");
     if (!m_data || area.IsEmptyArea()) return;
     SDL_Rect tmp = { area.LeftSide(), area.TopSide(), abs(area.Width), abs(area.Height) };
+    if (IsCulled(Rectangle(tmp.x, tmp.y, tmp.w, tmp.h))) return;
+    if (m_primitiveBatching) {
+        GetPrimitiveRun(PrimitiveKind::Rectangle, m_batchRects.size()).Count++;
+        EnsureCapacity(m_batchRects, m_batchRects.size() + 1);
+        m_batchRects.push_back(tmp);
+        return;
+    }
+    Flush();
+    ApplyDrawColor(m_drawColor);
     SDL_RenderDrawRect(m_data, &tmp);
+    m_frameStatistics.DrawCalls++;
 }
 void APE::SDL2::SDL2Renderer::DrawRoundedRectangle(const APE::Rectangle& area, int radius) {
+    APE_PROFILE_ZONE("SDL2Renderer::DrawRoundedRectangle");
     if (!m_data || area.IsEmptyArea()) return;
     if (radius <= 0) return DrawRectangle(area);
-    
-    uint8_t r = 0, g = 0, b = 0, a = 0;
-    SDL_GetRenderDrawColor(m_data, &r, &g, &b, &a);
 
-    roundedRectangleRGBA(m_data,
-        area.LeftSide(), area.TopSide(), area.RightSide(), area.BottomSide(), radius,
-        r, g, b, a);
+    // The area cover whole pixels, and the corners are centered on pixel centers like the circles.
+    Rectangle pixels(area.LeftSide(), area.TopSide(), abs(area.Width), abs(area.Height));
+    if (IsCulled(pixels)) return;
+    m_shapeSprite.Clear();
+    m_tessellator.AppendRoundedRectangleOutline(m_shapeSprite, pixels, radius + 0.5, 1.0, GetDrawColor());
+    RenderShape();
 }
 
 void APE::SDL2::SDL2Renderer::FillRectangle(const APE::Rectangle& area) {
+    APE_PROFILE_ZONE("SDL2Renderer::FillRectangle");
     if (!m_data) return;
     SDL_Rect tmp = { area.LeftSide(), area.TopSide(), abs(area.Width), abs(area.Height) };
+    if (IsCulled(Rectangle(tmp.x, tmp.y, tmp.w, tmp.h))) return;
+    if (m_primitiveBatching) {
+        GetPrimitiveRun(PrimitiveKind::FilledRectangle, m_batchRects.size()).Count++;
+        EnsureCapacity(m_batchRects, m_batchRects.size() + 1);
+        m_batchRects.push_back(tmp);
+        return;
+    }
+    Flush();
+    ApplyDrawColor(m_drawColor);
     SDL_RenderFillRect(m_data, &tmp);
+    m_frameStatistics.DrawCalls++;
 }
 void APE::SDL2::SDL2Renderer::FillRoundedRectangle(const APE::Rectangle& area, int radius) {
-    if (!m_data) return;
+    APE_PROFILE_ZONE("SDL2Renderer::FillRoundedRectangle");
+    if (!m_data || area.IsEmptyArea()) return;
     if (radius <= 0) return FillRectangle(area);
 
-    uint8_t r = 0, g = 0, b = 0, a = 0;
-    SDL_GetRenderDrawColor(m_data, &r, &g, &b, &a);
-
-    roundedBoxRGBA(m_data,
-        area.LeftSide(), area.TopSide(), area.RightSide(), area.BottomSide(), radius,
-        r, g, b, a);
+    Rectangle pixels(area.LeftSide(), area.TopSide(), abs(area.Width), abs(area.Height));
+    if (IsCulled(pixels)) return;
+    m_shapeSprite.Clear();
+    m_tessellator.AppendFilledRoundedRectangle(m_shapeSprite, pixels, radius + 0.5, GetDrawColor());
+    RenderShape();
 }
 
-void APE::SDL2::SDL2Renderer::DrawCircle(const APE::Point& center, int radius) {
-    if (!m_data || radius == 0) return;
-
-    uint8_t r = 0, g = 0, b = 0, a = 0;
-    SDL_GetRenderDrawColor(m_data, &r, &g, &b, &a);
-
-    circleRGBA(m_data, center.X, center.Y, radius, r, g, b, a);
-}
+void APE::SDL2::SDL2Renderer::DrawCircle(const APE::Point& center, int radius) { DrawEllipse(center, radius, radius); }
 void APE::SDL2::SDL2Renderer::DrawEllipse(const APE::Point& center, int radiusX, int radiusY) {
+    APE_PROFILE_ZONE("SDL2Renderer::DrawEllipse");
     if (!m_data || radiusX == 0 || radiusY == 0) return;
-
-    uint8_t r = 0, g = 0, b = 0, a = 0;
-    SDL_GetRenderDrawColor(m_data, &r, &g, &b, &a);
-
-    ellipseRGBA(m_data, center.X, center.Y, radiusX, radiusY, r, g, b, a);
+    // Culled before the tessellation, with a pixel of margin for the outline thickness.
+    radiusX = abs(radiusX);
+    radiusY = abs(radiusY);
+    if (IsCulled(Rectangle(center.X - radiusX - 1, center.Y - radiusY - 1, radiusX * 2 + 3, radiusY * 2 + 3))) return;
+
+    // Shapes are centered on the pixel centers, with the pixels at the radius distance included.
+    m_shapeSprite.Clear();
+    m_tessellator.AppendEllipseOutline(m_shapeSprite, Vector2(center.X + 0.5, center.Y + 0.5), radiusX, radiusY, 1.0, GetDrawColor());
+    RenderShape();
 }
 
-void APE::SDL2::SDL2Renderer::FillCircle(const APE::Point& center, int radius) {
-    if (!m_data || radius == 0) return;
-
-    uint8_t r = 0, g = 0, b = 0, a = 0;
-    SDL_GetRenderDrawColor(m_data, &r, &g, &b, &a);
-
-    filledCircleRGBA(m_data, center.X, center.Y, radius, r, g, b, a);
-}
+void APE::SDL2::SDL2Renderer::FillCircle(const APE::Point& center, int radius) { FillEllipse(center, radius, radius); }
 void APE::SDL2::SDL2Renderer::FillEllipse(const APE::Point& center, int radiusX, int radiusY) {
+    APE_PROFILE_ZONE("SDL2Renderer::FillEllipse");
     if (!m_data || radiusX == 0 || radiusY == 0) return;
+    radiusX = abs(radiusX);
+    radiusY = abs(radiusY);
+    if (IsCulled(Rectangle(center.X - radiusX, center.Y - radiusY, radiusX * 2 + 1, radiusY * 2 + 1))) return;
 
-    uint8_t r = 0, g = 0, b = 0, a = 0;
-    SDL_GetRenderDrawColor(m_data, &r, &g, &b, &a);
+    m_shapeSprite.Clear();
+    m_tessellator.AppendFilledEllipse(m_shapeSprite, Vector2(center.X + 0.5, center.Y + 0.5), radiusX + 0.5, radiusY + 0.5, GetDrawColor());
+    RenderShape();
+}
 
-    filledEllipseRGBA(m_data, center.X, center.Y, radiusX, radiusY, r, g, b, a);
+void APE::SDL2::SDL2Renderer::RenderShape() {
+    // The draw blend mode apply to geometry without texture, so shapes blend like the other primitives.
+    // The shape was already culled with its analytic bounds, before the tessellation.
+    SubmitSprite(m_shapeSprite, nullptr);
 }
 
-void APE::SDL2::SDL2Renderer::RenderSprite(const Sprite& sprite) {
+void APE::SDL2::SDL2Renderer::RenderSprite(const Sprite& sprite) { RenderSpriteWithTexture(sprite, nullptr); }
+void APE::SDL2::SDL2Renderer::RenderSprite(const Sprite& sprite, const SDL2Texture& texture) { RenderSpriteWithTexture(sprite, texture.m_data); }
+void APE::SDL2::SDL2Renderer::RenderSprite(const CompactSprite16& sprite) { RenderCompactSprite(sprite, nullptr); }
+void APE::SDL2::SDL2Renderer::RenderSprite(const CompactSprite16& sprite, const SDL2Texture& texture) { RenderCompactSprite(sprite, texture.m_data); }
+void APE::SDL2::SDL2Renderer::RenderSprite(const CompactSprite32& sprite) { RenderCompactSprite(sprite, nullptr); }
+void APE::SDL2::SDL2Renderer::RenderSprite(const CompactSprite32& sprite, const SDL2Texture& texture) { RenderCompactSprite(sprite, texture.m_data); }
+
+void APE::SDL2::SDL2Renderer::RenderSpriteWithTexture(const Sprite& sprite, SDL_Texture* texture) {
+    APE_PROFILE_ZONE("SDL2Renderer::RenderSprite");
+    if (!m_data || sprite.TrianglesCount() < 3 || sprite.VerticesCount() <= 0 || IsCulled(sprite.GetBounds())) return;
+    SubmitSprite(sprite, texture);
+}
+void APE::SDL2::SDL2Renderer::SubmitSprite(const Sprite& sprite, SDL_Texture* texture) {
     if (!m_data || sprite.TrianglesCount() < 3 || sprite.VerticesCount() <= 0) return;
+    if (m_spriteBatching) {
+        AppendSprite(sprite, texture);
+        return;
+    }
+    Flush();
+
+    const std::vector<SDL_Vertex>* vertices = &m_spriteVertices;
+    const std::vector<int>* indices = &m_spriteIndices;
+
+    const SpriteCache* cache = UpdateSpriteCache(sprite);
+    if (cache) {
+        vertices = &cache->Vertices;
+        indices = &cache->Indices;
+    } else {
+        m_spriteVertices.clear();
+        m_spriteIndices.clear();
+        ConvertSprite(sprite, m_spriteVertices, m_spriteIndices);
+    }
+
+    SubmitGeometry(texture, vertices->data(), vertices->size(), indices->data(), indices->size(), sizeof(int));
+}
+void APE::SDL2::SDL2Renderer::RenderCompactSprite(const CompactSprite16& sprite, SDL_Texture* texture) {
+    APE_PROFILE_ZONE("SDL2Renderer::RenderSprite");
+    if (!m_data || sprite.TrianglesCount() < 3 || IsCulled(sprite.GetBounds())) return;
+    RenderCompactGeometry(
+        reinterpret_cast<const SDL_Vertex*>(sprite.GetVertices().data()), sprite.VerticesCount(),
+        sprite.GetTriangles().data(), sprite.TrianglesCount(), sizeof(uint16_t), texture);
+}
+void APE::SDL2::SDL2Renderer::RenderCompactSprite(const CompactSprite32& sprite, SDL_Texture* texture) {
+    APE_PROFILE_ZONE("SDL2Renderer::RenderSprite");
+    if (!m_data || sprite.TrianglesCount() < 3 || IsCulled(sprite.GetBounds())) return;
+    RenderCompactGeometry(
+        reinterpret_cast<const SDL_Vertex*>(sprite.GetVertices().data()), sprite.VerticesCount(),
+        sprite.GetTriangles().data(), sprite.TrianglesCount(), sizeof(uint32_t), texture);
+}
+void APE::SDL2::SDL2Renderer::RenderCompactGeometry(const SDL_Vertex* vertices, std::size_t vertexCount, const void* indices, std::size_t indexCount, int indexSize, SDL_Texture* texture) {
+    if (!m_data || indexCount < 3 || vertexCount <= 0) return;
+    if (m_spriteBatching) {
+        BeginSpriteBatch(texture);
+        AppendGeometry(vertices, vertexCount, indices, indexCount, indexSize);
+        return;
+    }
+    Flush();
+    SubmitGeometry(texture, vertices, vertexCount, indices, indexCount, indexSize);
+}
 
-    auto& s_vertices = sprite.GetVertices();
-    auto& s_triangles = sprite.GetTriangles();
-
-    std::vector<SDL_Vertex> vertices(s_vertices.size());
-    std::vector<int> indices(s_triangles.size());
-
-    std::copy(s_triangles.begin(), s_triangles.end(), indices.begin());
-    std::transform(s_vertices.begin(), s_vertices.end(), vertices.begin(), [](const Vertex& vertex) {
-        return SDL_Vertex{
-            SDL_FPoint{(float)vertex.Position.X, (float)vertex.Position.Y},
-            SDL_Color{vertex.Color.Red, vertex.Color.Green, vertex.Color.Blue, vertex.Color.Alpha},
-            SDL_FPoint{(float)vertex.TexturePosition.X, (float)vertex.TexturePosition.Y}
-        };
-    });
+bool APE::SDL2::SDL2Renderer::PushRenderTarget(SDL2RenderTarget& target) {
+    if (!m_data || !target.m_data) return false;
+    Flush();
+
+    TargetState state = { &target, SDL_GetRenderTarget(m_data), m_viewportSet, m_viewport, m_clipEnabled, m_clipArea };
+    if (SDL_SetRenderTarget(m_data, target.m_data) != 0) return false;
+    m_targetStack.push_back(state);
+
+    // Record with the whole target as viewport and without clipping, whatever the caller was using.
+    SDL_RenderSetViewport(m_data, nullptr);
+    SDL_RenderSetClipRect(m_data, nullptr);
+    m_viewportSet = false;
+    m_clipEnabled = false;
+    m_cullAreaValid = false;
+    m_frameStatistics.StateChanges += 3;
+    return true;
+}
+bool APE::SDL2::SDL2Renderer::PopRenderTarget(SDL2RenderTarget& target) {
+    std::size_t index = m_targetStack.size();
+    while (index > 0 && m_targetStack[index - 1].RenderTarget != &target) index--;
+    if (!m_data || index == 0) return false;
+    Flush();
+
+    // The recordings nested inside the target one are ended with it, unfinished, and the state from before
+    // the target one is restored, so a target destroyed out of order doesn't leave the stack dangling.
+    TargetState state = m_targetStack[index - 1];
+    for (std::size_t i = index; i < m_targetStack.size(); i++) {
+        m_targetStack[i].RenderTarget->m_recording = false;
+        m_targetStack[i].RenderTarget->m_valid = false;
+    }
+    m_targetStack.resize(index - 1);
+    SDL_SetRenderTarget(m_data, state.PreviousTarget);
+    SDL_RenderSetViewport(m_data, state.ViewportSet ? &state.Viewport : nullptr);
+    SDL_RenderSetClipRect(m_data, state.ClipEnabled ? &state.ClipArea : nullptr);
+    m_viewportSet = state.ViewportSet;
+    m_viewport = state.Viewport;
+    m_clipEnabled = state.ClipEnabled;
+    m_clipArea = state.ClipArea;
+    m_cullAreaValid = false;
+    m_frameStatistics.StateChanges += 3;
+    return true;
+}
 
-    SDL_RenderGeometry(
-        m_data, nullptr,
-        vertices.data(), vertices.size(),
-        indices.empty() ? nullptr : indices.data(), indices.size()
-    );
-}
\ No newline at end of file
+void APE::SDL2::SDL2Renderer::Composite(const SDL2RenderTarget& target, const APE::Point& position) {
+    Size size = target.GetSize();
+    Composite(target, Rectangle(position, size));
+}
+void APE::SDL2::SDL2Renderer::Composite(const SDL2RenderTarget& target, const APE::Rectangle& area) {
+    APE_PROFILE_ZONE("SDL2Renderer::Composite");
+    if (!m_data || !target.m_data || area.IsEmptyArea()) return;
+    SDL_Rect tmp = { area.LeftSide(), area.TopSide(), abs(area.Width), abs(area.Height) };
+    if (IsCulled(Rectangle(tmp.x, tmp.y, tmp.w, tmp.h))) return;
+    Flush();
+    SDL_RenderCopy(m_data, target.m_data, nullptr, &tmp);
+    m_frameStatistics.DrawCalls++;
+}
@@ -0,0 +1,149 @@
+#include "APE/SDL2/APE_SDL2_Texture.h"
+
+#include <cstdlib>
+#include <stdexcept>
+#include <SDL2/SDL_image.h>
+
+//* --- APE::SDL2::SDL2Texture ---
+
+APE::SDL2::SDL2Texture::SDL2Texture(SDL2Renderer* renderer, const APE::Size& size) {
+    if (!renderer || !renderer->m_data)
+        throw std::runtime_error("SDL2Texture: Invalid SDL2Renderer to create!");
+    if (size.Width <= 0 || size.Height <= 0)
+        throw std::runtime_error("SDL2Texture: Invalid size to create!");
+
+    m_data = SDL_CreateTexture(renderer->m_data, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, size.Width, size.Height);
+    if (!m_data)
+        throw std::runtime_error("SDL2Texture: Failed to create the texture!");
+    m_size = size;
+    SDL_SetTextureBlendMode(m_data, SDL_BLENDMODE_BLEND);
+
+    // Static textures content are undefined until uploaded.
+    std::vector<Color> transparent((std::size_t)size.Width * size.Height, Color::Empty);
+    Update(Rectangle(Point::Zero, size), transparent.data());
+}
+APE::SDL2::SDL2Texture::SDL2Texture(SDL2Renderer* renderer, const APE::Size& size, APE::PixelFormat format) {
+    if (!renderer || !renderer->m_data)
+        throw std::runtime_error("SDL2Texture: Invalid SDL2Renderer to create!");
+    if (size.Width <= 0 || size.Height <= 0)
+        throw std::runtime_error("SDL2Texture: Invalid size to create!");
+    if (PixelConverter::GetBytesPerPixel(format) == 0)
+        throw std::runtime_error("SDL2Texture: Invalid pixel format to create!");
+
+    m_data = SDL_CreateTexture(renderer->m_data, static_cast<Uint32>(format), SDL_TEXTUREACCESS_STREAMING, size.Width, size.Height);
+    if (!m_data)
+        throw std::runtime_error("SDL2Texture: Failed to create the texture!");
+    m_size = size;
+    m_streamingFormat = format;
+    SDL_SetTextureBlendMode(m_data, SDL_BLENDMODE_BLEND);
+
+    // Streaming textures content are undefined until uploaded.
+    std::vector<Color> transparent((std::size_t)size.Width * size.Height, Color::Empty);
+    Update(Rectangle(Point::Zero, size), transparent.data());
+}
+APE::SDL2::SDL2Texture::SDL2Texture(SDL2Renderer* renderer, const std::string& path) {
+    if (!renderer || !renderer->m_data)
+        throw std::runtime_error("SDL2Texture: Invalid SDL2Renderer to create!");
+
+    SDL_Surface* loaded = IMG_Load(path.c_str());
+    if (!loaded)
+        throw std::runtime_error("SDL2Texture: Failed to load the image '" + path + "'!");
+    // Convert to the Color layout, so Update() can upload into the texture like into the ones created by size.
+    SDL_Surface* surface = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(loaded);
+    if (!surface)
+        throw std::runtime_error("SDL2Texture: Failed to convert the image '" + path + "'!");
+
+    m_data = SDL_CreateTexture(renderer->m_data, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, surface->w, surface->h);
+    m_size = Size(surface->w, surface->h);
+    if (m_data) {
+        SDL_LockSurface(surface);
+        SDL_UpdateTexture(m_data, nullptr, surface->pixels, surface->pitch);
+        SDL_UnlockSurface(surface);
+    }
+    SDL_FreeSurface(surface);
+    if (!m_data)
+        throw std::runtime_error("SDL2Texture: Failed to create the texture!");
+    SDL_SetTextureBlendMode(m_data, SDL_BLENDMODE_BLEND);
+}
+APE::SDL2::SDL2Texture::~SDL2Texture() {
+    if (m_data)
+        SDL_DestroyTexture(m_data);
+}
+
+APE::Size APE::SDL2::SDL2Texture::GetSize() const { return m_size; }
+
+APE::SDL2::SDL2DrawBlendMode APE::SDL2::SDL2Texture::GetBlendMode() const { return m_data ? m_blendMode : SDL2DrawBlendMode::Invalid; }
+void APE::SDL2::SDL2Texture::SetBlendMode(SDL2DrawBlendMode blendMode) {
+    if (!m_data || blendMode == SDL2DrawBlendMode::Invalid) return;
+    SDL2DrawBlendMode previous = m_blendMode;
+    m_blendMode = blendMode;
+    // The premultiplied version of the mode isn't supported by the renderer, keep the previous mode.
+    if (!ApplyBlendMode()) {
+        m_blendMode = previous;
+        ApplyBlendMode();
+    }
+}
+
+void APE::SDL2::SDL2Texture::EnablePremultipliedAlpha() {
+    if (!m_data || m_premultipliedAlpha) return;
+    m_premultipliedAlpha = true;
+    // The renderer doesn't support the custom blend modes, stay with straight alpha.
+    if (!ApplyBlendMode()) {
+        m_premultipliedAlpha = false;
+        ApplyBlendMode();
+    }
+}
+void APE::SDL2::SDL2Texture::DisablePremultipliedAlpha() {
+    m_premultipliedAlpha = false;
+    m_uploadBuffer = std::vector<PremultipliedColor>();
+    ApplyBlendMode();
+}
+bool APE::SDL2::SDL2Texture::IsPremultipliedAlphaEnabled() const { return m_premultipliedAlpha; }
+
+bool APE::SDL2::SDL2Texture::ApplyBlendMode() {
+    if (!m_data) return false;
+    SDL_BlendMode mode = static_cast<SDL_BlendMode>(m_blendMode);
+    // Modulate and Multiply already expect premultiplied sources, only the source factor of AlphaBlend and
+    // Additive must drop the multiply by the source alpha (see APE::Blend).
+    if (m_premultipliedAlpha && m_blendMode == SDL2DrawBlendMode::AlphaBlend)
+        mode = SDL_ComposeCustomBlendMode(SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD,
+                                          SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD);
+    else if (m_premultipliedAlpha && m_blendMode == SDL2DrawBlendMode::Additive)
+        mode = SDL_ComposeCustomBlendMode(SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE, SDL_BLENDOPERATION_ADD,
+                                          SDL_BLENDFACTOR_ZERO, SDL_BLENDFACTOR_ONE, SDL_BLENDOPERATION_ADD);
+    // Not every renderer support the custom blend modes, SDL keep the previous mode when it fails.
+    return SDL_SetTextureBlendMode(m_data, mode) == 0;
+}
+
+void APE::SDL2::SDL2Texture::Upload(const APE::Rectangle& area, const APE::Color* pixels) {
+    SDL_Rect tmp = { area.LeftSide(), area.TopSide(), abs(area.Width), abs(area.Height) };
+    if (m_streamingFormat == PixelFormat::Unknown) {
+        // Color is laid out as R, G, B, A bytes, which is exactly SDL_PIXELFORMAT_RGBA32.
+        SDL_UpdateTexture(m_data, &tmp, pixels, tmp.w * (int)sizeof(Color));
+        return;
+    }
+    void* locked = nullptr;
+    int pitch = 0;
+    if (SDL_LockTexture(m_data, &tmp, &locked, &pitch) != 0) return;
+    PixelConverter::ToPixels(pixels, Size(tmp.w, tmp.h), locked, pitch, m_streamingFormat);
+    SDL_UnlockTexture(m_data);
+}
+
+void APE::SDL2::SDL2Texture::Update(const APE::Rectangle& area, const APE::Color* pixels) {
+    if (!m_data || !pixels || area.IsEmptyArea()) return;
+    if (m_premultipliedAlpha) {
+        std::size_t count = (std::size_t)abs(area.Width) * abs(area.Height);
+        if (m_uploadBuffer.size() < count)
+            m_uploadBuffer.resize(count);
+        PremultipliedColor::FromColors(pixels, m_uploadBuffer.data(), count);
+        Upload(area, reinterpret_cast<const Color*>(m_uploadBuffer.data()));
+        return;
+    }
+    Upload(area, pixels);
+}
+void APE::SDL2::SDL2Texture::Update(const APE::Rectangle& area, const APE::PremultipliedColor* pixels) {
+    if (!m_data || !m_premultipliedAlpha || !pixels || area.IsEmptyArea()) return;
+    // PremultipliedColor has the same R, G, B, A bytes layout as Color.
+    Upload(area, reinterpret_cast<const Color*>(pixels));
+}
@@ -0,0 +1,98 @@
+#include "APE/SDL2/APE_SDL2_TextureAtlas.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <SDL2/SDL_image.h>
+
+//* --- APE::SDL2::SDL2TextureRegion ---
+
+APE::Vector2 APE::SDL2::SDL2TextureRegion::MapTexturePosition(const APE::Vector2& local) const {
+    return Vector2(
+        TopLeft.X + local.X * (BottomRight.X - TopLeft.X),
+        TopLeft.Y + local.Y * (BottomRight.Y - TopLeft.Y)
+    );
+}
+void APE::SDL2::SDL2TextureRegion::MapSprite(APE::Sprite& sprite) const {
+    for (Vertex& vertex : sprite.GetVertices())
+        vertex.TexturePosition = MapTexturePosition(vertex.TexturePosition);
+}
+
+//* --- APE::SDL2::SDL2TextureAtlas ---
+
+APE::SDL2::SDL2TextureAtlas::SDL2TextureAtlas(SDL2Renderer* renderer, const APE::Size& pageSize, int padding)
+    : m_renderer(renderer), m_pageSize(pageSize.Absolute()), m_padding(APE_MAX(padding, 0)) {
+    if (!renderer)
+        throw std::runtime_error("SDL2TextureAtlas: Invalid SDL2Renderer to create!");
+    if (m_pageSize.IsEmptyArea())
+        throw std::runtime_error("SDL2TextureAtlas: Invalid page size!");
+}
+
+bool APE::SDL2::SDL2TextureAtlas::AddImage(const std::string& name, const std::string& path) {
+    if (IsContain(name)) return false;
+
+    SDL_Surface* loaded = IMG_Load(path.c_str());
+    if (!loaded) return false;
+    SDL_Surface* surface = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(loaded);
+    if (!surface) return false;
+
+    // Copy the rows, since the surface pitch may be larger than its width.
+    std::vector<Color> pixels((std::size_t)surface->w * surface->h);
+    SDL_LockSurface(surface);
+    for (int y = 0; y < surface->h; y++)
+        std::memcpy(&pixels[(std::size_t)y * surface->w],
+            static_cast<const uint8_t*>(surface->pixels) + (std::size_t)y * surface->pitch,
+            (std::size_t)surface->w * sizeof(Color));
+    SDL_UnlockSurface(surface);
+
+    Size size(surface->w, surface->h);
+    SDL_FreeSurface(surface);
+    return AddPixels(name, size, pixels.data());
+}
+bool APE::SDL2::SDL2TextureAtlas::AddPixels(const std::string& name, const APE::Size& size, const APE::Color* pixels) {
+    if (IsContain(name)) return false;
+    SDL2TextureRegion region;
+    if (!AddPixels(size, pixels, region)) return false;
+    m_regions[name] = region;
+    return true;
+}
+bool APE::SDL2::SDL2TextureAtlas::AddPixels(const APE::Size& size, const APE::Color* pixels, SDL2TextureRegion& region) {
+    if (!pixels || size.Width <= 0 || size.Height <= 0) return false;
+    Size padded = size + m_padding * 2;
+    if (padded.Width > m_pageSize.Width || padded.Height > m_pageSize.Height) return false;
+
+    // Try the existing pages first, then open a new one.
+    Rectangle area;
+    std::size_t page = 0;
+    for (; page < m_pages.size(); page++)
+        if (m_pages[page].Packer.Insert(padded, area)) break;
+    if (page == m_pages.size()) {
+        m_pages.push_back(Page{ std::unique_ptr<SDL2Texture>(new SDL2Texture(m_renderer, m_pageSize)), SkylinePacker(m_pageSize) });
+        if (!m_pages.back().Packer.Insert(padded, area)) return false;
+    }
+
+    area = Rectangle(area.X + m_padding, area.Y + m_padding, size.Width, size.Height);
+    m_pages[page].Texture->Update(area, pixels);
+
+    region.Page = page;
+    region.Area = area;
+    region.TopLeft = Vector2((double)area.X / m_pageSize.Width, (double)area.Y / m_pageSize.Height);
+    region.BottomRight = Vector2((double)(area.X + area.Width) / m_pageSize.Width, (double)(area.Y + area.Height) / m_pageSize.Height);
+    return true;
+}
+
+bool APE::SDL2::SDL2TextureAtlas::IsContain(const std::string& name) const {
+    return m_regions.find(name) != m_regions.end();
+}
+bool APE::SDL2::SDL2TextureAtlas::TryGetRegion(const std::string& name, SDL2TextureRegion& region) const {
+    auto it = m_regions.find(name);
+    if (it == m_regions.end()) return false;
+    region = it->second;
+    return true;
+}
+
+std::size_t APE::SDL2::SDL2TextureAtlas::PagesCount() const { return m_pages.size(); }
+APE::SDL2::SDL2Texture& APE::SDL2::SDL2TextureAtlas::GetPage(std::size_t index) const {
+    return *m_pages.at(index).Texture;
+}
+APE::Size APE::SDL2::SDL2TextureAtlas::GetPageSize() const { return m_pageSize; }
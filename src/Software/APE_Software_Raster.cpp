@@ -0,0 +1,196 @@
+#include "APE_Software_Raster.h"
+
+#include <algorithm>
+#include <cmath>
+
+#ifdef APE_SOFTWARE_SSE2
+#include <emmintrin.h>
+#endif
+
+// Largest coordinate handled by the rasteriser, keep the pixel bounds far from integer overflow.
+static const float MaxCoordinate = 16777216.0f;
+
+static float ClampCoordinate(float value) {
+    if (!(value > -MaxCoordinate)) return -MaxCoordinate;
+    return value < MaxCoordinate ? value : MaxCoordinate;
+}
+
+//* --- APE::Software ---
+
+bool APE::Software::SetupTriangle(const APE::Vector2 positions[3], const APE::Color colors[3], RasterTriangle& triangle) {
+    float x[3], y[3];
+    for (int i = 0; i < 3; i++) {
+        x[i] = ClampCoordinate(static_cast<float>(positions[i].X));
+        y[i] = ClampCoordinate(static_cast<float>(positions[i].Y));
+    }
+    const Color* c[3] = { &colors[0], &colors[1], &colors[2] };
+
+    float area = (x[1] - x[0]) * (y[2] - y[0]) - (y[1] - y[0]) * (x[2] - x[0]);
+    if (area == 0.0f || !std::isfinite(area)) return false;
+    if (area < 0.0f) {
+        // Make the winding consistent, so every edge function is positive inside.
+        std::swap(x[1], x[2]); std::swap(y[1], y[2]); std::swap(c[1], c[2]);
+        area = -area;
+    }
+
+    for (int i = 0; i < 3; i++) {
+        // Edge i is the one opposite to vertex i.
+        int a = (i + 1) % 3, b = (i + 2) % 3;
+        // Compute the edge from its vertices in a fixed order, so the triangles sharing it get exactly
+        // opposite values and no pixel is covered twice.
+        bool flip = x[b] < x[a] || (x[b] == x[a] && y[b] < y[a]);
+        if (flip) std::swap(a, b);
+        float A = y[a] - y[b], B = x[b] - x[a];
+        float C = -A * x[a] - B * y[a] + 0.5f * (A + B); // Sample at the pixel centres.
+        if (flip) { A = -A; B = -B; C = -C; }
+        triangle.EdgeA[i] = A;
+        triangle.EdgeB[i] = B;
+        triangle.EdgeC[i] = C;
+        triangle.TopLeft[i] = A > 0.0f || (A == 0.0f && B > 0.0f);
+    }
+
+    // The barycentric weights are the edge functions over the area, so each channel is a plane too.
+    float inverseArea = 1.0f / area;
+    for (int ch = 0; ch < 4; ch++) {
+        float v[3];
+        for (int i = 0; i < 3; i++)
+            v[i] = (ch == 0) ? c[i]->Red : (ch == 1) ? c[i]->Green : (ch == 2) ? c[i]->Blue : c[i]->Alpha;
+        triangle.ColorA[ch] = (triangle.EdgeA[0] * v[0] + triangle.EdgeA[1] * v[1] + triangle.EdgeA[2] * v[2]) * inverseArea;
+        triangle.ColorB[ch] = (triangle.EdgeB[0] * v[0] + triangle.EdgeB[1] * v[1] + triangle.EdgeB[2] * v[2]) * inverseArea;
+        triangle.ColorC[ch] = (triangle.EdgeC[0] * v[0] + triangle.EdgeC[1] * v[1] + triangle.EdgeC[2] * v[2]) * inverseArea;
+    }
+
+    int left = static_cast<int>(std::floor(std::min(x[0], std::min(x[1], x[2]))));
+    int top = static_cast<int>(std::floor(std::min(y[0], std::min(y[1], y[2]))));
+    int right = static_cast<int>(std::ceil(std::max(x[0], std::max(x[1], x[2]))));
+    int bottom = static_cast<int>(std::ceil(std::max(y[0], std::max(y[1], y[2]))));
+    triangle.Bounds = Rectangle(left, top, right - left, bottom - top);
+    return true;
+}
+
+bool APE::Software::IsRasterKernelCompiled(SoftwareRasterKernel kernel) {
+    switch (kernel) {
+    case SoftwareRasterKernel::Scalar:
+        return true;
+    case SoftwareRasterKernel::SSE2:
+#ifdef APE_SOFTWARE_SSE2
+        return true;
+#else
+        return false;
+#endif
+    case SoftwareRasterKernel::AVX2:
+        return IsAVX2KernelCompiled();
+    }
+    return false;
+}
+
+void APE::Software::RasterizeTriangle(const RasterTriangle& triangle, const APE::Rectangle& clip, APE::Color* pixels, int stride,
+                                      SoftwareBlendMode mode, SoftwareRasterKernel kernel) {
+    Rectangle area = Rectangle::Intersect(triangle.Bounds, clip);
+    if (area.IsEmptyArea()) return;
+
+    switch (kernel) {
+    case SoftwareRasterKernel::AVX2: RasterizeTriangleAVX2(triangle, area, pixels, stride, mode); break;
+    case SoftwareRasterKernel::SSE2: RasterizeTriangleSSE2(triangle, area, pixels, stride, mode); break;
+    default: RasterizeTriangleScalar(triangle, area, pixels, stride, mode); break;
+    }
+}
+
+void APE::Software::RasterizeTriangleScalar(const RasterTriangle& triangle, const APE::Rectangle& area, APE::Color* pixels, int stride, SoftwareBlendMode mode) {
+    for (int py = area.Y; py < area.Y + area.Height; py++) {
+        float fy = static_cast<float>(py), rowEdge[3], rowColor[4];
+        for (int i = 0; i < 3; i++) rowEdge[i] = triangle.EdgeB[i] * fy + triangle.EdgeC[i];
+        for (int i = 0; i < 4; i++) rowColor[i] = triangle.ColorB[i] * fy + triangle.ColorC[i];
+
+        int start = area.X, end = area.X + area.Width;
+        NarrowTriangleRow(triangle, rowEdge, start, end);
+
+        Color* row = pixels + static_cast<std::size_t>(py) * stride;
+        for (int px = start; px < end; px++)
+            ShadeTrianglePixel(triangle, rowEdge, rowColor, px, row[px], mode);
+    }
+}
+
+#ifdef APE_SOFTWARE_SSE2
+void APE::Software::RasterizeTriangleSSE2(const RasterTriangle& triangle, const APE::Rectangle& area, APE::Color* pixels, int stride, SoftwareBlendMode mode) {
+    const __m128 zero = _mm_setzero_ps(), maxChannel = _mm_set1_ps(255.0f), half = _mm_set1_ps(0.5f);
+    const __m128 lanes = _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f);
+    __m128 edgeA[3], topLeft[3], colorA[4];
+    for (int i = 0; i < 3; i++) {
+        edgeA[i] = _mm_set1_ps(triangle.EdgeA[i]);
+        topLeft[i] = _mm_castsi128_ps(_mm_set1_epi32(triangle.TopLeft[i] ? -1 : 0));
+    }
+    for (int i = 0; i < 4; i++) colorA[i] = _mm_set1_ps(triangle.ColorA[i]);
+    // The interpolated colors may be translucent, so only Over and Add can be blended in the registers.
+    BlendOperation operation = BlendOperation::Over;
+    bool vectorBlend = GetBlendOperation(mode, false, operation);
+
+    for (int py = area.Y; py < area.Y + area.Height; py++) {
+        float fy = static_cast<float>(py), rowEdge[3], rowColor[4];
+        __m128 rowEdgeV[3], rowColorV[4];
+        for (int i = 0; i < 3; i++) rowEdgeV[i] = _mm_set1_ps(rowEdge[i] = triangle.EdgeB[i] * fy + triangle.EdgeC[i]);
+        for (int i = 0; i < 4; i++) rowColorV[i] = _mm_set1_ps(rowColor[i] = triangle.ColorB[i] * fy + triangle.ColorC[i]);
+
+        int px = area.X, right = area.X + area.Width;
+        NarrowTriangleRow(triangle, rowEdge, px, right);
+
+        Color* row = pixels + static_cast<std::size_t>(py) * stride;
+        for (; px + 4 <= right; px += 4) {
+            __m128 x = _mm_add_ps(_mm_set1_ps(static_cast<float>(px)), lanes);
+
+            __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+            for (int i = 0; i < 3; i++) {
+                __m128 e = _mm_add_ps(_mm_mul_ps(edgeA[i], x), rowEdgeV[i]);
+                inside = _mm_and_ps(inside, _mm_or_ps(_mm_cmpgt_ps(e, zero), _mm_and_ps(_mm_cmpeq_ps(e, zero), topLeft[i])));
+            }
+            int mask = _mm_movemask_ps(inside);
+            if (!mask) continue;
+
+            __m128i packed = _mm_setzero_si128();
+            for (int i = 0; i < 4; i++) {
+                __m128 c = _mm_add_ps(_mm_mul_ps(colorA[i], x), rowColorV[i]);
+                c = _mm_min_ps(_mm_max_ps(c, zero), maxChannel);
+                packed = _mm_or_si128(packed, _mm_slli_epi32(_mm_cvttps_epi32(_mm_add_ps(c, half)), 8 * i));
+            }
+
+            Color* target = row + px;
+            if (mode == SoftwareBlendMode::None) {
+                __m128i keep = _mm_castps_si128(inside);
+                __m128i old = _mm_loadu_si128(reinterpret_cast<const __m128i*>(target));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(target), _mm_or_si128(_mm_and_si128(keep, packed), _mm_andnot_si128(keep, old)));
+            } else if (vectorBlend) {
+                __m128i keep = _mm_castps_si128(inside);
+                __m128i old = _mm_loadu_si128(reinterpret_cast<const __m128i*>(target));
+                __m128i blended = BlendColorsSSE2(operation, PremultiplyColorsSSE2(packed), old);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(target), _mm_or_si128(_mm_and_si128(keep, blended), _mm_andnot_si128(keep, old)));
+            } else {
+                alignas(16) Color src[4];
+                _mm_store_si128(reinterpret_cast<__m128i*>(src), packed);
+                for (int i = 0; i < 4; i++)
+                    if (mask & (1 << i)) target[i] = BlendColor(src[i], target[i], mode);
+            }
+        }
+        for (; px < right; px++)
+            ShadeTrianglePixel(triangle, rowEdge, rowColor, px, row[px], mode);
+    }
+}
+#else
+void APE::Software::RasterizeTriangleSSE2(const RasterTriangle& triangle, const APE::Rectangle& area, APE::Color* pixels, int stride, SoftwareBlendMode mode) {
+    RasterizeTriangleScalar(triangle, area, pixels, stride, mode);
+}
+#endif
+
+void APE::Software::FillSpan(APE::Color* pixels, int count, const APE::Color& color, SoftwareBlendMode mode) {
+    if (mode == SoftwareBlendMode::None) {
+        std::fill(pixels, pixels + count, color);
+        return;
+    }
+    BlendOperation operation;
+    if (count > 0 && GetBlendOperation(mode, color.Alpha == 255, operation)) {
+        PremultipliedColor src(color);
+        BlendColorSpan(operation, &src, 0, pixels, static_cast<std::size_t>(count));
+        return;
+    }
+    for (int i = 0; i < count; i++)
+        pixels[i] = BlendColor(color, pixels[i], mode);
+}
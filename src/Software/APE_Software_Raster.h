@@ -0,0 +1,163 @@
+#ifndef __APE_SOFTWARE_RASTER_H__
+#define __APE_SOFTWARE_RASTER_H__
+
+#include "APE/Software/APE_Software_Renderer.h"
+#include "../APE_Color_Span.h"
+
+#include <cstdint>
+
+// Internal rasterisation helpers of the Software Renderer, shared between its translation units.
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define APE_SOFTWARE_SSE2 1
+#endif
+
+namespace APE {
+    namespace Software {
+        /// @brief A triangle prepared for rasterisation. Every edge and color channel is a plane equation
+        /// f(x, y) = A * x + B * y + C, evaluated at the pixel centres.
+        struct RasterTriangle {
+            /// @brief The edge functions, a pixel is inside when every edge is positive (or zero on a top-left edge).
+            float EdgeA[3], EdgeB[3], EdgeC[3];
+            /// @brief Whether each edge is a top-left edge (owning the pixels lying exactly on it).
+            bool TopLeft[3];
+            /// @brief The Red, Green, Blue, Alpha planes, in the [0, 255] range.
+            float ColorA[4], ColorB[4], ColorC[4];
+            /// @brief The pixel bounds of the triangle (top-left rectangle).
+            Rectangle Bounds;
+        };
+
+        static_assert(sizeof(Color) == 4, "The SIMD kernels store Color as packed 32-bit RGBA!");
+
+        /// @brief Convert an interpolated channel to 8-bit, rounded and saturated (NaN become 0).
+        static inline uint8_t ToChannel(float value) {
+            if (!(value > 0.0f)) return 0;
+            return value < 255.0f ? static_cast<uint8_t>(value + 0.5f) : 255;
+        }
+
+        /// @brief Multiply two 8-bit values as [0, 1] fractions, rounded exactly (x * y / 255).
+        static inline uint8_t Multiply255(unsigned x, unsigned y) {
+            unsigned t = x * y + 128;
+            return static_cast<uint8_t>((t + (t >> 8)) >> 8);
+        }
+
+        /// @brief Make a Color from its channels. The Color constructors are inline functions with an external
+        /// linkage, so they are not called here, or the AVX2 kernels file would emit a copy built with AVX2.
+        static inline Color MakeColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+            Color color;
+            color.Red = r;
+            color.Green = g;
+            color.Blue = b;
+            color.Alpha = a;
+            return color;
+        }
+
+        /// @brief Blend a source color into a destination color.
+        static inline Color BlendColor(const Color& src, const Color& dst, SoftwareBlendMode mode) {
+            switch (mode) {
+            case SoftwareBlendMode::AlphaBlend: {
+                unsigned inv = 255 - src.Alpha;
+                return MakeColor(static_cast<uint8_t>(Multiply255(src.Red, src.Alpha) + Multiply255(dst.Red, inv)),
+                                 static_cast<uint8_t>(Multiply255(src.Green, src.Alpha) + Multiply255(dst.Green, inv)),
+                                 static_cast<uint8_t>(Multiply255(src.Blue, src.Alpha) + Multiply255(dst.Blue, inv)),
+                                 static_cast<uint8_t>(src.Alpha + Multiply255(dst.Alpha, inv)));
+            }
+            case SoftwareBlendMode::Additive:
+                return MakeColor(static_cast<uint8_t>(APE_MIN(255u, dst.Red + Multiply255(src.Red, src.Alpha))),
+                                 static_cast<uint8_t>(APE_MIN(255u, dst.Green + Multiply255(src.Green, src.Alpha))),
+                                 static_cast<uint8_t>(APE_MIN(255u, dst.Blue + Multiply255(src.Blue, src.Alpha))),
+                                 dst.Alpha);
+            case SoftwareBlendMode::Modulate:
+                return MakeColor(Multiply255(src.Red, dst.Red), Multiply255(src.Green, dst.Green),
+                                 Multiply255(src.Blue, dst.Blue), dst.Alpha);
+            case SoftwareBlendMode::Multiply: {
+                unsigned inv = 255 - src.Alpha;
+                return MakeColor(static_cast<uint8_t>(APE_MIN(255u, Multiply255(src.Red, dst.Red) + Multiply255(dst.Red, inv))),
+                                 static_cast<uint8_t>(APE_MIN(255u, Multiply255(src.Green, dst.Green) + Multiply255(dst.Green, inv))),
+                                 static_cast<uint8_t>(APE_MIN(255u, Multiply255(src.Blue, dst.Blue) + Multiply255(dst.Blue, inv))),
+                                 dst.Alpha);
+            }
+            default:
+                return src;
+            }
+        }
+
+        /// @brief Get the premultiplied blend operation (see APE::Blend) giving the same result as BlendColor() with
+        /// the given mode, so the pixels can be blended by the SIMD blend kernels.
+        /// @param opaqueSource Whether every source color is opaque, Modulate and Multiply only match for them.
+        /// @param operation The blend operation to use.
+        /// @return true if there is an operation matching the mode, false otherwise (None, or the source isn't opaque).
+        static inline bool GetBlendOperation(SoftwareBlendMode mode, bool opaqueSource, BlendOperation& operation) {
+            switch (mode) {
+            case SoftwareBlendMode::AlphaBlend: operation = BlendOperation::Over; return true;
+            case SoftwareBlendMode::Additive: operation = BlendOperation::Add; return true;
+            case SoftwareBlendMode::Modulate: operation = BlendOperation::Modulate; return opaqueSource;
+            case SoftwareBlendMode::Multiply: operation = BlendOperation::Multiply; return opaqueSource;
+            default: return false;
+            }
+        }
+
+        /// @brief Prepare a triangle for rasterisation.
+        /// @param positions The three vertex positions, in framebuffer coordinates.
+        /// @param colors The three vertex colors.
+        /// @param triangle The prepared triangle.
+        /// @return false if the triangle is degenerated (no area), true otherwise.
+        bool SetupTriangle(const Vector2 positions[3], const Color colors[3], RasterTriangle& triangle);
+
+        /// @brief Shade a single pixel of a triangle row. Every kernel use it for the pixels left over by its vectors,
+        /// so the result didn't depend on the kernel.
+        /// @param rowEdge The edge functions without the x term (EdgeB * y + EdgeC).
+        /// @param rowColor The color planes without the x term (ColorB * y + ColorC).
+        static inline void ShadeTrianglePixel(const RasterTriangle& triangle, const float rowEdge[3], const float rowColor[4],
+                                       int x, Color& pixel, SoftwareBlendMode mode) {
+            float fx = static_cast<float>(x);
+            for (int i = 0; i < 3; i++) {
+                float e = triangle.EdgeA[i] * fx + rowEdge[i];
+                if (!(e > 0.0f || (e == 0.0f && triangle.TopLeft[i]))) return;
+            }
+            Color src = MakeColor(ToChannel(triangle.ColorA[0] * fx + rowColor[0]), ToChannel(triangle.ColorA[1] * fx + rowColor[1]),
+                                  ToChannel(triangle.ColorA[2] * fx + rowColor[2]), ToChannel(triangle.ColorA[3] * fx + rowColor[3]));
+            pixel = BlendColor(src, pixel, mode);
+        }
+
+        /// @brief Narrow a triangle row to the pixels that may be covered, so the kernels skip the empty part of the bounds.
+        /// The range is conservative (one pixel wider), the exact coverage is still decided by the edge functions.
+        /// @param rowEdge The edge functions without the x term (EdgeB * y + EdgeC).
+        /// @param start The first pixel of the row, updated to the first pixel that may be covered.
+        /// @param end The past-the-end pixel of the row, updated to the past-the-end pixel that may be covered.
+        static inline void NarrowTriangleRow(const RasterTriangle& triangle, const float rowEdge[3], int& start, int& end) {
+            float left = static_cast<float>(start), right = static_cast<float>(end);
+            for (int i = 0; i < 3; i++) {
+                float A = triangle.EdgeA[i];
+                if (A > 0.0f) left = APE_MAX(left, -rowEdge[i] / A - 1.0f);
+                else if (A < 0.0f) right = APE_MIN(right, -rowEdge[i] / A + 2.0f);
+                else if (rowEdge[i] < 0.0f) { end = start; return; }
+            }
+            if (!(left < right)) { end = start; return; }
+            start = static_cast<int>(left);
+            end = static_cast<int>(right);
+        }
+
+        /// @brief Check if a raster kernel was compiled in this build (not if the CPU support it).
+        bool IsRasterKernelCompiled(SoftwareRasterKernel kernel);
+        /// @brief Check if the AVX2 kernel was compiled, its translation unit is the only one built with AVX2 enabled.
+        bool IsAVX2KernelCompiled();
+        /// @brief Rasterise a prepared triangle into the framebuffer.
+        /// @param triangle The prepared triangle.
+        /// @param clip The drawable area of the framebuffer (top-left rectangle, not empty).
+        /// @param pixels The framebuffer pixels.
+        /// @param stride The number of pixels per framebuffer row.
+        /// @param mode The blend mode to use.
+        /// @param kernel The raster kernel to use, must be supported.
+        void RasterizeTriangle(const RasterTriangle& triangle, const Rectangle& clip, Color* pixels, int stride,
+                               SoftwareBlendMode mode, SoftwareRasterKernel kernel);
+        /// @brief The raster kernels, with the same parameters as RasterizeTriangle().
+        void RasterizeTriangleScalar(const RasterTriangle& triangle, const Rectangle& area, Color* pixels, int stride, SoftwareBlendMode mode);
+        void RasterizeTriangleSSE2(const RasterTriangle& triangle, const Rectangle& area, Color* pixels, int stride, SoftwareBlendMode mode);
+        void RasterizeTriangleAVX2(const RasterTriangle& triangle, const Rectangle& area, Color* pixels, int stride, SoftwareBlendMode mode);
+        /// @brief Fill a span of pixels with a single color.
+        void FillSpan(Color* pixels, int count, const Color& color, SoftwareBlendMode mode);
+    }
+}
+
+#endif // __APE_SOFTWARE_RASTER_H__
@@ -0,0 +1,79 @@
+#include "APE_Software_Raster.h"
+
+// This file is the only one compiled with AVX2 enabled (see CMakeLists.txt), its kernel must only be called
+// after checking the CPU support at runtime.
+
+#ifdef __AVX2__
+#include <immintrin.h>
+
+bool APE::Software::IsAVX2KernelCompiled() { return true; }
+
+void APE::Software::RasterizeTriangleAVX2(const RasterTriangle& triangle, const APE::Rectangle& area, APE::Color* pixels, int stride, SoftwareBlendMode mode) {
+    const __m256 zero = _mm256_setzero_ps(), maxChannel = _mm256_set1_ps(255.0f), half = _mm256_set1_ps(0.5f);
+    const __m256 lanes = _mm256_set_ps(7.0f, 6.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f, 0.0f);
+    __m256 edgeA[3], topLeft[3], colorA[4];
+    for (int i = 0; i < 3; i++) {
+        edgeA[i] = _mm256_set1_ps(triangle.EdgeA[i]);
+        topLeft[i] = _mm256_castsi256_ps(_mm256_set1_epi32(triangle.TopLeft[i] ? -1 : 0));
+    }
+    for (int i = 0; i < 4; i++) colorA[i] = _mm256_set1_ps(triangle.ColorA[i]);
+    // The interpolated colors may be translucent, so only Over and Add can be blended in the registers.
+    BlendOperation operation = BlendOperation::Over;
+    bool vectorBlend = GetBlendOperation(mode, false, operation);
+
+    for (int py = area.Y; py < area.Y + area.Height; py++) {
+        float fy = static_cast<float>(py), rowEdge[3], rowColor[4];
+        __m256 rowEdgeV[3], rowColorV[4];
+        for (int i = 0; i < 3; i++) rowEdgeV[i] = _mm256_set1_ps(rowEdge[i] = triangle.EdgeB[i] * fy + triangle.EdgeC[i]);
+        for (int i = 0; i < 4; i++) rowColorV[i] = _mm256_set1_ps(rowColor[i] = triangle.ColorB[i] * fy + triangle.ColorC[i]);
+
+        int px = area.X, right = area.X + area.Width;
+        NarrowTriangleRow(triangle, rowEdge, px, right);
+
+        Color* row = pixels + static_cast<std::size_t>(py) * stride;
+        for (; px + 8 <= right; px += 8) {
+            __m256 x = _mm256_add_ps(_mm256_set1_ps(static_cast<float>(px)), lanes);
+
+            __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+            for (int i = 0; i < 3; i++) {
+                __m256 e = _mm256_add_ps(_mm256_mul_ps(edgeA[i], x), rowEdgeV[i]);
+                __m256 edgeInside = _mm256_or_ps(_mm256_cmp_ps(e, zero, _CMP_GT_OQ),
+                                                 _mm256_and_ps(_mm256_cmp_ps(e, zero, _CMP_EQ_OQ), topLeft[i]));
+                inside = _mm256_and_ps(inside, edgeInside);
+            }
+            int mask = _mm256_movemask_ps(inside);
+            if (!mask) continue;
+
+            __m256i packed = _mm256_setzero_si256();
+            for (int i = 0; i < 4; i++) {
+                __m256 c = _mm256_add_ps(_mm256_mul_ps(colorA[i], x), rowColorV[i]);
+                c = _mm256_min_ps(_mm256_max_ps(c, zero), maxChannel);
+                packed = _mm256_or_si256(packed, _mm256_slli_epi32(_mm256_cvttps_epi32(_mm256_add_ps(c, half)), 8 * i));
+            }
+
+            Color* target = row + px;
+            if (mode == SoftwareBlendMode::None) {
+                __m256i old = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(target));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(target), _mm256_blendv_epi8(old, packed, _mm256_castps_si256(inside)));
+            } else if (vectorBlend) {
+                __m256i old = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(target));
+                __m256i blended = BlendColorsAVX2(operation, PremultiplyColorsAVX2(packed), old);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(target), _mm256_blendv_epi8(old, blended, _mm256_castps_si256(inside)));
+            } else {
+                alignas(32) Color src[8];
+                _mm256_store_si256(reinterpret_cast<__m256i*>(src), packed);
+                for (int i = 0; i < 8; i++)
+                    if (mask & (1 << i)) target[i] = BlendColor(src[i], target[i], mode);
+            }
+        }
+        for (; px < right; px++)
+            ShadeTrianglePixel(triangle, rowEdge, rowColor, px, row[px], mode);
+    }
+}
+#else
+bool APE::Software::IsAVX2KernelCompiled() { return false; }
+
+void APE::Software::RasterizeTriangleAVX2(const RasterTriangle& triangle, const APE::Rectangle& area, APE::Color* pixels, int stride, SoftwareBlendMode mode) {
+    RasterizeTriangleScalar(triangle, area, pixels, stride, mode);
+}
+#endif
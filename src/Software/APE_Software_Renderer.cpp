@@ -0,0 +1,383 @@
+#include "APE/Software/APE_Software_Renderer.h"
+#include "APE/APE_ThreadPool.h"
+#include "APE_Software_Raster.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <stdlib.h>
+#include <SDL2/SDL_cpuinfo.h>
+
+// The size of the screen tiles used by the tiled rasterisation, in pixels.
+static const int TileSize = 64;
+
+//* --- APE::Software::SoftwareRenderer::TileState ---
+
+struct APE::Software::SoftwareRenderer::TileState {
+    /// @brief A recorded drawing command.
+    struct Command {
+        /// @brief The triangle to rasterise (only for triangle commands).
+        RasterTriangle Triangle;
+        /// @brief The area the command can draw to, in framebuffer coordinates (already clipped).
+        Rectangle Area;
+        /// @brief The fill color (only for rectangle commands).
+        APE::Color Color;
+        SoftwareBlendMode Mode;
+        bool IsTriangle;
+    };
+
+    ThreadPool Pool;
+    int Columns;
+    int Rows;
+    std::vector<Command> Commands;
+    /// @brief The indices of the commands touching each tile, in submission order.
+    std::vector<std::vector<uint32_t>> Bins;
+    std::vector<std::size_t> ActiveTiles;
+
+    TileState(std::size_t threadsCount, const Size& size)
+        : Pool(threadsCount), Columns((size.Width + TileSize - 1) / TileSize), Rows((size.Height + TileSize - 1) / TileSize),
+          Bins(static_cast<std::size_t>(Columns) * Rows) {}
+
+    /// @brief Record a command into the bins of every tile its area touches.
+    void Record(const Command& command) {
+        uint32_t index = static_cast<uint32_t>(Commands.size());
+        Commands.push_back(command);
+        const Rectangle& area = command.Area;
+        int left = area.X / TileSize, right = (area.X + area.Width - 1) / TileSize;
+        int top = area.Y / TileSize, bottom = (area.Y + area.Height - 1) / TileSize;
+        for (int y = top; y <= bottom; y++)
+            for (int x = left; x <= right; x++)
+                Bins[static_cast<std::size_t>(y) * Columns + x].push_back(index);
+    }
+    /// @brief Drop every recorded command, keeping the allocated memory.
+    void Discard() {
+        for (std::vector<uint32_t>& bin : Bins) bin.clear();
+        Commands.clear();
+    }
+};
+
+//* --- APE::Software::SoftwareRenderer ---
+
+APE::Software::SoftwareRenderer::SoftwareRenderer(const APE::Size& size) : m_size(size.Absolute()), m_rasterKernel(GetBestRasterKernel()) {
+    if (m_size.IsEmptyArea())
+        throw std::runtime_error("SoftwareRenderer: Invalid framebuffer size to create!");
+    std::size_t count = static_cast<std::size_t>(m_size.Width) * m_size.Height;
+    m_backBuffer.assign(count, Color(0, 0, 0, 255));
+    m_frontBuffer.assign(count, Color(0, 0, 0, 255));
+    ResetViewport();
+}
+APE::Software::SoftwareRenderer::~SoftwareRenderer() = default;
+
+APE::Rectangle APE::Software::SoftwareRenderer::GetDrawableArea() const {
+    Rectangle area = Rectangle::Intersect(m_viewport, Rectangle(Point::Zero, m_size));
+    if (m_clipEnabled)
+        area = Rectangle::Intersect(area, Rectangle(m_viewport.X + m_clipArea.X, m_viewport.Y + m_clipArea.Y, m_clipArea.Width, m_clipArea.Height));
+    return area;
+}
+void APE::Software::SoftwareRenderer::AddDamage(const APE::Rectangle& area) {
+    if (m_damage) m_damage->AddDamage(area);
+}
+void APE::Software::SoftwareRenderer::PlotPixel(int x, int y, const APE::Rectangle& drawable) {
+    x += m_viewport.X; y += m_viewport.Y;
+    if (x < drawable.X || y < drawable.Y || x >= drawable.X + drawable.Width || y >= drawable.Y + drawable.Height)
+        return;
+    Color& pixel = m_backBuffer[static_cast<std::size_t>(y) * m_size.Width + x];
+    pixel = BlendColor(m_drawColor, pixel, m_blendMode);
+}
+
+bool APE::Software::SoftwareRenderer::IsRasterKernelSupported(SoftwareRasterKernel kernel) {
+    if (!IsRasterKernelCompiled(kernel)) return false;
+    switch (kernel) {
+    case SoftwareRasterKernel::SSE2: return SDL_HasSSE2() == SDL_TRUE;
+    case SoftwareRasterKernel::AVX2: return SDL_HasAVX2() == SDL_TRUE;
+    default: return true;
+    }
+}
+APE::Software::SoftwareRasterKernel APE::Software::SoftwareRenderer::GetBestRasterKernel() {
+    static const SoftwareRasterKernel best =
+        IsRasterKernelSupported(SoftwareRasterKernel::AVX2) ? SoftwareRasterKernel::AVX2 :
+        IsRasterKernelSupported(SoftwareRasterKernel::SSE2) ? SoftwareRasterKernel::SSE2 : SoftwareRasterKernel::Scalar;
+    return best;
+}
+
+APE::Software::SoftwareRasterKernel APE::Software::SoftwareRenderer::GetRasterKernel() const { return m_rasterKernel; }
+bool APE::Software::SoftwareRenderer::SetRasterKernel(SoftwareRasterKernel kernel) {
+    if (!IsRasterKernelSupported(kernel)) return false;
+    m_rasterKernel = kernel;
+    return true;
+}
+
+void APE::Software::SoftwareRenderer::EnableTiledRasterization(std::size_t threadsCount) {
+    Flush();
+    m_tiles.reset(new TileState(threadsCount, m_size));
+}
+void APE::Software::SoftwareRenderer::DisableTiledRasterization() {
+    Flush();
+    m_tiles.reset();
+}
+bool APE::Software::SoftwareRenderer::IsTiledRasterizationEnabled() const { return m_tiles != nullptr; }
+
+void APE::Software::SoftwareRenderer::Flush() {
+    if (!m_tiles || m_tiles->Commands.empty()) return;
+    TileState& tiles = *m_tiles;
+
+    tiles.ActiveTiles.clear();
+    for (std::size_t i = 0; i < tiles.Bins.size(); i++)
+        if (!tiles.Bins[i].empty()) tiles.ActiveTiles.push_back(i);
+
+    Color* pixels = m_backBuffer.data();
+    const int stride = m_size.Width;
+    const SoftwareRasterKernel kernel = m_rasterKernel;
+    tiles.Pool.Run(tiles.ActiveTiles.size(), [&](std::size_t task) {
+        std::size_t tile = tiles.ActiveTiles[task];
+        Rectangle tileArea(static_cast<int>(tile % tiles.Columns) * TileSize, static_cast<int>(tile / tiles.Columns) * TileSize, TileSize, TileSize);
+        for (uint32_t index : tiles.Bins[tile]) {
+            const TileState::Command& command = tiles.Commands[index];
+            Rectangle area = Rectangle::Intersect(command.Area, tileArea);
+            if (area.IsEmptyArea()) continue;
+            if (command.IsTriangle) {
+                RasterizeTriangle(command.Triangle, area, pixels, stride, command.Mode, kernel);
+                continue;
+            }
+            for (int y = area.Y; y < area.Y + area.Height; y++)
+                FillSpan(pixels + static_cast<std::size_t>(y) * stride + area.X, area.Width, command.Color, command.Mode);
+        }
+    });
+    tiles.Discard();
+}
+
+void APE::Software::SoftwareRenderer::EnableDamageTracking(std::size_t maxRectangles) {
+    m_damage.reset(new DamageTracker(m_size, maxRectangles));
+    // The presented framebuffer may be behind anywhere, so the first Present() must copy everything.
+    m_damage->DamageAll();
+}
+void APE::Software::SoftwareRenderer::DisableDamageTracking() { m_damage.reset(); }
+bool APE::Software::SoftwareRenderer::IsDamageTrackingEnabled() const { return m_damage != nullptr; }
+const APE::DamageTracker* APE::Software::SoftwareRenderer::GetDamageTracker() const { return m_damage.get(); }
+
+APE::Color APE::Software::SoftwareRenderer::GetDrawColor() const { return m_drawColor; }
+void APE::Software::SoftwareRenderer::SetDrawColor(const APE::Color& color) { m_drawColor = color; }
+
+APE::Software::SoftwareBlendMode APE::Software::SoftwareRenderer::GetDrawBlendMode() const { return m_blendMode; }
+void APE::Software::SoftwareRenderer::SetDrawBlendMode(SoftwareBlendMode blendMode) { m_blendMode = blendMode; }
+
+APE::Size APE::Software::SoftwareRenderer::GetOutputSize() const { return m_size; }
+
+APE::Rectangle APE::Software::SoftwareRenderer::GetViewport() const { return m_viewport; }
+void APE::Software::SoftwareRenderer::SetViewport(const APE::Rectangle& area) {
+    if (area.IsEmptyArea()) return;
+    m_viewport = Rectangle(area.LeftSide(), area.TopSide(), abs(area.Width), abs(area.Height));
+}
+void APE::Software::SoftwareRenderer::ResetViewport() { m_viewport = Rectangle(Point::Zero, m_size); }
+
+void APE::Software::SoftwareRenderer::SetClipArea(const APE::Rectangle& area) {
+    if (area.IsEmptyArea()) return;
+    m_clipArea = Rectangle(area.LeftSide(), area.TopSide(), abs(area.Width), abs(area.Height));
+    m_clipEnabled = true;
+}
+APE::Rectangle APE::Software::SoftwareRenderer::GetClipArea() const { return m_clipEnabled ? m_clipArea : Rectangle::Empty; }
+void APE::Software::SoftwareRenderer::DisableClip() { m_clipEnabled = false; }
+bool APE::Software::SoftwareRenderer::IsClipEnabled() const { return m_clipEnabled; }
+
+void APE::Software::SoftwareRenderer::Clear(const APE::Color& color) {
+    // Everything recorded would be overwritten anyway.
+    if (m_tiles) m_tiles->Discard();
+    std::fill(m_backBuffer.begin(), m_backBuffer.end(), color);
+    if (m_damage) m_damage->DamageAll();
+}
+void APE::Software::SoftwareRenderer::Present() {
+    Flush();
+    if (!m_damage) {
+        std::copy(m_backBuffer.begin(), m_backBuffer.end(), m_frontBuffer.begin());
+        return;
+    }
+    for (const Rectangle& area : m_damage->GetRectangles())
+        for (int y = area.Y; y < area.Y + area.Height; y++) {
+            std::size_t offset = static_cast<std::size_t>(y) * m_size.Width + area.X;
+            std::copy(m_backBuffer.begin() + offset, m_backBuffer.begin() + offset + area.Width, m_frontBuffer.begin() + offset);
+        }
+    m_damage->Clear();
+}
+
+void APE::Software::SoftwareRenderer::DrawPoint(const APE::Point& position) {
+    Flush();
+    Rectangle drawable = GetDrawableArea();
+    PlotPixel(position.X, position.Y, drawable);
+    AddDamage(Rectangle::Intersect(Rectangle(position.X + m_viewport.X, position.Y + m_viewport.Y, 1, 1), drawable));
+}
+void APE::Software::SoftwareRenderer::DrawLine(const APE::Point& start, const APE::Point& end) {
+    Flush();
+    Rectangle drawable = GetDrawableArea();
+    if (drawable.IsEmptyArea()) return;
+
+    // Bresenham's line, both end points included (like SDL2): the step i along the major axis is at the
+    // offset (i * minorLength + majorLength / 2) / majorLength along the minor axis. The offsets are monotonic,
+    // so the line is clipped to the drawable area by solving for the first and last steps inside it, and only
+    // these are walked. Everything is done in 64-bit, the deltas of two int overflow int.
+    int64_t dx = (int64_t)end.X - start.X, dy = (int64_t)end.Y - start.Y;
+    bool xMajor = APE_ABS(dx) >= APE_ABS(dy);
+    int64_t majorStart = xMajor ? start.X : start.Y, minorStart = xMajor ? start.Y : start.X;
+    int64_t majorDelta = xMajor ? dx : dy, minorDelta = xMajor ? dy : dx;
+    int64_t majorStep = majorDelta < 0 ? -1 : 1, minorStep = minorDelta < 0 ? -1 : 1;
+    uint64_t majorLength = (uint64_t)APE_ABS(majorDelta), minorLength = (uint64_t)APE_ABS(minorDelta);
+
+    // The drawable area in the line coordinates (without the viewport), as inclusive bounds on each axis.
+    int64_t left = (int64_t)drawable.X - m_viewport.X, top = (int64_t)drawable.Y - m_viewport.Y;
+    int64_t right = left + drawable.Width - 1, bottom = top + drawable.Height - 1;
+    int64_t majorLow = xMajor ? left : top, majorHigh = xMajor ? right : bottom;
+    int64_t minorLow = xMajor ? top : left, minorHigh = xMajor ? bottom : right;
+
+    // The offsets from the start inside the bounds, along each axis.
+    int64_t firstStep = majorStep > 0 ? majorLow - majorStart : majorStart - majorHigh;
+    int64_t lastStep = majorStep > 0 ? majorHigh - majorStart : majorStart - majorLow;
+    int64_t firstMinor = minorStep > 0 ? minorLow - minorStart : minorStart - minorHigh;
+    int64_t lastMinor = minorStep > 0 ? minorHigh - minorStart : minorStart - minorLow;
+    firstStep = APE_MAX(firstStep, (int64_t)0);
+    lastStep = APE_MIN(lastStep, (int64_t)majorLength);
+    if (lastMinor < 0 || firstMinor > (int64_t)minorLength) return;
+
+    const uint64_t half = majorLength / 2;
+    if (minorLength > 0) {
+        // Every product is below 2^64, since the minor offsets are at most minorLength <= majorLength < 2^32.
+        if (firstMinor > 0)
+            firstStep = APE_MAX(firstStep, (int64_t)(((uint64_t)firstMinor * majorLength - half + minorLength - 1) / minorLength));
+        if (lastMinor < (int64_t)minorLength)
+            lastStep = APE_MIN(lastStep, (int64_t)(((uint64_t)(lastMinor + 1) * majorLength - half - 1) / minorLength));
+    }
+    if (firstStep > lastStep) return;
+
+    uint64_t position = (uint64_t)firstStep * minorLength + half;
+    int64_t minor = majorLength > 0 ? (int64_t)(position / majorLength) : 0;
+    uint64_t remainder = majorLength > 0 ? position % majorLength : 0;
+    Point first, last;
+    for (int64_t i = firstStep; i <= lastStep; i++) {
+        int64_t majorPosition = majorStart + majorStep * i, minorPosition = minorStart + minorStep * minor;
+        last = xMajor ? Point((int)majorPosition, (int)minorPosition) : Point((int)minorPosition, (int)majorPosition);
+        if (i == firstStep) first = last;
+        PlotPixel(last.X, last.Y, drawable);
+        remainder += minorLength;
+        if (remainder >= majorLength && majorLength > 0) {
+            remainder -= majorLength;
+            minor++;
+        }
+    }
+    AddDamage(Rectangle::Intersect(Rectangle::FromTwoPoint(first + Point(m_viewport.X, m_viewport.Y), last + Point(m_viewport.X, m_viewport.Y)), drawable));
+}
+void APE::Software::SoftwareRenderer::DrawRectangle(const APE::Rectangle& area) {
+    if (area.IsEmptyArea()) return;
+    Rectangle r(area.LeftSide(), area.TopSide(), abs(area.Width), abs(area.Height));
+
+    // Draw each border once, so blending didn't apply twice on the corners.
+    FillRectangle(Rectangle(r.X, r.Y, r.Width, 1));
+    if (r.Height > 1)
+        FillRectangle(Rectangle(r.X, r.Y + r.Height - 1, r.Width, 1));
+    if (r.Height > 2) {
+        FillRectangle(Rectangle(r.X, r.Y + 1, 1, r.Height - 2));
+        if (r.Width > 1)
+            FillRectangle(Rectangle(r.X + r.Width - 1, r.Y + 1, 1, r.Height - 2));
+    }
+}
+void APE::Software::SoftwareRenderer::FillRectangle(const APE::Rectangle& area) {
+    if (area.IsEmptyArea()) return;
+    Rectangle target(area.LeftSide() + m_viewport.X, area.TopSide() + m_viewport.Y, abs(area.Width), abs(area.Height));
+    target = Rectangle::Intersect(target, GetDrawableArea());
+    if (target.IsEmptyArea()) return;
+    AddDamage(target);
+
+    if (m_tiles) {
+        TileState::Command command;
+        command.Area = target;
+        command.Color = m_drawColor;
+        command.Mode = m_blendMode;
+        command.IsTriangle = false;
+        m_tiles->Record(command);
+        return;
+    }
+    for (int y = target.Y; y < target.Y + target.Height; y++)
+        FillSpan(&m_backBuffer[static_cast<std::size_t>(y) * m_size.Width + target.X], target.Width, m_drawColor, m_blendMode);
+}
+
+void APE::Software::SoftwareRenderer::DrawRoundedRectangle(const APE::Rectangle& area, int radius) {
+    if (area.IsEmptyArea()) return;
+    if (radius <= 0) return DrawRectangle(area);
+
+    // Same geometry as the SDL2Renderer shapes: the corners are centered on pixel centers.
+    Rectangle pixels(area.LeftSide(), area.TopSide(), abs(area.Width), abs(area.Height));
+    m_shapeSprite.Clear();
+    m_tessellator.AppendRoundedRectangleOutline(m_shapeSprite, pixels, radius + 0.5, 1.0, m_drawColor);
+    RenderSprite(m_shapeSprite);
+}
+void APE::Software::SoftwareRenderer::FillRoundedRectangle(const APE::Rectangle& area, int radius) {
+    if (area.IsEmptyArea()) return;
+    if (radius <= 0) return FillRectangle(area);
+
+    Rectangle pixels(area.LeftSide(), area.TopSide(), abs(area.Width), abs(area.Height));
+    m_shapeSprite.Clear();
+    m_tessellator.AppendFilledRoundedRectangle(m_shapeSprite, pixels, radius + 0.5, m_drawColor);
+    RenderSprite(m_shapeSprite);
+}
+
+void APE::Software::SoftwareRenderer::DrawCircle(const APE::Point& center, int radius) { DrawEllipse(center, radius, radius); }
+void APE::Software::SoftwareRenderer::DrawEllipse(const APE::Point& center, int radiusX, int radiusY) {
+    if (radiusX == 0 || radiusY == 0) return;
+    m_shapeSprite.Clear();
+    m_tessellator.AppendEllipseOutline(m_shapeSprite, Vector2(center.X + 0.5, center.Y + 0.5), abs(radiusX), abs(radiusY), 1.0, m_drawColor);
+    RenderSprite(m_shapeSprite);
+}
+
+void APE::Software::SoftwareRenderer::FillCircle(const APE::Point& center, int radius) { FillEllipse(center, radius, radius); }
+void APE::Software::SoftwareRenderer::FillEllipse(const APE::Point& center, int radiusX, int radiusY) {
+    if (radiusX == 0 || radiusY == 0) return;
+    m_shapeSprite.Clear();
+    m_tessellator.AppendFilledEllipse(m_shapeSprite, Vector2(center.X + 0.5, center.Y + 0.5), abs(radiusX) + 0.5, abs(radiusY) + 0.5, m_drawColor);
+    RenderSprite(m_shapeSprite);
+}
+
+void APE::Software::SoftwareRenderer::RenderSprite(const APE::Sprite& sprite) {
+    Rectangle drawable = GetDrawableArea();
+    if (drawable.IsEmptyArea()) return;
+
+    const std::vector<Vertex>& vertices = sprite.GetVertices();
+    const std::vector<std::size_t>& triangles = sprite.GetTriangles();
+    Vector2 offset(m_viewport.X, m_viewport.Y);
+
+    RasterTriangle triangle;
+    Rectangle damage = Rectangle::Empty;
+    for (std::size_t i = 0; i + 2 < triangles.size(); i += 3) {
+        if (triangles[i] >= vertices.size() || triangles[i + 1] >= vertices.size() || triangles[i + 2] >= vertices.size())
+            continue;
+        const Vertex& v0 = vertices[triangles[i]];
+        const Vertex& v1 = vertices[triangles[i + 1]];
+        const Vertex& v2 = vertices[triangles[i + 2]];
+
+        Vector2 positions[3] = { v0.Position + offset, v1.Position + offset, v2.Position + offset };
+        Color colors[3] = { v0.Color, v1.Color, v2.Color };
+        if (!SetupTriangle(positions, colors, triangle)) continue;
+        if (m_damage) {
+            Rectangle area = Rectangle::Intersect(triangle.Bounds, drawable);
+            if (!area.IsEmptyArea())
+                damage = damage.IsEmptyArea() ? area : Rectangle::Union(damage, area);
+        }
+
+        if (m_tiles) {
+            TileState::Command command;
+            command.Area = Rectangle::Intersect(triangle.Bounds, drawable);
+            if (command.Area.IsEmptyArea()) continue;
+            command.Triangle = triangle;
+            command.Mode = m_blendMode;
+            command.IsTriangle = true;
+            m_tiles->Record(command);
+        } else {
+            RasterizeTriangle(triangle, drawable, m_backBuffer.data(), m_size.Width, m_blendMode, m_rasterKernel);
+        }
+    }
+    AddDamage(damage);
+}
+
+const APE::Color* APE::Software::SoftwareRenderer::GetBackBuffer() const { return m_backBuffer.data(); }
+const APE::Color* APE::Software::SoftwareRenderer::GetPixels() const { return m_frontBuffer.data(); }
+APE::Color APE::Software::SoftwareRenderer::GetPixel(const APE::Point& position) const {
+    if (position.X < 0 || position.Y < 0 || position.X >= m_size.Width || position.Y >= m_size.Height)
+        return Color::Empty;
+    return m_frontBuffer[static_cast<std::size_t>(position.Y) * m_size.Width + position.X];
+}